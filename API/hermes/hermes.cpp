@@ -1228,6 +1228,67 @@ void HermesRuntime::loadSegment(
       std::move(ret.first), requireContext, flags));
 }
 
+namespace {
+/// Calls the embedder's release callback once the VM no longer refers to the
+/// characters of an external string.
+class ExternalStringReleaser final : public vm::ExternalStringOwner {
+ public:
+  explicit ExternalStringReleaser(std::function<void()> release)
+      : release_(std::move(release)) {}
+
+  ~ExternalStringReleaser() override {
+    if (release_)
+      release_();
+  }
+
+ private:
+  std::function<void()> release_;
+};
+} // namespace
+
+jsi::String HermesRuntime::createExternalStringFromLatin1(
+    const char *latin1,
+    size_t length,
+    std::function<void()> release) {
+  auto owner = std::make_unique<ExternalStringReleaser>(std::move(release));
+  return maybeRethrow([&] {
+    vm::GCScope gcScope(&impl(this)->runtime_);
+    vm::CallResult<vm::HermesValue> strRes{vm::ExecutionStatus::EXCEPTION};
+    if (::hermes::isAllASCII(latin1, latin1 + length)) {
+      strRes = vm::StringPrimitive::createExternal(
+          &impl(this)->runtime_,
+          llvh::makeArrayRef(latin1, length),
+          std::move(owner));
+    } else {
+      // One-byte strings must be ASCII, so widen the Latin-1 characters.
+      std::u16string widened(latin1, latin1 + length);
+      for (char16_t &c : widened)
+        c &= 0xff;
+      owner.reset();
+      strRes = vm::StringPrimitive::createEfficient(
+          &impl(this)->runtime_, std::move(widened));
+    }
+    impl(this)->checkStatus(strRes.getStatus());
+    return impl(this)->add<jsi::String>(*strRes);
+  });
+}
+
+jsi::String HermesRuntime::createExternalStringFromUtf16(
+    const char16_t *utf16,
+    size_t length,
+    std::function<void()> release) {
+  auto owner = std::make_unique<ExternalStringReleaser>(std::move(release));
+  return maybeRethrow([&] {
+    vm::GCScope gcScope(&impl(this)->runtime_);
+    auto strRes = vm::StringPrimitive::createExternal(
+        &impl(this)->runtime_,
+        llvh::makeArrayRef(utf16, length),
+        std::move(owner));
+    impl(this)->checkStatus(strRes.getStatus());
+    return impl(this)->add<jsi::String>(*strRes);
+  });
+}
+
 uint64_t HermesRuntime::getUniqueID(const jsi::Object &o) const {
   return impl(this)->runtime_.getHeap().getObjectID(
       static_cast<vm::GCCell *>(impl(this)->phv(o).getObject()));
@@ -9,6 +9,7 @@
 #define HERMES_HERMES_H
 
 #include <exception>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -223,6 +224,26 @@ class HERMES_EXPORT HermesRuntime : public jsi::Runtime {
       const std::shared_ptr<const jsi::Buffer> &sourceMapBuf,
       const std::string &sourceURL);
 
+  /// Create a JS string from the \p length Latin-1 characters at \p latin1
+  /// without copying them into the JS heap. The characters must remain valid
+  /// and unchanged until \p release is called. The VM calls \p release exactly
+  /// once, when the string is garbage collected or the runtime is destroyed,
+  /// and it may do so on a background GC thread. Short strings and strings
+  /// containing non-ASCII characters are copied instead, in which case \p
+  /// release is called before this function returns.
+  /// The size of the characters is reported to the GC as external memory.
+  jsi::String createExternalStringFromLatin1(
+      const char *latin1,
+      size_t length,
+      std::function<void()> release);
+
+  /// Same as \c createExternalStringFromLatin1, but for \p length UTF-16 code
+  /// units at \p utf16. Only short strings are copied.
+  jsi::String createExternalStringFromUtf16(
+      const char16_t *utf16,
+      size_t length,
+      std::function<void()> release);
+
  private:
   // Only HermesRuntimeImpl can subclass this.
   HermesRuntime() = default;
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compileJS.dir/CompileJS.cpp.o"
+  "CMakeFiles/compileJS.dir/CompileJS.cpp.o.d"
+  "libcompileJS.a"
+  "libcompileJS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compileJS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesapi.dir/DebuggerAPI.cpp.o"
+  "CMakeFiles/hermesapi.dir/DebuggerAPI.cpp.o.d"
+  "CMakeFiles/hermesapi.dir/hermes.cpp.o"
+  "CMakeFiles/hermesapi.dir/hermes.cpp.o.d"
+  "libhermesapi.a"
+  "libhermesapi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
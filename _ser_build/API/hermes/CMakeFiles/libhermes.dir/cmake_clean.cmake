@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libhermes.dir/DebuggerAPI.cpp.o"
+  "CMakeFiles/libhermes.dir/DebuggerAPI.cpp.o.d"
+  "CMakeFiles/libhermes.dir/hermes.cpp.o"
+  "CMakeFiles/libhermes.dir/hermes.cpp.o.d"
+  "libhermes.pdb"
+  "libhermes.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libhermes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
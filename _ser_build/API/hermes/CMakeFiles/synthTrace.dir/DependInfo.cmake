@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/API/hermes/SynthTrace.cpp" "API/hermes/CMakeFiles/synthTrace.dir/SynthTrace.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace.dir/SynthTrace.cpp.o.d"
+  "/root/repo/API/hermes/TracingRuntime.cpp" "API/hermes/CMakeFiles/synthTrace.dir/TracingRuntime.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace.dir/TracingRuntime.cpp.o.d"
+  "/root/repo/API/hermes/hermes_tracing.cpp" "API/hermes/CMakeFiles/synthTrace.dir/hermes_tracing.cpp.o" "gcc" "API/hermes/CMakeFiles/synthTrace.dir/hermes_tracing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/API/hermes/CMakeFiles/hermesapi.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/jsi/CMakeFiles/jsi.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/VM/CMakeFiles/hermesVMRuntime.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/ADT/CMakeFiles/hermesADT.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/CMakeFiles/hermesPlatform.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Intl/CMakeFiles/hermesPlatformIntl.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Inst/CMakeFiles/hermesInst.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/BCGen/CMakeFiles/hermesBackend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesFrontend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/SourceMap/CMakeFiles/hermesSourceMap.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/InternalBytecode/CMakeFiles/hermesInternalBytecode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
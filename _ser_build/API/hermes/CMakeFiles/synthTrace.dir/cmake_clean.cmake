@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/synthTrace.dir/SynthTrace.cpp.o"
+  "CMakeFiles/synthTrace.dir/SynthTrace.cpp.o.d"
+  "CMakeFiles/synthTrace.dir/TracingRuntime.cpp.o"
+  "CMakeFiles/synthTrace.dir/TracingRuntime.cpp.o.d"
+  "CMakeFiles/synthTrace.dir/hermes_tracing.cpp.o"
+  "CMakeFiles/synthTrace.dir/hermes_tracing.cpp.o.d"
+  "libsynthTrace.a"
+  "libsynthTrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
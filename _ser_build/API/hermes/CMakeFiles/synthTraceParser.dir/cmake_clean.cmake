@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/synthTraceParser.dir/SynthTraceParser.cpp.o"
+  "CMakeFiles/synthTraceParser.dir/SynthTraceParser.cpp.o.d"
+  "libsynthTraceParser.a"
+  "libsynthTraceParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synthTraceParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceInterpreter.dir/TraceInterpreter.cpp.o"
+  "CMakeFiles/traceInterpreter.dir/TraceInterpreter.cpp.o.d"
+  "libtraceInterpreter.a"
+  "libtraceInterpreter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traceInterpreter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/github-cli-release"
+  "github/hermes-cli-linux-v0.8.0.tar.gz"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/github-cli-release.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/make_bundle_dir"
+  "bundle"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/make_bundle_dir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtoa.dir/dtoa.c.o"
+  "CMakeFiles/dtoa.dir/dtoa.c.o.d"
+  "CMakeFiles/dtoa.dir/g_fmt.c.o"
+  "CMakeFiles/dtoa.dir/g_fmt.c.o.d"
+  "CMakeFiles/dtoa.dir/locks.cpp.o"
+  "CMakeFiles/dtoa.dir/locks.cpp.o.d"
+  "libdtoa.a"
+  "libdtoa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dtoa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/llvh/lib/Demangle/ItaniumDemangle.cpp" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/ItaniumDemangle.cpp.o" "gcc" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/ItaniumDemangle.cpp.o.d"
+  "/root/repo/external/llvh/lib/Demangle/MicrosoftDemangle.cpp" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/MicrosoftDemangle.cpp.o" "gcc" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/MicrosoftDemangle.cpp.o.d"
+  "/root/repo/external/llvh/lib/Demangle/MicrosoftDemangleNodes.cpp" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/MicrosoftDemangleNodes.cpp.o" "gcc" "external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/MicrosoftDemangleNodes.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LLVHDemangle.dir/ItaniumDemangle.cpp.o"
+  "CMakeFiles/LLVHDemangle.dir/ItaniumDemangle.cpp.o.d"
+  "CMakeFiles/LLVHDemangle.dir/MicrosoftDemangle.cpp.o"
+  "CMakeFiles/LLVHDemangle.dir/MicrosoftDemangle.cpp.o.d"
+  "CMakeFiles/LLVHDemangle.dir/MicrosoftDemangleNodes.cpp.o"
+  "CMakeFiles/LLVHDemangle.dir/MicrosoftDemangleNodes.cpp.o.d"
+  "libLLVHDemangle.a"
+  "libLLVHDemangle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LLVHDemangle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
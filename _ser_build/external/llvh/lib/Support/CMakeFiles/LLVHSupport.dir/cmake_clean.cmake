@@ -0,0 +1,117 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LLVHSupport.dir/APFloat.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/APFloat.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/APInt.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/APInt.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/CommandLine.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/CommandLine.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/ConvertUTF.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/ConvertUTF.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/ConvertUTFWrapper.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/ConvertUTFWrapper.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Debug.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Debug.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Errno.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Errno.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Error.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Error.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/ErrorHandling.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/FileCheck.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/FileCheck.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/FoldingSet.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/FoldingSet.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/GraphWriter.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/GraphWriter.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Hashing.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Hashing.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Host.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Host.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/InitLLVM.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/InitLLVM.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/LineIterator.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/LineIterator.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Locale.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Locale.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/MD5.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/MD5.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/ManagedStatic.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/ManagedStatic.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Memory.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Memory.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/MemoryBuffer.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/MemoryBuffer.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Mutex.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Mutex.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/NativeFormatting.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/NativeFormatting.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Path.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Path.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/PrettyStackTrace.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/PrettyStackTrace.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Process.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Process.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Program.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Program.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Regex.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Regex.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/SHA1.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/SHA1.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Signals.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Signals.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/SmallPtrSet.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/SmallPtrSet.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/SmallVector.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/SmallVector.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/SourceMgr.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/SourceMgr.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Statistic.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Statistic.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/StringExtras.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/StringExtras.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/StringMap.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/StringMap.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/StringRef.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/StringRef.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/StringSaver.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/StringSaver.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/TargetParser.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/TargetParser.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Threading.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Threading.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Timer.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Timer.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Triple.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Triple.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Twine.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Twine.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Unicode.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Unicode.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Valgrind.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Valgrind.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/Watchdog.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/Watchdog.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/circular_raw_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/circular_raw_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/raw_os_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/raw_os_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/raw_ostream.cpp.o"
+  "CMakeFiles/LLVHSupport.dir/raw_ostream.cpp.o.d"
+  "CMakeFiles/LLVHSupport.dir/regcomp.c.o"
+  "CMakeFiles/LLVHSupport.dir/regcomp.c.o.d"
+  "CMakeFiles/LLVHSupport.dir/regerror.c.o"
+  "CMakeFiles/LLVHSupport.dir/regerror.c.o.d"
+  "CMakeFiles/LLVHSupport.dir/regexec.c.o"
+  "CMakeFiles/LLVHSupport.dir/regexec.c.o.d"
+  "CMakeFiles/LLVHSupport.dir/regfree.c.o"
+  "CMakeFiles/LLVHSupport.dir/regfree.c.o.d"
+  "CMakeFiles/LLVHSupport.dir/regstrlcpy.c.o"
+  "CMakeFiles/LLVHSupport.dir/regstrlcpy.c.o.d"
+  "libLLVHSupport.a"
+  "libLLVHSupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/LLVHSupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/not"
+  "../../../../bin/not.pdb"
+  "CMakeFiles/not.dir/not.cpp.o"
+  "CMakeFiles/not.dir/not.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/not.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
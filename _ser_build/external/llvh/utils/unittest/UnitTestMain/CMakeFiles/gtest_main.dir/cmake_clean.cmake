@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gtest_main.dir/TestMain.cpp.o"
+  "CMakeFiles/gtest_main.dir/TestMain.cpp.o.d"
+  "libgtest_main.a"
+  "libgtest_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gtest_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zip.dir/src/zip.c.o"
+  "CMakeFiles/zip.dir/src/zip.c.o.d"
+  "libzip.a"
+  "libzip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// This file is processed by CMake.
+// See https://cmake.org/cmake/help/v3.0/command/configure_file.html.
+
+#ifndef HERMES_SUPPORT_CONFIG_H
+#define HERMES_SUPPORT_CONFIG_H
+
+/*
+ * These values are automatically set according to their cmake variables.
+ */
+
+/// Is std::is_trivially_copyable<> implemented.
+#define HAVE_IS_TRIVIALLY_COPYABLE
+
+#endif // HERMES_SUPPORT_CONFIG_H
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesADT.dir/CompactArray.cpp.o"
+  "CMakeFiles/hermesADT.dir/CompactArray.cpp.o.d"
+  "libhermesADT.a"
+  "libhermesADT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesADT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/AST/ASTBuilder.cpp" "lib/AST/CMakeFiles/hermesAST.dir/ASTBuilder.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/ASTBuilder.cpp.o.d"
+  "/root/repo/lib/AST/CommonJS.cpp" "lib/AST/CMakeFiles/hermesAST.dir/CommonJS.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/CommonJS.cpp.o.d"
+  "/root/repo/lib/AST/ESTree.cpp" "lib/AST/CMakeFiles/hermesAST.dir/ESTree.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/ESTree.cpp.o.d"
+  "/root/repo/lib/AST/ESTreeJSONDumper.cpp" "lib/AST/CMakeFiles/hermesAST.dir/ESTreeJSONDumper.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/ESTreeJSONDumper.cpp.o.d"
+  "/root/repo/lib/AST/SemValidate.cpp" "lib/AST/CMakeFiles/hermesAST.dir/SemValidate.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/SemValidate.cpp.o.d"
+  "/root/repo/lib/AST/SemanticValidator.cpp" "lib/AST/CMakeFiles/hermesAST.dir/SemanticValidator.cpp.o" "gcc" "lib/AST/CMakeFiles/hermesAST.dir/SemanticValidator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesAST.dir/ASTBuilder.cpp.o"
+  "CMakeFiles/hermesAST.dir/ASTBuilder.cpp.o.d"
+  "CMakeFiles/hermesAST.dir/CommonJS.cpp.o"
+  "CMakeFiles/hermesAST.dir/CommonJS.cpp.o.d"
+  "CMakeFiles/hermesAST.dir/ESTree.cpp.o"
+  "CMakeFiles/hermesAST.dir/ESTree.cpp.o.d"
+  "CMakeFiles/hermesAST.dir/ESTreeJSONDumper.cpp.o"
+  "CMakeFiles/hermesAST.dir/ESTreeJSONDumper.cpp.o.d"
+  "CMakeFiles/hermesAST.dir/SemValidate.cpp.o"
+  "CMakeFiles/hermesAST.dir/SemValidate.cpp.o.d"
+  "CMakeFiles/hermesAST.dir/SemanticValidator.cpp.o"
+  "CMakeFiles/hermesAST.dir/SemanticValidator.cpp.o.d"
+  "libhermesAST.a"
+  "libhermesAST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesAST2JS.dir/AST2JS.cpp.o"
+  "CMakeFiles/hermesAST2JS.dir/AST2JS.cpp.o.d"
+  "libhermesAST2JS.a"
+  "libhermesAST2JS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesAST2JS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
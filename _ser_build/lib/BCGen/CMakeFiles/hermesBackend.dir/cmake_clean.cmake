@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesBackend.dir/BCOpt.cpp.o"
+  "CMakeFiles/hermesBackend.dir/BCOpt.cpp.o.d"
+  "CMakeFiles/hermesBackend.dir/Exceptions.cpp.o"
+  "CMakeFiles/hermesBackend.dir/Exceptions.cpp.o.d"
+  "CMakeFiles/hermesBackend.dir/Lowering.cpp.o"
+  "CMakeFiles/hermesBackend.dir/Lowering.cpp.o.d"
+  "CMakeFiles/hermesBackend.dir/RegAlloc.cpp.o"
+  "CMakeFiles/hermesBackend.dir/RegAlloc.cpp.o.d"
+  "libhermesBackend.a"
+  "libhermesBackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesBackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/BCGen/HBC/BackendContext.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BackendContext.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BackendContext.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Bytecode.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Bytecode.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Bytecode.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeDataProvider.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeDataProvider.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeDataProvider.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeDisassembler.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeDisassembler.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeDisassembler.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeFormConverter.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeFormConverter.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeFormConverter.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeGenerator.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeGenerator.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeGenerator.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeProviderFromSrc.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeProviderFromSrc.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeProviderFromSrc.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/BytecodeStream.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeStream.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/BytecodeStream.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/ConsecutiveStringStorage.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/ConsecutiveStringStorage.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/ConsecutiveStringStorage.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/DebugInfo.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/DebugInfo.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/DebugInfo.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/HBC.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/HBC.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/HBC.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/ISel.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/ISel.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/ISel.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/FuncCallNOpts.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/FuncCallNOpts.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/FuncCallNOpts.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/InsertProfilePoint.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/InsertProfilePoint.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/InsertProfilePoint.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/LowerBuiltinCalls.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/LowerBuiltinCalls.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/LowerBuiltinCalls.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/Passes/OptEnvironmentInit.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/OptEnvironmentInit.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/Passes/OptEnvironmentInit.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/SerializedLiteralGenerator.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SerializedLiteralGenerator.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SerializedLiteralGenerator.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/SerializedLiteralParserBase.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SerializedLiteralParserBase.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SerializedLiteralParserBase.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/SimpleBytecodeBuilder.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SimpleBytecodeBuilder.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/TraverseLiteralStrings.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/TraverseLiteralStrings.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/TraverseLiteralStrings.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/UniquingFilenameTable.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/UniquingFilenameTable.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/UniquingFilenameTable.cpp.o.d"
+  "/root/repo/lib/BCGen/HBC/UniquingStringLiteralTable.cpp" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/UniquingStringLiteralTable.cpp.o" "gcc" "lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/UniquingStringLiteralTable.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/BCGen/CMakeFiles/hermesBackend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Inst/CMakeFiles/hermesInst.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/SourceMap/CMakeFiles/hermesSourceMap.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesFrontend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesHBCBackend.dir/BackendContext.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BackendContext.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Bytecode.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Bytecode.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeDataProvider.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeDataProvider.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeDisassembler.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeDisassembler.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeFormConverter.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeFormConverter.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeGenerator.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeGenerator.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeProviderFromSrc.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeProviderFromSrc.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeStream.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/BytecodeStream.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/ConsecutiveStringStorage.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/ConsecutiveStringStorage.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/DebugInfo.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/HBC.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/HBC.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/ISel.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/ISel.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Passes.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Passes.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/FuncCallNOpts.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/FuncCallNOpts.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/InsertProfilePoint.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/InsertProfilePoint.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/LowerBuiltinCalls.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/LowerBuiltinCalls.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/OptEnvironmentInit.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/Passes/OptEnvironmentInit.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/SerializedLiteralGenerator.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/SerializedLiteralGenerator.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/SerializedLiteralParserBase.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/SerializedLiteralParserBase.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/SimpleBytecodeBuilder.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/SimpleBytecodeBuilder.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/TraverseLiteralStrings.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/TraverseLiteralStrings.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/UniquingFilenameTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/UniquingFilenameTable.cpp.o.d"
+  "CMakeFiles/hermesHBCBackend.dir/UniquingStringLiteralTable.cpp.o"
+  "CMakeFiles/hermesHBCBackend.dir/UniquingStringLiteralTable.cpp.o.d"
+  "libhermesHBCBackend.a"
+  "libhermesHBCBackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesHBCBackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
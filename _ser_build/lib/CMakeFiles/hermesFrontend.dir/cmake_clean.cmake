@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesFrontend.dir/IR/CFG.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/CFG.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IR/ExecutionProfile.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/ExecutionProfile.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IR/IR.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/IR.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IR/IRBuilder.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/IRBuilder.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IR/IRVerifier.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/IRVerifier.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IR/Instrs.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IR/Instrs.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-except.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-except.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-expr.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-expr.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-func.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-func.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-stmt.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen-stmt.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/ESTreeIRGen.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/IRGen.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/IRGen.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/IRGen/IRInstrument.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/IRGen/IRInstrument.cpp.o.d"
+  "CMakeFiles/hermesFrontend.dir/Utils/Dumper.cpp.o"
+  "CMakeFiles/hermesFrontend.dir/Utils/Dumper.cpp.o.d"
+  "libhermesFrontend.a"
+  "libhermesFrontend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
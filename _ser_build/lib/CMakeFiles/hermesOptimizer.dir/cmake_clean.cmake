@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesOptimizer.dir/IR/Analysis.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/IR/Analysis.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/IR/IREval.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/IR/IREval.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/PassManager/Pipeline.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/PassManager/Pipeline.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Auditor.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Auditor.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/CSE.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/CSE.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/CodeMotion.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/CodeMotion.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/DCE.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/DCE.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/FuncSigOpts.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/FuncSigOpts.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/HoistStartGenerator.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/HoistStartGenerator.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Inlining.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Inlining.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/InstSimplify.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/InstSimplify.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/InstructionEscapeAnalysis.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Mem2Reg.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Mem2Reg.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/ResolveStaticRequire.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SCCP.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SCCP.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/ScalarReplacement.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/ScalarReplacement.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SimpleCallGraphProvider.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SimpleCallGraphProvider.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SimplifyCFG.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/SimplifyCFG.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/StackPromotion.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/StackPromotion.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/TDZDedup.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/TDZDedup.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/TypeInference.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/TypeInference.cpp.o.d"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Utils.cpp.o"
+  "CMakeFiles/hermesOptimizer.dir/Optimizer/Scalar/Utils.cpp.o.d"
+  "libhermesOptimizer.a"
+  "libhermesOptimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesOptimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesCompilerDriver.dir/CompilerDriver.cpp.o"
+  "CMakeFiles/hermesCompilerDriver.dir/CompilerDriver.cpp.o.d"
+  "libhermesCompilerDriver.a"
+  "libhermesCompilerDriver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesCompilerDriver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
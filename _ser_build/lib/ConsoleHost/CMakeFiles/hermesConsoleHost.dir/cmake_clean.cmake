@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesConsoleHost.dir/ConsoleHost.cpp.o"
+  "CMakeFiles/hermesConsoleHost.dir/ConsoleHost.cpp.o.d"
+  "CMakeFiles/hermesConsoleHost.dir/MemorySizeParser.cpp.o"
+  "CMakeFiles/hermesConsoleHost.dir/MemorySizeParser.cpp.o.d"
+  "CMakeFiles/hermesConsoleHost.dir/RandomSeedParser.cpp.o"
+  "CMakeFiles/hermesConsoleHost.dir/RandomSeedParser.cpp.o.d"
+  "libhermesConsoleHost.a"
+  "libhermesConsoleHost.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesConsoleHost.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesDependencyExtractor.dir/DependencyExtractor.cpp.o"
+  "CMakeFiles/hermesDependencyExtractor.dir/DependencyExtractor.cpp.o.d"
+  "libhermesDependencyExtractor.a"
+  "libhermesDependencyExtractor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesDependencyExtractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesFlowParser.dir/FlowParser.cpp.o"
+  "CMakeFiles/hermesFlowParser.dir/FlowParser.cpp.o.d"
+  "libhermesFlowParser.a"
+  "libhermesFlowParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFlowParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
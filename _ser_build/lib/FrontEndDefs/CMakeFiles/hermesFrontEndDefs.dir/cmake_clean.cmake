@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesFrontEndDefs.dir/Builtins.cpp.o"
+  "CMakeFiles/hermesFrontEndDefs.dir/Builtins.cpp.o.d"
+  "libhermesFrontEndDefs.a"
+  "libhermesFrontEndDefs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesFrontEndDefs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInst.dir/InstDecode.cpp.o"
+  "CMakeFiles/hermesInst.dir/InstDecode.cpp.o.d"
+  "CMakeFiles/hermesInst.dir/InstDecode2.cpp.o"
+  "CMakeFiles/hermesInst.dir/InstDecode2.cpp.o.d"
+  "libhermesInst.a"
+  "libhermesInst.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
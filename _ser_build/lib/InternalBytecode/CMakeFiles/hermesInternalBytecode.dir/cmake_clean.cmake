@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInternalBytecode.dir/InternalBytecode.cpp.o"
+  "CMakeFiles/hermesInternalBytecode.dir/InternalBytecode.cpp.o.d"
+  "InternalBytecode.hbc"
+  "InternalBytecode.inc"
+  "InternalBytecode.js"
+  "libhermesInternalBytecode.a"
+  "libhermesInternalBytecode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInternalBytecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
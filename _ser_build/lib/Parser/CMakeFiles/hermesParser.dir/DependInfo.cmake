@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Parser/JSLexer.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSLexer.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSLexer.cpp.o.d"
+  "/root/repo/lib/Parser/JSONParser.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSONParser.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSONParser.cpp.o.d"
+  "/root/repo/lib/Parser/JSParser.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSParser.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSParser.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-flow.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-flow.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-flow.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-jsx.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-jsx.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-jsx.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl-ts.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-ts.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl-ts.cpp.o.d"
+  "/root/repo/lib/Parser/JSParserImpl.cpp" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl.cpp.o" "gcc" "lib/Parser/CMakeFiles/hermesParser.dir/JSParserImpl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
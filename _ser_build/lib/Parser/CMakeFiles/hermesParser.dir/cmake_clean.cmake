@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesParser.dir/JSLexer.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSLexer.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSONParser.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSONParser.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSParser.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSParser.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-flow.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-flow.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-jsx.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-jsx.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-ts.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSParserImpl-ts.cpp.o.d"
+  "CMakeFiles/hermesParser.dir/JSParserImpl.cpp.o"
+  "CMakeFiles/hermesParser.dir/JSParserImpl.cpp.o.d"
+  "libhermesParser.a"
+  "libhermesParser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPlatform.dir/Logging.cpp.o"
+  "CMakeFiles/hermesPlatform.dir/Logging.cpp.o.d"
+  "libhermesPlatform.a"
+  "libhermesPlatform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
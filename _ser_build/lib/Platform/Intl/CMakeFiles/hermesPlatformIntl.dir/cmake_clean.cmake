@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPlatformIntl.dir/PlatformIntlAndroid.cpp.o"
+  "CMakeFiles/hermesPlatformIntl.dir/PlatformIntlAndroid.cpp.o.d"
+  "CMakeFiles/hermesPlatformIntl.dir/PlatformIntlDummy.cpp.o"
+  "CMakeFiles/hermesPlatformIntl.dir/PlatformIntlDummy.cpp.o.d"
+  "libhermesPlatformIntl.a"
+  "libhermesPlatformIntl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatformIntl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
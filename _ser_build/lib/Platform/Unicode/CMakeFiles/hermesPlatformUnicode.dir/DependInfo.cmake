@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Platform/Unicode/CharacterProperties.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/CharacterProperties.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/CharacterProperties.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeCF.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeCF.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeCF.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeEmscripten.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeEmscripten.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeEmscripten.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeICU.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeICU.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeICU.cpp.o.d"
+  "/root/repo/lib/Platform/Unicode/PlatformUnicodeJava.cpp" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeJava.cpp.o" "gcc" "lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeJava.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesPlatformUnicode.dir/CharacterProperties.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode.dir/CharacterProperties.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeCF.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeCF.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeEmscripten.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeEmscripten.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeICU.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeICU.cpp.o.d"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeJava.cpp.o"
+  "CMakeFiles/hermesPlatformUnicode.dir/PlatformUnicodeJava.cpp.o.d"
+  "libhermesPlatformUnicode.a"
+  "libhermesPlatformUnicode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesPlatformUnicode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
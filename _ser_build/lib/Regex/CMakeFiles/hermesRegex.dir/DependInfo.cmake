@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Regex/Executor.cpp" "lib/Regex/CMakeFiles/hermesRegex.dir/Executor.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex.dir/Executor.cpp.o.d"
+  "/root/repo/lib/Regex/RegexJIT.cpp" "lib/Regex/CMakeFiles/hermesRegex.dir/RegexJIT.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex.dir/RegexJIT.cpp.o.d"
+  "/root/repo/lib/Regex/RegexParser.cpp" "lib/Regex/CMakeFiles/hermesRegex.dir/RegexParser.cpp.o" "gcc" "lib/Regex/CMakeFiles/hermesRegex.dir/RegexParser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesRegex.dir/Executor.cpp.o"
+  "CMakeFiles/hermesRegex.dir/Executor.cpp.o.d"
+  "CMakeFiles/hermesRegex.dir/RegexJIT.cpp.o"
+  "CMakeFiles/hermesRegex.dir/RegexJIT.cpp.o.d"
+  "CMakeFiles/hermesRegex.dir/RegexParser.cpp.o"
+  "CMakeFiles/hermesRegex.dir/RegexParser.cpp.o.d"
+  "libhermesRegex.a"
+  "libhermesRegex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesRegex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
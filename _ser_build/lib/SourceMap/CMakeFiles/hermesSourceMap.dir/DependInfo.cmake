@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/SourceMap/SourceMap.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMap.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMap.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapGenerator.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapGenerator.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapGenerator.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapParser.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapParser.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapParser.cpp.o.d"
+  "/root/repo/lib/SourceMap/SourceMapTranslator.cpp" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapTranslator.cpp.o" "gcc" "lib/SourceMap/CMakeFiles/hermesSourceMap.dir/SourceMapTranslator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSourceMap.dir/SourceMap.cpp.o"
+  "CMakeFiles/hermesSourceMap.dir/SourceMap.cpp.o.d"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapGenerator.cpp.o"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapGenerator.cpp.o.d"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapParser.cpp.o"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapParser.cpp.o.d"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapTranslator.cpp.o"
+  "CMakeFiles/hermesSourceMap.dir/SourceMapTranslator.cpp.o.d"
+  "libhermesSourceMap.a"
+  "libhermesSourceMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSourceMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
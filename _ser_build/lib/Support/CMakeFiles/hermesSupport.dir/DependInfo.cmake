@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/Support/Allocator.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/Allocator.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/Allocator.cpp.o.d"
+  "/root/repo/lib/Support/Base64.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/Base64.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/Base64.cpp.o.d"
+  "/root/repo/lib/Support/Base64vlq.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/Base64vlq.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/Base64vlq.cpp.o.d"
+  "/root/repo/lib/Support/CheckedMalloc.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/CheckedMalloc.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/CheckedMalloc.cpp.o.d"
+  "/root/repo/lib/Support/Conversions.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/Conversions.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/Conversions.cpp.o.d"
+  "/root/repo/lib/Support/ErrorHandling.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/ErrorHandling.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/ErrorHandling.cpp.o.d"
+  "/root/repo/lib/Support/JSONEmitter.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/JSONEmitter.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/JSONEmitter.cpp.o.d"
+  "/root/repo/lib/Support/LEB128.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/LEB128.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/LEB128.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatEmscripten.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatEmscripten.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatEmscripten.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatPosix.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatPosix.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatPosix.cpp.o.d"
+  "/root/repo/lib/Support/OSCompatWindows.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatWindows.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/OSCompatWindows.cpp.o.d"
+  "/root/repo/lib/Support/PageAccessTrackerPosix.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/PageAccessTrackerPosix.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/PageAccessTrackerPosix.cpp.o.d"
+  "/root/repo/lib/Support/PerfSection.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/PerfSection.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/PerfSection.cpp.o.d"
+  "/root/repo/lib/Support/RegExpSerialization.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/RegExpSerialization.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/RegExpSerialization.cpp.o.d"
+  "/root/repo/lib/Support/SHA1.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/SHA1.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/SHA1.cpp.o.d"
+  "/root/repo/lib/Support/SNPrintfBuf.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/SNPrintfBuf.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/SNPrintfBuf.cpp.o.d"
+  "/root/repo/lib/Support/Semaphore.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/Semaphore.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/Semaphore.cpp.o.d"
+  "/root/repo/lib/Support/SimpleDiagHandler.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/SimpleDiagHandler.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/SimpleDiagHandler.cpp.o.d"
+  "/root/repo/lib/Support/SourceErrorManager.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/SourceErrorManager.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/SourceErrorManager.cpp.o.d"
+  "/root/repo/lib/Support/StringKernels.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/StringKernels.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/StringKernels.cpp.o.d"
+  "/root/repo/lib/Support/StringKind.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/StringKind.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/StringKind.cpp.o.d"
+  "/root/repo/lib/Support/StringTable.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/StringTable.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/StringTable.cpp.o.d"
+  "/root/repo/lib/Support/UTF16Stream.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/UTF16Stream.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/UTF16Stream.cpp.o.d"
+  "/root/repo/lib/Support/UTF8.cpp" "lib/Support/CMakeFiles/hermesSupport.dir/UTF8.cpp.o" "gcc" "lib/Support/CMakeFiles/hermesSupport.dir/UTF8.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesSupport.dir/Allocator.cpp.o"
+  "CMakeFiles/hermesSupport.dir/Allocator.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/Base64.cpp.o"
+  "CMakeFiles/hermesSupport.dir/Base64.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/Base64vlq.cpp.o"
+  "CMakeFiles/hermesSupport.dir/Base64vlq.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/CheckedMalloc.cpp.o"
+  "CMakeFiles/hermesSupport.dir/CheckedMalloc.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/Conversions.cpp.o"
+  "CMakeFiles/hermesSupport.dir/Conversions.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/ErrorHandling.cpp.o"
+  "CMakeFiles/hermesSupport.dir/ErrorHandling.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/JSONEmitter.cpp.o"
+  "CMakeFiles/hermesSupport.dir/JSONEmitter.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/LEB128.cpp.o"
+  "CMakeFiles/hermesSupport.dir/LEB128.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/OSCompatEmscripten.cpp.o"
+  "CMakeFiles/hermesSupport.dir/OSCompatEmscripten.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/OSCompatPosix.cpp.o"
+  "CMakeFiles/hermesSupport.dir/OSCompatPosix.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/OSCompatWindows.cpp.o"
+  "CMakeFiles/hermesSupport.dir/OSCompatWindows.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/PageAccessTrackerPosix.cpp.o"
+  "CMakeFiles/hermesSupport.dir/PageAccessTrackerPosix.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/PerfSection.cpp.o"
+  "CMakeFiles/hermesSupport.dir/PerfSection.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/RegExpSerialization.cpp.o"
+  "CMakeFiles/hermesSupport.dir/RegExpSerialization.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/SHA1.cpp.o"
+  "CMakeFiles/hermesSupport.dir/SHA1.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/SNPrintfBuf.cpp.o"
+  "CMakeFiles/hermesSupport.dir/SNPrintfBuf.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/Semaphore.cpp.o"
+  "CMakeFiles/hermesSupport.dir/Semaphore.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/SimpleDiagHandler.cpp.o"
+  "CMakeFiles/hermesSupport.dir/SimpleDiagHandler.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/SourceErrorManager.cpp.o"
+  "CMakeFiles/hermesSupport.dir/SourceErrorManager.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/StringKernels.cpp.o"
+  "CMakeFiles/hermesSupport.dir/StringKernels.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/StringKind.cpp.o"
+  "CMakeFiles/hermesSupport.dir/StringKind.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/StringTable.cpp.o"
+  "CMakeFiles/hermesSupport.dir/StringTable.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/UTF16Stream.cpp.o"
+  "CMakeFiles/hermesSupport.dir/UTF16Stream.cpp.o.d"
+  "CMakeFiles/hermesSupport.dir/UTF8.cpp.o"
+  "CMakeFiles/hermesSupport.dir/UTF8.cpp.o.d"
+  "libhermesSupport.a"
+  "libhermesSupport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesSupport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,158 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/VM/ArrayStorage.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/ArrayStorage.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/ArrayStorage.cpp.o.d"
+  "/root/repo/lib/VM/BasicBlockExecutionInfo.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BasicBlockExecutionInfo.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BasicBlockExecutionInfo.cpp.o.d"
+  "/root/repo/lib/VM/BoxedDouble.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BoxedDouble.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BoxedDouble.cpp.o.d"
+  "/root/repo/lib/VM/BuildMetadata.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BuildMetadata.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/BuildMetadata.cpp.o.d"
+  "/root/repo/lib/VM/Callable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Callable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Callable.cpp.o.d"
+  "/root/repo/lib/VM/CellKind.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CellKind.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CellKind.cpp.o.d"
+  "/root/repo/lib/VM/CheckHeapWellFormedAcceptor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CheckHeapWellFormedAcceptor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CheckHeapWellFormedAcceptor.cpp.o.d"
+  "/root/repo/lib/VM/CodeBlock.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CodeBlock.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/CodeBlock.cpp.o.d"
+  "/root/repo/lib/VM/Debugger/Debugger.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Debugger/Debugger.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Debugger/Debugger.cpp.o.d"
+  "/root/repo/lib/VM/DecoratedObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DecoratedObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DecoratedObject.cpp.o.d"
+  "/root/repo/lib/VM/Deserializer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Deserializer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Deserializer.cpp.o.d"
+  "/root/repo/lib/VM/DictPropertyMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DictPropertyMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DictPropertyMap.cpp.o.d"
+  "/root/repo/lib/VM/Domain.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Domain.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Domain.cpp.o.d"
+  "/root/repo/lib/VM/DummyObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DummyObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/DummyObject.cpp.o.d"
+  "/root/repo/lib/VM/GCBase.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/GCBase.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/GCBase.cpp.o.d"
+  "/root/repo/lib/VM/GCCell.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/GCCell.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/GCCell.cpp.o.d"
+  "/root/repo/lib/VM/HandleRootOwner.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HandleRootOwner.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HandleRootOwner.cpp.o.d"
+  "/root/repo/lib/VM/HeapSnapshot.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HeapSnapshot.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HeapSnapshot.cpp.o.d"
+  "/root/repo/lib/VM/HermesValue.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HermesValue.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HermesValue.cpp.o.d"
+  "/root/repo/lib/VM/HiddenClass.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HiddenClass.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HiddenClass.cpp.o.d"
+  "/root/repo/lib/VM/HostModel.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HostModel.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/HostModel.cpp.o.d"
+  "/root/repo/lib/VM/IdentifierTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/IdentifierTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/IdentifierTable.cpp.o.d"
+  "/root/repo/lib/VM/Interpreter-slowpaths.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Interpreter-slowpaths.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Interpreter-slowpaths.cpp.o.d"
+  "/root/repo/lib/VM/Interpreter.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Interpreter.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Interpreter.cpp.o.d"
+  "/root/repo/lib/VM/JSArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSArray.cpp.o.d"
+  "/root/repo/lib/VM/JSArrayBuffer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSArrayBuffer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSArrayBuffer.cpp.o.d"
+  "/root/repo/lib/VM/JSCallableProxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSCallableProxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSCallableProxy.cpp.o.d"
+  "/root/repo/lib/VM/JSDataView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSDataView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSDataView.cpp.o.d"
+  "/root/repo/lib/VM/JSDate.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSDate.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSDate.cpp.o.d"
+  "/root/repo/lib/VM/JSError.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSError.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSError.cpp.o.d"
+  "/root/repo/lib/VM/JSGenerator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSGenerator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSGenerator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Array.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Array.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Array.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/ArrayBuffer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayBuffer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayBuffer.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/ArrayIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/AsyncFunction.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/AsyncFunction.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/AsyncFunction.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Boolean.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Boolean.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Boolean.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DataView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DataView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DataView.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Date.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Date.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Date.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DateUtil.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DateUtil.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DateUtil.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/DebuggerInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DebuggerInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/DebuggerInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Error.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Error.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Error.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Function.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Function.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Function.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GeneratorFunction.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorFunction.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorFunction.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GeneratorPrototype.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorPrototype.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorPrototype.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/GlobalObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GlobalObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/GlobalObject.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/HermesBuiltin.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/HermesBuiltin.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/HermesBuiltin.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/HermesInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/HermesInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/HermesInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Instrument.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Instrument.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Instrument.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Intl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Intl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Intl.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/IteratorPrototype.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/IteratorPrototype.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/IteratorPrototype.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSLibInternal.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSLibInternal.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSLibInternal.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSON.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSON.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSON.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/JSONLexer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSONLexer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/JSONLexer.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Map.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Map.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Map.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Math.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Math.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Math.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Number.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Number.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Number.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Object.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Object.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Object.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Proxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Proxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Proxy.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Reflect.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Reflect.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Reflect.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RegExp.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RegExp.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RegExp.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RegExpStringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RegExpStringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RegExpStringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RuntimeCommonStorage.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeCommonStorage.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeCommonStorage.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/RuntimeJSONUtils.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeJSONUtils.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeJSONUtils.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Set.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Set.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Set.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Sorting.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Sorting.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Sorting.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/String.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/String.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/String.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/StringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/StringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/StringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/Symbol.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Symbol.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/Symbol.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/TypedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/TypedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/TypedArray.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/WeakMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/WeakMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/WeakMap.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/WeakSet.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/WeakSet.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/WeakSet.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/escape.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/escape.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/escape.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/eval.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/eval.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/eval.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/print.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/print.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/print.cpp.o.d"
+  "/root/repo/lib/VM/JSLib/require.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/require.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSLib/require.cpp.o.d"
+  "/root/repo/lib/VM/JSMapImpl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSMapImpl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSMapImpl.cpp.o.d"
+  "/root/repo/lib/VM/JSNativeFunctions.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSNativeFunctions.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSNativeFunctions.cpp.o.d"
+  "/root/repo/lib/VM/JSObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSObject.cpp.o.d"
+  "/root/repo/lib/VM/JSProxy.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSProxy.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSProxy.cpp.o.d"
+  "/root/repo/lib/VM/JSRegExp.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSRegExp.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSRegExp.cpp.o.d"
+  "/root/repo/lib/VM/JSRegExpStringIterator.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSRegExpStringIterator.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSRegExpStringIterator.cpp.o.d"
+  "/root/repo/lib/VM/JSTypedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSTypedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSTypedArray.cpp.o.d"
+  "/root/repo/lib/VM/JSWeakMapImpl.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSWeakMapImpl.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/JSWeakMapImpl.cpp.o.d"
+  "/root/repo/lib/VM/LimitedStorageProvider.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/LimitedStorageProvider.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/LimitedStorageProvider.cpp.o.d"
+  "/root/repo/lib/VM/Metadata.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Metadata.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Metadata.cpp.o.d"
+  "/root/repo/lib/VM/Operations.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Operations.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Operations.cpp.o.d"
+  "/root/repo/lib/VM/OrderedHashMap.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/OrderedHashMap.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/OrderedHashMap.cpp.o.d"
+  "/root/repo/lib/VM/PredefinedStringIDs.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PredefinedStringIDs.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PredefinedStringIDs.cpp.o.d"
+  "/root/repo/lib/VM/PrimitiveBox.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PrimitiveBox.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PrimitiveBox.cpp.o.d"
+  "/root/repo/lib/VM/Profiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/ChromeTraceSerializerPosix.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/ChromeTraceSerializerPosix.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/ChromeTraceSerializerPosix.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/CodeCoverageProfiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/CodeCoverageProfiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/CodeCoverageProfiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/ExecutionProfiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/ExecutionProfiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/ExecutionProfiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/InlineCacheProfiler.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/InlineCacheProfiler.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/InlineCacheProfiler.cpp.o.d"
+  "/root/repo/lib/VM/Profiler/SamplingProfilerPosix.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/SamplingProfilerPosix.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Profiler/SamplingProfilerPosix.cpp.o.d"
+  "/root/repo/lib/VM/PropertyAccessor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PropertyAccessor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/PropertyAccessor.cpp.o.d"
+  "/root/repo/lib/VM/RegExpCache.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RegExpCache.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RegExpCache.cpp.o.d"
+  "/root/repo/lib/VM/Runtime-profilers.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Runtime-profilers.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Runtime-profilers.cpp.o.d"
+  "/root/repo/lib/VM/Runtime.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Runtime.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Runtime.cpp.o.d"
+  "/root/repo/lib/VM/RuntimeModule.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RuntimeModule.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RuntimeModule.cpp.o.d"
+  "/root/repo/lib/VM/RuntimeStats.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RuntimeStats.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/RuntimeStats.cpp.o.d"
+  "/root/repo/lib/VM/SegmentedArray.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SegmentedArray.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SegmentedArray.cpp.o.d"
+  "/root/repo/lib/VM/SerializedLiteralParser.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SerializedLiteralParser.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SerializedLiteralParser.cpp.o.d"
+  "/root/repo/lib/VM/Serializer.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Serializer.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/Serializer.cpp.o.d"
+  "/root/repo/lib/VM/SingleObject.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SingleObject.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SingleObject.cpp.o.d"
+  "/root/repo/lib/VM/StackFrame.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StackFrame.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StackFrame.cpp.o.d"
+  "/root/repo/lib/VM/StackTracesTree.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StackTracesTree.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StackTracesTree.cpp.o.d"
+  "/root/repo/lib/VM/StorageProvider.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StorageProvider.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StorageProvider.cpp.o.d"
+  "/root/repo/lib/VM/StringPrimitive.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringPrimitive.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringPrimitive.cpp.o.d"
+  "/root/repo/lib/VM/StringRefUtils.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringRefUtils.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringRefUtils.cpp.o.d"
+  "/root/repo/lib/VM/StringView.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringView.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/StringView.cpp.o.d"
+  "/root/repo/lib/VM/SymbolRegistry.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SymbolRegistry.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/SymbolRegistry.cpp.o.d"
+  "/root/repo/lib/VM/TimeLimitMonitor.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/TimeLimitMonitor.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/TimeLimitMonitor.cpp.o.d"
+  "/root/repo/lib/VM/TwineChar16.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/TwineChar16.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/TwineChar16.cpp.o.d"
+  "/root/repo/lib/VM/VTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/VTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/VTable.cpp.o.d"
+  "/root/repo/lib/VM/detail/IdentifierHashTable.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/detail/IdentifierHashTable.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/detail/IdentifierHashTable.cpp.o.d"
+  "/root/repo/lib/VM/gcs/AlignedHeapSegment.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/AlignedHeapSegment.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/AlignedHeapSegment.cpp.o.d"
+  "/root/repo/lib/VM/gcs/AlignedStorage.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/AlignedStorage.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/AlignedStorage.cpp.o.d"
+  "/root/repo/lib/VM/gcs/CardTableNC.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/CardTableNC.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/CardTableNC.cpp.o.d"
+  "/root/repo/lib/VM/gcs/FillerCell.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/FillerCell.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/FillerCell.cpp.o.d"
+  "/root/repo/lib/VM/gcs/HadesGC.cpp" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/HadesGC.cpp.o" "gcc" "lib/VM/CMakeFiles/hermesVMRuntime.dir/gcs/HadesGC.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/ADT/CMakeFiles/hermesADT.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Inst/CMakeFiles/hermesInst.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Parser/CMakeFiles/hermesParser.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/CMakeFiles/hermesPlatform.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Intl/CMakeFiles/hermesPlatformIntl.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/BCGen/HBC/CMakeFiles/hermesHBCBackend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/InternalBytecode/CMakeFiles/hermesInternalBytecode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/BCGen/CMakeFiles/hermesBackend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesFrontend.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/FrontEndDefs/CMakeFiles/hermesFrontEndDefs.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/CMakeFiles/hermesOptimizer.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/SourceMap/CMakeFiles/hermesSourceMap.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/AST/CMakeFiles/hermesAST.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,251 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesVMRuntime.dir/ArrayStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/ArrayStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/BasicBlockExecutionInfo.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/BasicBlockExecutionInfo.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/BoxedDouble.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/BoxedDouble.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/BuildMetadata.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/BuildMetadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Callable.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Callable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/CellKind.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/CellKind.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/CheckHeapWellFormedAcceptor.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/CheckHeapWellFormedAcceptor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/CodeBlock.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/CodeBlock.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Debugger/Debugger.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Debugger/Debugger.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/DecoratedObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/DecoratedObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Deserializer.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Deserializer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/DictPropertyMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/DictPropertyMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Domain.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Domain.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/DummyObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/DummyObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/GCBase.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/GCBase.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/GCCell.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/GCCell.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/HandleRootOwner.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/HandleRootOwner.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/HeapSnapshot.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/HeapSnapshot.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/HermesValue.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/HermesValue.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/HiddenClass.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/HiddenClass.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/HostModel.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/HostModel.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/IdentifierTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/IdentifierTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Interpreter-slowpaths.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Interpreter-slowpaths.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Interpreter.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Interpreter.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSCallableProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSCallableProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSDataView.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSDataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSDate.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSDate.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSError.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSError.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSGenerator.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSGenerator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Array.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Array.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayBuffer.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayBuffer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/ArrayIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/AsyncFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/AsyncFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Boolean.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Boolean.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DataView.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DataView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Date.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Date.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DateUtil.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DateUtil.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DebuggerInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/DebuggerInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Error.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Error.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Function.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Function.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorFunction.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorFunction.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GeneratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GlobalObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/GlobalObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/HermesBuiltin.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/HermesBuiltin.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/HermesInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/HermesInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Instrument.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Instrument.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Intl.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Intl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/IteratorPrototype.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/IteratorPrototype.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSLibInternal.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSLibInternal.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSON.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSON.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSONLexer.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/JSONLexer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Map.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Map.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Math.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Math.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Number.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Number.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Object.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Object.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Proxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Proxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Reflect.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Reflect.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeCommonStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeCommonStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeJSONUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/RuntimeJSONUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Set.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Set.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Sorting.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Sorting.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/String.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/String.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/StringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/StringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Symbol.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/Symbol.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/TypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/TypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/WeakMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/WeakMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/WeakSet.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/WeakSet.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/escape.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/escape.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/eval.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/eval.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/print.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/print.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/require.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSLib/require.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSNativeFunctions.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSNativeFunctions.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSProxy.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSProxy.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSRegExp.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSRegExp.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSRegExpStringIterator.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSRegExpStringIterator.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSTypedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSTypedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/JSWeakMapImpl.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/JSWeakMapImpl.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/LimitedStorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/LimitedStorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Metadata.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Metadata.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Operations.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Operations.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/OrderedHashMap.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/OrderedHashMap.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/PredefinedStringIDs.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/PredefinedStringIDs.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/PrimitiveBox.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/PrimitiveBox.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/ChromeTraceSerializerPosix.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/ChromeTraceSerializerPosix.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/CodeCoverageProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/CodeCoverageProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/ExecutionProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/ExecutionProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/InlineCacheProfiler.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/InlineCacheProfiler.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/SamplingProfilerPosix.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Profiler/SamplingProfilerPosix.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/PropertyAccessor.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/PropertyAccessor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/RegExpCache.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/RegExpCache.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Runtime-profilers.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Runtime-profilers.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Runtime.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Runtime.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/RuntimeModule.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/RuntimeModule.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/RuntimeStats.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/RuntimeStats.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/SegmentedArray.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/SegmentedArray.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/SerializedLiteralParser.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/SerializedLiteralParser.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/Serializer.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/Serializer.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/SingleObject.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/SingleObject.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StackFrame.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StackFrame.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StackTracesTree.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StackTracesTree.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StorageProvider.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StorageProvider.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StringPrimitive.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StringPrimitive.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StringRefUtils.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StringRefUtils.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/StringView.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/StringView.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/SymbolRegistry.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/SymbolRegistry.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/TimeLimitMonitor.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/TimeLimitMonitor.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/TwineChar16.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/TwineChar16.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/VTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/VTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/detail/IdentifierHashTable.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/detail/IdentifierHashTable.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/AlignedHeapSegment.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/AlignedHeapSegment.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/AlignedStorage.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/AlignedStorage.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/CardTableNC.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/CardTableNC.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/FillerCell.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/FillerCell.cpp.o.d"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/HadesGC.cpp.o"
+  "CMakeFiles/hermesVMRuntime.dir/gcs/HadesGC.cpp.o.d"
+  "libhermesVMRuntime.a"
+  "libhermesVMRuntime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesVMRuntime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
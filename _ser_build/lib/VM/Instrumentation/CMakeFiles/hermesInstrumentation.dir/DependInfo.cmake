@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/VM/Instrumentation/PerfEventsLinux.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/PerfEventsLinux.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/PerfEventsLinux.cpp.o.d"
+  "/root/repo/lib/VM/Instrumentation/ProcessStats.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/ProcessStats.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/ProcessStats.cpp.o.d"
+  "/root/repo/lib/VM/Instrumentation/StatSamplingThread.cpp" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/StatSamplingThread.cpp.o" "gcc" "lib/VM/Instrumentation/CMakeFiles/hermesInstrumentation.dir/StatSamplingThread.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
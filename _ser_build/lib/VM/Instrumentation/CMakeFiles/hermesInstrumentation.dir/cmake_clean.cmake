@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesInstrumentation.dir/PerfEventsLinux.cpp.o"
+  "CMakeFiles/hermesInstrumentation.dir/PerfEventsLinux.cpp.o.d"
+  "CMakeFiles/hermesInstrumentation.dir/ProcessStats.cpp.o"
+  "CMakeFiles/hermesInstrumentation.dir/ProcessStats.cpp.o.d"
+  "CMakeFiles/hermesInstrumentation.dir/StatSamplingThread.cpp.o"
+  "CMakeFiles/hermesInstrumentation.dir/StatSamplingThread.cpp.o.d"
+  "libhermesInstrumentation.a"
+  "libhermesInstrumentation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesInstrumentation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
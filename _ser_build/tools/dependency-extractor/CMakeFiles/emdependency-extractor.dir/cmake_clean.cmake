@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/emdependency-extractor"
+  "../../bin/emdependency-extractor.pdb"
+  "CMakeFiles/emdependency-extractor.dir/emdependency-extractor.cpp.o"
+  "CMakeFiles/emdependency-extractor.dir/emdependency-extractor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/emdependency-extractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// This file is processed by CMake.
+// See https://cmake.org/cmake/help/v3.0/command/configure_file.html.
+
+#ifndef REPLCONFIG_H
+#define REPLCONFIG_H
+
+/*
+ * These values are automatically set according to their cmake variables.
+ */
+#define HAVE_LIBREADLINE 1
+
+#endif // REPLCONFIG_H
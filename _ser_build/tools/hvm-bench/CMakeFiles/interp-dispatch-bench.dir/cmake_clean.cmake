@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/interp-dispatch-bench"
+  "../../bin/interp-dispatch-bench.pdb"
+  "CMakeFiles/interp-dispatch-bench.dir/interp-dispatch-bench.cpp.o"
+  "CMakeFiles/interp-dispatch-bench.dir/interp-dispatch-bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interp-dispatch-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
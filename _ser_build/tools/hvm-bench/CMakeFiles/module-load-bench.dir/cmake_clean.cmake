@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/module-load-bench"
+  "../../bin/module-load-bench.pdb"
+  "CMakeFiles/module-load-bench.dir/module-load-bench.cpp.o"
+  "CMakeFiles/module-load-bench.dir/module-load-bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/module-load-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/hermes-jsi"
+  "../../bin/hermes-jsi.pdb"
+  "CMakeFiles/hermes-jsi.dir/jsi.cpp.o"
+  "CMakeFiles/hermes-jsi.dir/jsi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermes-jsi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
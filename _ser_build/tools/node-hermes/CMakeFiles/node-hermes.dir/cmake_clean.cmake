@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/node-hermes"
+  "../../bin/node-hermes.pdb"
+  "CMakeFiles/node-hermes.dir/node-hermes.cpp.o"
+  "CMakeFiles/node-hermes.dir/node-hermes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/node-hermes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hermesNodeBytecode.dir/NodeBytecode.cpp.o"
+  "CMakeFiles/hermesNodeBytecode.dir/NodeBytecode.cpp.o.d"
+  "NodeBytecode.hbc"
+  "NodeBytecode.inc"
+  "WrappedNode.js"
+  "libhermesNodeBytecode.a"
+  "libhermesNodeBytecode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hermesNodeBytecode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
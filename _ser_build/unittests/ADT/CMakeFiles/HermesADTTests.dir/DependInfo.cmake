@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unittests/ADT/BitArrayTest.cpp" "unittests/ADT/CMakeFiles/HermesADTTests.dir/BitArrayTest.cpp.o" "gcc" "unittests/ADT/CMakeFiles/HermesADTTests.dir/BitArrayTest.cpp.o.d"
+  "/root/repo/unittests/ADT/CompactArrayTest.cpp" "unittests/ADT/CMakeFiles/HermesADTTests.dir/CompactArrayTest.cpp.o" "gcc" "unittests/ADT/CMakeFiles/HermesADTTests.dir/CompactArrayTest.cpp.o.d"
+  "/root/repo/unittests/ADT/ConsumableRangeTest.cpp" "unittests/ADT/CMakeFiles/HermesADTTests.dir/ConsumableRangeTest.cpp.o" "gcc" "unittests/ADT/CMakeFiles/HermesADTTests.dir/ConsumableRangeTest.cpp.o.d"
+  "/root/repo/unittests/ADT/ScopedHashTable.cpp" "unittests/ADT/CMakeFiles/HermesADTTests.dir/ScopedHashTable.cpp.o" "gcc" "unittests/ADT/CMakeFiles/HermesADTTests.dir/ScopedHashTable.cpp.o.d"
+  "/root/repo/unittests/ADT/WordBitSet.cpp" "unittests/ADT/CMakeFiles/HermesADTTests.dir/WordBitSet.cpp.o" "gcc" "unittests/ADT/CMakeFiles/HermesADTTests.dir/WordBitSet.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ser_build/external/llvh/utils/unittest/UnitTestMain/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/utils/unittest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Support/CMakeFiles/LLVHSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/ADT/CMakeFiles/hermesADT.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Support/CMakeFiles/hermesSupport.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/dtoa/CMakeFiles/dtoa.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Regex/CMakeFiles/hermesRegex.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/lib/Platform/Unicode/CMakeFiles/hermesPlatformUnicode.dir/DependInfo.cmake"
+  "/root/repo/_ser_build/external/llvh/lib/Demangle/CMakeFiles/LLVHDemangle.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
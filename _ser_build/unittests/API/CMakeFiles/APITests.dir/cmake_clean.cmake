@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "APITests"
+  "APITests.pdb"
+  "CMakeFiles/APITests.dir/APILeanTest.cpp.o"
+  "CMakeFiles/APITests.dir/APILeanTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/APITest.cpp.o"
+  "CMakeFiles/APITests.dir/APITest.cpp.o.d"
+  "CMakeFiles/APITests.dir/APITestFactory.cpp.o"
+  "CMakeFiles/APITests.dir/APITestFactory.cpp.o.d"
+  "CMakeFiles/APITests.dir/DebuggerTest.cpp.o"
+  "CMakeFiles/APITests.dir/DebuggerTest.cpp.o.d"
+  "CMakeFiles/APITests.dir/SegmentTest.cpp.o"
+  "CMakeFiles/APITests.dir/SegmentTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/APITests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SegmentTestCompile.dir/SegmentTestCompile.cpp.o"
+  "CMakeFiles/SegmentTestCompile.dir/SegmentTestCompile.cpp.o.d"
+  "libSegmentTestCompile.a"
+  "libSegmentTestCompile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SegmentTestCompile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesASTTests.dir/ESTreeTest.cpp.o"
+  "CMakeFiles/HermesASTTests.dir/ESTreeTest.cpp.o.d"
+  "CMakeFiles/HermesASTTests.dir/JSONTest.cpp.o"
+  "CMakeFiles/HermesASTTests.dir/JSONTest.cpp.o.d"
+  "CMakeFiles/HermesASTTests.dir/ValidatorTest.cpp.o"
+  "CMakeFiles/HermesASTTests.dir/ValidatorTest.cpp.o.d"
+  "HermesASTTests"
+  "HermesASTTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesASTTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
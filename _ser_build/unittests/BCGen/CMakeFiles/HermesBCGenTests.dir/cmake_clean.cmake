@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesBCGenTests.dir/BytecodeFileFormatTest.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/BytecodeFileFormatTest.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/BytecodeFormConverterTest.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/BytecodeFormConverterTest.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/DebugInfo.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/DebugInfo.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/HBC.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/HBC.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/RATest.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/RATest.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/SupportTest.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/SupportTest.cpp.o.d"
+  "CMakeFiles/HermesBCGenTests.dir/TestHelpers.cpp.o"
+  "CMakeFiles/HermesBCGenTests.dir/TestHelpers.cpp.o.d"
+  "HermesBCGenTests"
+  "HermesBCGenTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesBCGenTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
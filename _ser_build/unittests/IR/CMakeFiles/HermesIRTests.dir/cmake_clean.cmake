@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesIRTests.dir/BasicBlockTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/BasicBlockTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/BuilderTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/BuilderTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/IRUtilsTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/IRUtilsTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/IRVerifierTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/IRVerifierTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/InstrTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/InstrTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/LoopAnalysisTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/LoopAnalysisTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/ScopeAnalysisTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/ScopeAnalysisTest.cpp.o.d"
+  "CMakeFiles/HermesIRTests.dir/ScopeChainTest.cpp.o"
+  "CMakeFiles/HermesIRTests.dir/ScopeChainTest.cpp.o.d"
+  "HermesIRTests"
+  "HermesIRTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesIRTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,141 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HermesVMRuntimeTests.dir/AlignedHeapSegmentTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/AlignedHeapSegmentTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/AlignedStorageTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/AlignedStorageTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ArrayStorageTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ArrayStorageTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ArrayTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ArrayTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/BytecodeProviderTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/BytecodeProviderTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CallResultTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CallResultTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CardObjectBoundaryNCTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CardObjectBoundaryNCTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CardTableNCTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CardTableNCTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CastingTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CastingTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CodeCoverageProfilerTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CodeCoverageProfilerTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CopyableVectorTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CopyableVectorTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CrashManagerTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/CrashManagerTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DateUtilTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DateUtilTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DecoratedObjectTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DecoratedObjectTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DictPropertyMapTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/DictPropertyMapTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ExternalMemAccountingTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ExternalMemAccountingTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCBasicsTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCBasicsTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCFinalizerTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCFinalizerTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCFragmentationTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCFragmentationTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCGuardPageNCTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCGuardPageNCTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCInitTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCInitTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCLazySegmentNCTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCLazySegmentNCTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCMarkWeakTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCMarkWeakTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCOOMTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCOOMTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCObjectIterationTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCObjectIterationTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCReturnUnusedMemoryTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCReturnUnusedMemoryTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSanitizeHandlesTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSanitizeHandlesTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSegmentAddressIndexTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSegmentAddressIndexTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSegmentRangeTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSegmentRangeTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSizingTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/GCSizingTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HandleTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HandleTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HeapSnapshotTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HeapSnapshotTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HermesValueTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HermesValueTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HiddenClassTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/HiddenClassTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/IRInstrumentationTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/IRInstrumentationTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/IdentifierTableTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/IdentifierTableTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InstrumentationAPITest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InstrumentationAPITest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InternalPropertiesTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InternalPropertiesTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InterpreterTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/InterpreterTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/JSLibTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/JSLibTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/MarkBitArrayNCTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/MarkBitArrayNCTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/MetadataTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/MetadataTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/NativeFrameTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/NativeFrameTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/NativeFunctionTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/NativeFunctionTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ObjectBufferTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ObjectBufferTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ObjectModelTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/ObjectModelTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/OperationsTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/OperationsTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/PredefinedStringsTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/PredefinedStringsTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/RegExpCacheTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/RegExpCacheTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/RuntimeConfigTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/RuntimeConfigTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SamplingHeapProfilerTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SamplingHeapProfilerTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SegmentedArrayTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SegmentedArrayTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SerializerTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SerializerTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SmallHermesValueTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SmallHermesValueTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SmallXStringTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SmallXStringTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StackTracesTreeTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StackTracesTreeTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StaticBuiltinsTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StaticBuiltinsTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StorageProviderTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StorageProviderTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringBuilderTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringBuilderTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringPrimitiveTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringPrimitiveTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringViewTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/StringViewTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SymbolIDTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/SymbolIDTest.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers1.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TestHelpers1.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TwineChar16Test.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/TwineChar16Test.cpp.o.d"
+  "CMakeFiles/HermesVMRuntimeTests.dir/WeakValueMapTest.cpp.o"
+  "CMakeFiles/HermesVMRuntimeTests.dir/WeakValueMapTest.cpp.o.d"
+  "HermesVMRuntimeTests"
+  "HermesVMRuntimeTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HermesVMRuntimeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DtoaTests.dir/DtoaTest.cpp.o"
+  "CMakeFiles/DtoaTests.dir/DtoaTest.cpp.o.d"
+  "DtoaTests"
+  "DtoaTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DtoaTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -19,6 +19,8 @@ namespace hbc {
 class BackendContext;
 }
 
+class ExecutionProfile;
+
 struct CodeGenerationSettings {
   /// Whether we should emit TDZ checks.
   bool enableTDZ{true};
@@ -48,6 +50,11 @@ struct OptimizationSettings {
   /// Enable any inlining of functions.
   bool inlining{true};
 
+  /// The maximum number of instructions of a function that is inlined into
+  /// several call sites. Functions called from a single site are inlined
+  /// regardless of their size.
+  unsigned inlineThreshold{8};
+
   /// Enable IR outlining.
   bool outlining{false};
 
@@ -60,6 +67,10 @@ struct OptimizationSettings {
 
   /// Attempt to resolve CommonJS require() calls at compile time.
   bool staticRequire{false};
+
+  /// The number of threads on which function-local passes may run on
+  /// different functions at the same time.
+  unsigned numThreads{1};
 };
 
 enum class DebugInfoSetting {
@@ -194,6 +205,11 @@ class Context {
   /// on its destructor.
   std::shared_ptr<hbc::BackendContext> hbcBackendContext_{};
 
+  /// Execution counts of a previous run of the program, which guide
+  /// optimization, or null. We use a shared pointer to avoid any dependencies
+  /// on its destructor.
+  std::shared_ptr<const ExecutionProfile> executionProfile_{};
+
  public:
   explicit Context(
       SourceErrorManager &sm,
@@ -407,6 +423,15 @@ class Context {
       std::shared_ptr<hbc::BackendContext> hbcBackendContext) {
     hbcBackendContext_ = std::move(hbcBackendContext);
   }
+
+  const ExecutionProfile *getExecutionProfile() const {
+    return executionProfile_.get();
+  }
+
+  void setExecutionProfile(
+      std::shared_ptr<const ExecutionProfile> executionProfile) {
+    executionProfile_ = std::move(executionProfile);
+  }
 };
 
 } // namespace hermes
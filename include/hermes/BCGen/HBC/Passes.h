@@ -35,6 +35,9 @@ class LoadConstants : public FunctionPass {
   ~LoadConstants() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 
  private:
   bool const optimizationEnabled_;
@@ -45,6 +48,9 @@ class LoadParameters : public FunctionPass {
   explicit LoadParameters() : FunctionPass("LoadParameters") {}
   ~LoadParameters() override = default;
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 /// Lower LoadFrameInst, StoreFrameInst and CreateFunctionInst.
@@ -20,6 +20,9 @@ class FuncCallNOpts : public FunctionPass {
   ~FuncCallNOpts() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 } // namespace hermes
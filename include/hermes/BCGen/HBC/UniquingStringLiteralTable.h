@@ -99,11 +99,15 @@ class UniquingStringLiteralAccumulator final : public StringLiteralIDMapping {
 
   /// \return a StringLiteralTable with the same strings as the accumulator
   /// \p strings.  If \p optimize is set, attempt to pack the strings to
-  /// reduce the size taken up by the character buffer.  The mapping from ID
-  /// to String is not preserved between \p strings and the resulting table.
+  /// reduce the size taken up by the character buffer.  If
+  /// \p keepInsertionOrder is set, strings that are referenced as identifiers
+  /// equally often are ordered by when they were added rather than
+  /// alphabetically.  The mapping from ID to String is not preserved between
+  /// \p strings and the resulting table.
   static StringLiteralTable toTable(
       UniquingStringLiteralAccumulator strings,
-      bool optimize = false);
+      bool optimize = false,
+      bool keepInsertionOrder = false);
 };
 
 inline size_t StringLiteralIDMapping::count() const {
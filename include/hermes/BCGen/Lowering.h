@@ -46,6 +46,9 @@ class LowerAllocObject : public FunctionPass {
   ~LowerAllocObject() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 
  private:
   /// Perform a series of lowerings for a given allocInst.
@@ -131,6 +134,9 @@ class LowerCondBranch : public FunctionPass {
   explicit LowerCondBranch() : FunctionPass("LowerCondBranch") {}
   ~LowerCondBranch() override = default;
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 
  private:
   /// \return whether the given binary operator can be lowered to a conditional
@@ -307,7 +307,9 @@ class RegisterAllocator {
   void calculateLiveIntervals(ArrayRef<BasicBlock *> order);
 
   /// Coalesce registers by merging the live intervals of multiple instructions
-  /// together to take advantage of holes. Updates \p map with mapping between
+  /// together to take advantage of holes. MOVs and loads from stack locations
+  /// are merged with the value they copy when the intervals don't intersect,
+  /// so that no copy is emitted. Updates \p map with mapping between
   /// the coalesced interval and the interval it was merged into and the
   /// register that it will adopt.
   /// The order of the basic blocks is passed in \p order.
@@ -383,7 +385,8 @@ class RegisterAllocator {
 
   /// Allocate the registers for the instructions in the function. The order of
   /// the block needs to match the order which we'll use for instruction
-  /// selection.
+  /// selection. An instruction may use the register of another one whose live
+  /// interval has a hole where the instruction's interval lives.
   void allocate(ArrayRef<BasicBlock *> order);
 
   /// Reserves consecutive registers that will be manually managed by the user.
@@ -148,6 +148,10 @@ struct ExecuteOptions {
   /// Run the sampling profiler.
   bool sampleProfiling{false};
 
+  /// If not empty, the file to write execution counts to for profile guided
+  /// optimization.
+  std::string profileGenerateFile;
+
 #ifdef HERMESVM_SERIALIZE
   /// Serialize VM state after global object initialization to file.
   std::string SerializeAfterInitFile;
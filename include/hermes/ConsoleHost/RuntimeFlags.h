@@ -103,6 +103,11 @@ static opt<bool> SampleProfiling(
     desc("Enable sampling profiler"),
     cat(RuntimeCategory));
 
+static opt<std::string> ProfileGenerate(
+    "profile-generate",
+    desc("Write the execution counts used by hermesc -profile-use to a file"),
+    cat(RuntimeCategory));
+
 #ifdef HERMESVM_SERIALIZE
 static opt<std::string> SerializeAfterInitFile(
     "serialize-after-init-file",
@@ -163,6 +168,12 @@ static opt<bool> Intl(
     init(RuntimeConfig::getDefaultIntl()),
     cat(RuntimeCategory));
 
+static opt<bool> RegExpJIT(
+    "Xregexp-jit",
+    desc("Compile regular expressions to native code where supported"),
+    init(RuntimeConfig::getDefaultEnableRegExpJIT()),
+    cat(RuntimeCategory));
+
 static llvh::cl::opt<bool> StopAfterInit(
     "stop-after-module-init",
     llvh::cl::desc("Exit once module loading is finished. Useful "
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_IR_EXECUTIONPROFILE_H
+#define HERMES_IR_EXECUTIONPROFILE_H
+
+#include "hermes/Support/SourceErrorManager.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/ADT/StringMap.h"
+#include "llvh/Support/MemoryBuffer.h"
+
+#include <memory>
+#include <vector>
+
+namespace hermes {
+
+class Function;
+
+/// Execution counts collected by running a program with
+/// hermes -profile-generate, which guide the optimization of the program when
+/// it is compiled again with -profile-use. See vm::ExecutionProfiler for the
+/// format. Functions are matched by the location where they start.
+class ExecutionProfile {
+ public:
+  /// The counts of a single function.
+  struct FunctionProfile {
+    /// Number of calls.
+    uint64_t calls{0};
+    /// Position of the function in the order in which the functions were first
+    /// called, or 0 if it was never called.
+    uint64_t firstExecution{0};
+    /// Execution counts of the basic blocks, in the order of the function's
+    /// block list when the profiled bytecode was generated.
+    std::vector<uint64_t> blockCounts{};
+  };
+
+  /// Parse the profile \p profile.
+  /// On failure, reports an error to \p sm and returns nullptr.
+  static std::unique_ptr<ExecutionProfile> parse(
+      llvh::MemoryBufferRef profile,
+      SourceErrorManager &sm);
+
+  /// \return the counts of \p F, or nullptr if \p F is not in the profile.
+  const FunctionProfile *getFunctionProfile(Function *F) const;
+
+  /// \return the execution counts of the basic blocks of \p F, indexed by
+  ///   their position in its block list, or an empty array if they are not
+  ///   known or the function no longer has the same number of blocks.
+  llvh::ArrayRef<uint64_t> getBlockCounts(Function *F) const;
+
+  /// \return true if \p F is in the profile and was never called.
+  bool isCold(Function *F) const {
+    const FunctionProfile *profile = getFunctionProfile(F);
+    return profile && profile->calls == 0;
+  }
+
+  /// \return true if \p F is among the functions that account for most of the
+  ///   calls in the profile.
+  bool isHot(Function *F) const {
+    const FunctionProfile *profile = getFunctionProfile(F);
+    return profile && profile->calls >= hotCallCount_;
+  }
+
+ private:
+  /// The counts of each function, keyed by "line:column", or "global" for the
+  /// global function.
+  llvh::StringMap<FunctionProfile> functions_{};
+
+  /// The smallest number of calls of a hot function.
+  uint64_t hotCallCount_{UINT64_MAX};
+};
+
+} // namespace hermes
+
+#endif // HERMES_IR_EXECUTIONPROFILE_H
@@ -30,6 +30,7 @@
 #include "llvh/Support/raw_ostream.h"
 
 #include <deque>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -366,6 +367,25 @@ struct LazySource {
 };
 #endif
 
+/// While an instance of this class exists, changes to use lists and operand
+/// lists, and the creation of literals and identifiers, are serialized by a
+/// global lock. This allows different functions of a module to be transformed
+/// on different threads: literals, variables and functions are shared by all
+/// the functions of a module, and so are their use lists.
+class ConcurrentIRScope {
+ public:
+  ConcurrentIRScope();
+  ~ConcurrentIRScope();
+
+  ConcurrentIRScope(const ConcurrentIRScope &) = delete;
+  void operator=(const ConcurrentIRScope &) = delete;
+
+  /// \return a lock on the global lock if a ConcurrentIRScope exists, or an
+  ///   empty lock otherwise. Code that changes other state shared by all the
+  ///   functions of a module, such as the string table, takes this lock.
+  static std::unique_lock<std::mutex> lock();
+};
+
 class Value {
  public:
   using UseListTy = llvh::SmallVector<Instruction *, 2>;
@@ -1086,9 +1086,7 @@ class LoadPropertyInst : public Instruction {
       llvh::ArrayRef<Value *> operands)
       : Instruction(src, operands) {}
 
-  SideEffectKind getSideEffect() {
-    return SideEffectKind::Unknown;
-  }
+  SideEffectKind getSideEffect();
 
   WordBitSet<> getChangedOperandsImpl() {
     return {};
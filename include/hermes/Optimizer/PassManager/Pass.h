@@ -64,6 +64,15 @@ class FunctionPass : public Pass {
   /// \returns true if the function was modified.
   virtual bool runOnFunction(Function *F) = 0;
 
+  /// \return true if the pass only reads and writes the function it runs on,
+  /// and so may run on several functions of a module at the same time. Such a
+  /// pass may still create literals and change the use lists of values shared
+  /// by the whole module, but must not depend on the order of those use lists
+  /// or look into other functions.
+  virtual bool isFunctionLocal() const {
+    return false;
+  }
+
   static bool classof(const Pass *S) {
     return S->getKind() == PassKind::Function;
   }
@@ -8,7 +8,9 @@
 #ifndef HERMES_OPTIMIZER_PASSMANAGER_PASSMANAGER_H
 #define HERMES_OPTIMIZER_PASSMANAGER_PASSMANAGER_H
 
+#include "hermes/IR/IR.h"
 #include "hermes/Optimizer/PassManager/Pass.h"
+#include "hermes/Support/ParallelFor.h"
 #include "hermes/Support/Statistic.h"
 #include "hermes/Support/Timer.h"
 
@@ -124,8 +126,43 @@ class PassManager {
       lastPass = newPass;
     };
 
+    // Consecutive function-local passes are run on several functions at once
+    // when there are threads to spare. Dumping the IR between passes needs
+    // every pass to finish on the whole module before the next one starts.
+    unsigned numThreads =
+        M->getContext().getCodeGenerationSettings().dumpIRBetweenPasses
+        ? 1
+        : M->getContext().getOptimizationSettings().numThreads;
+
     // For each pass:
-    for (auto *P : pipeline) {
+    for (size_t i = 0, e = pipeline.size(); i < e;) {
+      Pass *P = pipeline[i];
+
+      /// Handle groups of function-local passes:
+      size_t groupEnd = i;
+      if (numThreads > 1) {
+        while (groupEnd < e && isFunctionLocal(pipeline[groupEnd]))
+          ++groupEnd;
+      }
+      if (groupEnd != i) {
+        std::string groupName = P->getName();
+        for (size_t j = i + 1; j < groupEnd; ++j)
+          groupName += ", " + pipeline[j]->getName().str();
+
+        TimeRegion timeRegion(
+            timerGroup ? timers.emplace_back("", groupName, *timerGroup),
+            &timers.back()
+                       : nullptr);
+
+        LLVM_DEBUG(
+            dbgs() << "Running the function passes " << groupName << " on "
+                   << numThreads << " threads\n");
+        runFunctionLocalPasses(M, i, groupEnd, numThreads);
+        i = groupEnd;
+        continue;
+      }
+
+      ++i;
       dumpLastPass(P);
 
       TimeRegion timeRegion(
@@ -165,6 +202,37 @@ class PassManager {
     }
     dumpLastPass(nullptr);
   }
+
+ private:
+  /// \return true if \p P is a function pass that may run on several functions
+  /// at the same time.
+  static bool isFunctionLocal(Pass *P) {
+    auto *FP = llvh::dyn_cast<FunctionPass>(P);
+    return FP && FP->isFunctionLocal();
+  }
+
+  /// Run the function-local passes in the pipeline range [begin, end) on every
+  /// function of \p M, on up to \p numThreads threads. Each function goes
+  /// through all the passes of the range on a single thread, so the passes
+  /// see the same IR as when they are run one after the other on the whole
+  /// module.
+  void runFunctionLocalPasses(
+      Module *M,
+      size_t begin,
+      size_t end,
+      unsigned numThreads) {
+    std::vector<Function *> functions;
+    for (auto &F : *M) {
+      if (!F.isLazy())
+        functions.push_back(&F);
+    }
+
+    ConcurrentIRScope concurrentIR{};
+    parallelFor(functions.size(), numThreads, [&](size_t idx) {
+      for (size_t j = begin; j < end; ++j)
+        llvh::cast<FunctionPass>(pipeline[j])->runOnFunction(functions[idx]);
+    });
+  }
 };
 } // namespace hermes
 #undef DEBUG_TYPE
@@ -20,6 +20,9 @@ class CSE : public FunctionPass {
   ~CSE() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 } // namespace hermes
@@ -21,6 +21,9 @@ class CodeMotion : public FunctionPass {
   ~CodeMotion() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 } // namespace hermes
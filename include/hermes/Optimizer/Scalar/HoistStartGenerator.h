@@ -23,6 +23,9 @@ class HoistStartGenerator : public FunctionPass {
   ~HoistStartGenerator() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 } // namespace hermes
@@ -13,7 +13,8 @@
 
 namespace hermes {
 
-/// Inline single use functions.
+/// Inline functions called from a single site, and small functions called from
+/// several sites.
 class Inlining : public ModulePass {
  public:
   explicit Inlining() : hermes::ModulePass("Inlining") {}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_OPTIMIZER_SCALAR_SCCP_H
+#define HERMES_OPTIMIZER_SCALAR_SCCP_H
+
+#include "hermes/IR/IR.h"
+#include "hermes/Optimizer/PassManager/Pass.h"
+
+namespace hermes {
+
+/// Sparse conditional constant propagation. Propagates constants through
+/// phis and arithmetic while only following the branches that can be taken,
+/// then folds the branches whose condition is constant.
+class SCCP : public FunctionPass {
+ public:
+  explicit SCCP() : FunctionPass("SCCP") {}
+  ~SCCP() override = default;
+
+  bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
+};
+
+} // namespace hermes
+
+#endif // HERMES_OPTIMIZER_SCALAR_SCCP_H
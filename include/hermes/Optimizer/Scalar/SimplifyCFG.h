@@ -19,6 +19,9 @@ class SimplifyCFG : public FunctionPass {
   ~SimplifyCFG() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 } // namespace hermes
 
@@ -20,6 +20,9 @@ class TDZDedup : public FunctionPass {
   ~TDZDedup() override = default;
 
   bool runOnFunction(Function *F) override;
+  bool isFunctionLocal() const override {
+    return true;
+  }
 };
 
 } // namespace hermes
@@ -16,6 +16,8 @@
 namespace hermes {
 namespace regex {
 
+class JITCompiledRegex;
+
 /// The result of trying to find a match.
 enum class MatchRuntimeResult {
   /// Match found.
@@ -35,6 +37,12 @@ constexpr uint32_t kNotMatched = UINT32_MAX;
 /// The maximum number of times we will backtrack.
 constexpr uint32_t kBacktrackLimit = 1u << 30;
 
+/// For regexes that can be executed without backtracking, the number of times
+/// we will backtrack per code unit of input, and the minimum number regardless
+/// of the input length, before switching to the non-backtracking executor.
+constexpr uint32_t kFallbackBacktracksPerCodeUnit = 32;
+constexpr uint32_t kMinFallbackBacktracks = 1u << 16;
+
 /// A CapturedRange represents a range of the input string captured by a capture
 /// group. A CaptureGroup may also not have matched, in which case its start is
 /// set to kNotMatched. Note that an unmatched capture group is different than a
@@ -59,6 +67,8 @@ struct CapturedRange {
 /// groups.
 /// \return true if some portion of the string matched the regex represented by
 /// the bytecode, false otherwise.
+/// If \p jit is not null, it is native code compiled from the same bytecode,
+/// which is used to perform the search where possible.
 /// This is the char16_t overload.
 MatchRuntimeResult searchWithBytecode(
     llvh::ArrayRef<uint8_t> bytecode,
@@ -66,7 +76,8 @@ MatchRuntimeResult searchWithBytecode(
     uint32_t start,
     uint32_t length,
     std::vector<CapturedRange> *captures,
-    constants::MatchFlagType matchFlags);
+    constants::MatchFlagType matchFlags,
+    const JITCompiledRegex *jit = nullptr);
 
 /// This is the ASCII overload.
 MatchRuntimeResult searchWithBytecode(
@@ -75,7 +86,8 @@ MatchRuntimeResult searchWithBytecode(
     uint32_t start,
     uint32_t length,
     std::vector<CapturedRange> *captures,
-    constants::MatchFlagType matchFlags);
+    constants::MatchFlagType matchFlags,
+    const JITCompiledRegex *jit = nullptr);
 
 } // namespace regex
 } // namespace hermes
@@ -25,6 +25,7 @@
 #include "hermes/Regex/RegexNode.h"
 #include "hermes/Regex/RegexTypes.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -132,6 +133,10 @@ class Regex {
         static_cast<uint16_t>(loopCount_),
         flags_.toByte(),
         matchConstraints_};
+    computePrefilter(&header);
+    // The non-backtracking executor steps through the input one code unit at a
+    // time, so it does not support surrogate pair decoding.
+    header.backtrackFree = !flags_.unicode && Node::isBacktrackFreeList(nodes_);
     RegexBytecodeStream bcs(header);
     Node::compile(nodes_, bcs);
     return bcs.acquireBytecode();
@@ -188,6 +193,35 @@ class Regex {
   }
 
  private:
+  /// Populate the prefilter fields of \p header, which let the executor skip
+  /// start positions that cannot begin a match. A literal prefix is preferred,
+  /// since it rules out more positions; otherwise use a small set of possible
+  /// first code units.
+  void computePrefilter(RegexBytecodeHeader *header) const {
+    constexpr size_t kMax = RegexBytecodeHeader::kMaxPrefilterChars;
+    header->prefixLength = 0;
+    header->firstCharCount = 0;
+    std::fill_n(header->prefilterChars, kMax, 0);
+
+    Node::CodePointList chars;
+    Node::literalPrefixForList(nodes_, &chars);
+    if (chars.size() >= 2) {
+      header->prefixLength = std::min(chars.size(), kMax);
+      std::copy_n(chars.begin(), header->prefixLength, header->prefilterChars);
+      return;
+    }
+
+    chars.clear();
+    if (Node::firstCharsForList(nodes_, &chars) != Node::FirstChars::Known)
+      return;
+    std::sort(chars.begin(), chars.end());
+    chars.erase(std::unique(chars.begin(), chars.end()), chars.end());
+    if (chars.empty() || chars.size() > kMax)
+      return;
+    header->firstCharCount = chars.size();
+    std::copy(chars.begin(), chars.end(), header->prefilterChars);
+  }
+
   template <class ForwardIterator>
   constants::ErrorType parse(ForwardIterator first, ForwardIterator last);
 
@@ -258,6 +258,9 @@ struct Width1LoopInsn : public Insn {
 
 /// A header that appears at the beginning of a bytecode stream.
 struct RegexBytecodeHeader {
+  /// Maximum number of code units in prefilterChars.
+  static constexpr uint32_t kMaxPrefilterChars = 8;
+
   /// Number of capture groups.
   uint16_t markedCount;
 
@@ -269,6 +272,22 @@ struct RegexBytecodeHeader {
 
   /// Constraints on what strings can match this regex.
   MatchConstraintSet constraints;
+
+  /// If nonzero, every match begins with the first prefixLength code units of
+  /// prefilterChars.
+  uint8_t prefixLength;
+
+  /// If nonzero, every match begins with one of the first firstCharCount code
+  /// units of prefilterChars. Always zero if prefixLength is nonzero.
+  uint8_t firstCharCount;
+
+  /// Code units used by the executor to skip start positions that cannot
+  /// begin a match, as described by prefixLength and firstCharCount.
+  char16_t prefilterChars[kMaxPrefilterChars];
+
+  /// If nonzero, the regex may be executed by the non-backtracking executor,
+  /// in time linear in the input length. See Node::isBacktrackFree().
+  uint8_t backtrackFree;
 };
 
 LLVM_PACKED_END;
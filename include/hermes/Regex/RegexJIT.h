@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_REGEX_REGEXJIT_H
+#define HERMES_REGEX_REGEXJIT_H
+
+#include "hermes/Regex/Executor.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/Support/Memory.h"
+
+#include <memory>
+
+// This file contains a compiler from regex bytecode to native code.
+
+/// The regex JIT generates x86-64 code for the System V calling convention.
+#if defined(__x86_64__) && !defined(_WIN32)
+#define HERMES_REGEX_JIT 1
+#endif
+
+namespace hermes {
+namespace regex {
+
+/// Native code compiled from regex bytecode.
+///
+/// Only regexes whose bytecode is a straight line of character matches,
+/// brackets, width 1 loops, anchors, word boundaries and capture groups are
+/// compiled; the backtracking these need is confined to the width 1 loops,
+/// each of which keeps its position in a fixed stack slot. Regexes with
+/// alternations, general loops, backreferences, lookarounds, or the ignoreCase
+/// or unicode flags are left to the interpreter.
+class JITCompiledRegex {
+ public:
+  /// The outcome of a search with compiled code.
+  enum class Result {
+    Match,
+    NoMatch,
+    /// The search could not be completed by the compiled code, and must be
+    /// repeated by the interpreter.
+    Fallback,
+  };
+
+  /// Compile \p bytecode to native code.
+  /// \return the compiled regex, or nullptr if the bytecode uses features the
+  ///   compiler does not support, or the JIT is not available on this
+  ///   platform.
+  static std::unique_ptr<JITCompiledRegex> compile(
+      llvh::ArrayRef<uint8_t> bytecode);
+
+  JITCompiledRegex(const JITCompiledRegex &) = delete;
+  void operator=(const JITCompiledRegex &) = delete;
+
+  /// Search the string \p first of length \p length for a match beginning at
+  /// \p start or later, or only at \p start if \p onlyAtStart is set.
+  /// On a match, \p captures is populated as by searchWithBytecode().
+  Result search(
+      const char *first,
+      uint32_t start,
+      uint32_t length,
+      bool onlyAtStart,
+      constants::MatchFlagType matchFlags,
+      std::vector<CapturedRange> *captures) const;
+
+  /// This is the char16_t overload.
+  Result search(
+      const char16_t *first,
+      uint32_t start,
+      uint32_t length,
+      bool onlyAtStart,
+      constants::MatchFlagType matchFlags,
+      std::vector<CapturedRange> *captures) const;
+
+  /// \return the size of the generated code in bytes.
+  size_t codeSize() const {
+    return codeSize_;
+  }
+
+  /// The signature of the generated code. The match is searched for in
+  /// [start, end), where first is the beginning of the string. The total match
+  /// followed by the capture groups is written to captures. At most budget
+  /// backtracks are performed.
+  /// \return 1 on a match, 0 on no match, or 2 if the budget ran out.
+  using EntryPoint = uint32_t (*)(
+      const void *first,
+      const void *start,
+      const void *end,
+      CapturedRange *captures,
+      uint32_t onlyAtStart,
+      uint64_t budget);
+
+ private:
+  JITCompiledRegex(
+      llvh::sys::OwningMemoryBlock memory,
+      size_t codeSize,
+      size_t utf16EntryOffset,
+      uint16_t markedCount);
+
+  template <typename CharT>
+  Result searchImpl(
+      EntryPoint entry,
+      const CharT *first,
+      uint32_t start,
+      uint32_t length,
+      bool onlyAtStart,
+      constants::MatchFlagType matchFlags,
+      std::vector<CapturedRange> *captures) const;
+
+  /// The executable memory holding both entry points.
+  llvh::sys::OwningMemoryBlock memory_;
+
+  /// Number of bytes of code in memory_.
+  size_t codeSize_;
+
+  /// Entry points for 8 bit and 16 bit input.
+  EntryPoint asciiEntry_;
+  EntryPoint utf16Entry_;
+
+  /// Number of capture groups, excluding the total match.
+  uint16_t markedCount_;
+};
+
+} // namespace regex
+} // namespace hermes
+
+#endif // HERMES_REGEX_REGEXJIT_H
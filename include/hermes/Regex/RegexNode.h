@@ -91,6 +91,61 @@ class Node {
   inline static void
   optimizeNodeList(NodeList &nodes, SyntaxFlags flags, NodeHolder &nodeHolder);
 
+  /// Describes which code units may begin a match of a node, as computed by
+  /// addFirstChars().
+  enum class FirstChars {
+    /// The node may match without consuming anything, so the first code unit
+    /// may also come from the nodes that follow it.
+    Transparent,
+    /// The node always consumes one of the reported code units first.
+    Known,
+    /// The first code unit of a match cannot be bounded.
+    Unknown,
+  };
+
+  /// Add the code units that may begin a match of the list \p nodes to \p
+  /// chars.
+  static FirstChars firstCharsForList(
+      const NodeList &nodes,
+      CodePointList *chars) {
+    for (const auto &node : nodes) {
+      FirstChars result = node->addFirstChars(chars);
+      if (result != FirstChars::Transparent)
+        return result;
+    }
+    return FirstChars::Transparent;
+  }
+
+  /// If every match of \p nodes begins with a case-sensitive run of literal
+  /// characters, possibly preceded by zero-width assertions, add those
+  /// characters to \p chars.
+  static void literalPrefixForList(
+      const NodeList &nodes,
+      CodePointList *chars) {
+    for (const auto &node : nodes) {
+      if (node->tryCoalesceLiteralPrefix(chars))
+        return;
+      CodePointList ignored;
+      if (!node->getChildren().empty() ||
+          node->addFirstChars(&ignored) != FirstChars::Transparent)
+        return;
+    }
+  }
+
+  /// \return whether every node in \p nodes, including all of their
+  /// descendants, can be executed without backtracking.
+  static bool isBacktrackFreeList(const NodeList &nodes) {
+    for (Node *node : nodes) {
+      if (!node->isBacktrackFree())
+        return false;
+      for (NodeList *children : node->getChildren()) {
+        if (!isBacktrackFreeList(*children))
+          return false;
+      }
+    }
+    return true;
+  }
+
   /// \return whether the node always matches exactly one character.
   virtual bool matchesExactlyOneCharacter() const {
     return false;
@@ -116,6 +171,28 @@ class Node {
     return false;
   }
 
+  /// Add the code units that may begin a match of this node to \p chars.
+  /// The code units are never astral, and never surrogates in Unicode mode.
+  /// Node itself matches the empty string, as do the zero-width assertions
+  /// that do not override this.
+  virtual FirstChars addFirstChars(CodePointList *chars) const {
+    return FirstChars::Transparent;
+  }
+
+  /// \return whether this node, not counting its children, can be executed by
+  /// the non-backtracking executor. That executor follows every possible path
+  /// through the regex at once, so it cannot support nodes whose behavior
+  /// depends on more than the current instruction and input position.
+  virtual bool isBacktrackFree() const {
+    return true;
+  }
+
+  /// If this node matches a fixed, case-sensitive string of BMP characters,
+  /// add them to \p chars and \return true. Otherwise \return false.
+  virtual bool tryCoalesceLiteralPrefix(CodePointList *chars) const {
+    return false;
+  }
+
   /// \return pointers to the NodeLists contained in this node.
   virtual llvh::SmallVector<NodeList *, 1> getChildren() {
     return {};
@@ -152,6 +229,11 @@ class GoalNode final : public Node {
   bool isGoal() const override {
     return true;
   }
+
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    // The empty string matches.
+    return FirstChars::Unknown;
+  }
 };
 
 class LoopNode final : public Node {
@@ -231,6 +313,25 @@ class LoopNode final : public Node {
     reverseNodeList(loopee_);
   }
 
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    FirstChars result = firstCharsForList(loopee_, chars);
+    if (result == FirstChars::Unknown)
+      return result;
+    return min_ > 0 ? result : FirstChars::Transparent;
+  }
+
+  /// Width 1 and simple loops are supported directly. Other loops are
+  /// supported if their iteration count need not be tracked beyond the first
+  /// iteration, and their body cannot match the empty string, so that the
+  /// empty-iteration check never applies.
+  bool isBacktrackFree() const override {
+    if (isWidth1Loop() || isSimpleLoop())
+      return true;
+    return min_ <= 1 &&
+        (max_ <= 1 || max_ == std::numeric_limits<uint32_t>::max()) &&
+        (loopeeConstraints_ & MatchConstraintNonEmpty);
+  }
+
  private:
   /// Override of emitStep() to compile our looped expression and add a jump
   /// back to the loop.
@@ -368,6 +469,23 @@ class AlternationNode final : public Node {
     }
   }
 
+ protected:
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    FirstChars result = FirstChars::Known;
+    for (const auto &alternative : alternatives_) {
+      switch (firstCharsForList(alternative, chars)) {
+        case FirstChars::Unknown:
+          return FirstChars::Unknown;
+        case FirstChars::Transparent:
+          result = FirstChars::Transparent;
+          break;
+        case FirstChars::Known:
+          break;
+      }
+    }
+    return result;
+  }
+
  private:
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
     // Instruction stream looks like:
@@ -448,6 +566,11 @@ class MarkedSubexpressionNode final : public Node {
     return contentsConstraints_ | Super::matchConstraints();
   }
 
+ protected:
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    return firstCharsForList(contents_, chars);
+  }
+
  private:
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
     if (!emitEnd_) {
@@ -469,6 +592,16 @@ class BackRefNode final : public Node {
  public:
   explicit BackRefNode(unsigned mexp) : mexp_(mexp) {}
 
+ protected:
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    return FirstChars::Unknown;
+  }
+
+  /// Backreferences depend on the captures of the path taken so far.
+  bool isBacktrackFree() const override {
+    return false;
+  }
+
  private:
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
     bcs.emit<BackRefInsn>()->mexp = mexp_;
@@ -557,6 +690,11 @@ class MatchAnyNode final : public Node {
     return !unicode_;
   }
 
+ protected:
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    return FirstChars::Unknown;
+  }
+
  private:
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
     if (unicode_) {
@@ -646,6 +784,26 @@ class MatchCharNode final : public Node {
         !mayRequireDecodingSurrogatePair(chars_.front());
   }
 
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    // Case-insensitive characters are canonicalized and may match several
+    // code units.
+    if (icase_ || mayRequireDecodingSurrogatePair(chars_.front()))
+      return FirstChars::Unknown;
+    chars->push_back(chars_.front());
+    return FirstChars::Known;
+  }
+
+  bool tryCoalesceLiteralPrefix(CodePointList *chars) const override {
+    if (icase_)
+      return false;
+    for (CodePoint c : chars_) {
+      if (mayRequireDecodingSurrogatePair(c))
+        break;
+      chars->push_back(c);
+    }
+    return true;
+  }
+
   /// Emit a list of ASCII characters into bytecode stream \p bcs.
   void emitASCIIList(llvh::ArrayRef<CodePoint> chars, RegexBytecodeStream &bcs)
       const {
@@ -839,6 +997,23 @@ class BracketNode : public Node {
     return !unicode_;
   }
 
+ protected:
+  FirstChars addFirstChars(CodePointList *chars) const override {
+    if (negate_ || icase_ || !classes_.empty())
+      return FirstChars::Unknown;
+    for (const CodePointRange &range : codePointSet_.ranges()) {
+      if (range.length > RegexBytecodeHeader::kMaxPrefilterChars)
+        return FirstChars::Unknown;
+      for (CodePoint c = range.first; c < range.first + range.length; ++c) {
+        if (!isMemberOfBMP(c) ||
+            (unicode_ && (isHighSurrogate(c) || isLowSurrogate(c))))
+          return FirstChars::Unknown;
+        chars->push_back(c);
+      }
+    }
+    return FirstChars::Known;
+  }
+
  private:
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
     if (unicode_) {
@@ -912,6 +1087,12 @@ class LookaroundNode : public Node {
     return {&exp_};
   }
 
+ protected:
+  /// Lookarounds run a nested match at the current position.
+  bool isBacktrackFree() const override {
+    return false;
+  }
+
  private:
   // Override emitStep() to compile our lookahead expression.
   virtual NodeList *emitStep(RegexBytecodeStream &bcs) override {
@@ -42,6 +42,10 @@ enum MatchFlagType {
 
   /// Do not search for a match past the search start location.
   matchOnlyAtStart = 1 << 3,
+
+  /// If the regex can be executed without backtracking, do so immediately
+  /// instead of first trying the backtracking executor.
+  matchNonBacktracking = 1 << 4,
 };
 
 inline constexpr MatchFlagType operator~(MatchFlagType x) {
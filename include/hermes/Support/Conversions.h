@@ -153,6 +153,15 @@ const size_t NUMBER_TO_STRING_BUF_SIZE = 32;
 /// \return the length of the generated string (excluding the terminating zero).
 size_t numberToString(double m, char *dest, size_t destSize);
 
+/// Attempt to convert the decimal number literal in [first, last), which must
+/// have the form [+-]digits[.digits][(e|E)[+-]digits], without invoking dtoa.
+/// This succeeds only when the literal has at most 19 significant digits and
+/// its value can be computed exactly with a single floating point operation,
+/// which covers the vast majority of numbers seen in practice.
+/// \return the converted number, or an empty value if the string must be
+///   parsed by the general (and much slower) hermes_g_strtod().
+OptValue<double> parseDecimalFastPath(const char *first, const char *last);
+
 /// Takes a letter (a-z or A-Z) and makes it lowercase.
 template <typename T>
 inline T charLetterToLower(T ch) {
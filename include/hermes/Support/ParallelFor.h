@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SUPPORT_PARALLELFOR_H
+#define HERMES_SUPPORT_PARALLELFOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace hermes {
+
+/// Call \p fn with each index in [0, count), on up to \p numThreads threads
+/// including the calling one. Indices are handed out in increasing order, but
+/// the calls may complete in any order.
+template <typename Fn>
+void parallelFor(size_t count, unsigned numThreads, const Fn &fn) {
+  std::atomic<size_t> next{0};
+  auto worker = [count, &next, &fn]() {
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count;)
+      fn(i);
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < numThreads && i < count; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &thread : threads)
+    thread.join();
+}
+
+} // namespace hermes
+
+#endif // HERMES_SUPPORT_PARALLELFOR_H
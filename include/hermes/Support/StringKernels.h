@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SUPPORT_STRINGKERNELS_H
+#define HERMES_SUPPORT_STRINGKERNELS_H
+
+#include "llvh/ADT/ArrayRef.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// \file
+/// Bulk operations on character buffers used by the string library.
+/// On targets with SSE2 (always available on x86-64) these process 16 bytes at
+/// a time; elsewhere they fall back to portable word-at-a-time or scalar code.
+
+namespace hermes {
+
+/// Value returned by the search functions when there is no match.
+constexpr size_t kStringNotFound = ~(size_t)0;
+
+/// Find the first occurrence of \p needle in \p haystack.
+/// Candidate positions are filtered by comparing the first and last character
+/// of the needle before comparing the whole needle.
+/// \return the index of the match, or kStringNotFound. An empty needle matches
+///   at index 0.
+size_t findSubstring(
+    llvh::ArrayRef<char> haystack,
+    llvh::ArrayRef<char> needle);
+size_t findSubstring(
+    llvh::ArrayRef<char16_t> haystack,
+    llvh::ArrayRef<char16_t> needle);
+
+/// Convert the ASCII characters in \p src to upper case if \p upperCase is
+/// true, or to lower case otherwise, and store them in \p dest, which must
+/// have room for src.size() characters. \p dest may be the same as src.data().
+/// \return true if any character was changed by the conversion.
+bool convertASCIICase(llvh::ArrayRef<char> src, char *dest, bool upperCase);
+
+/// Zero extend the ASCII characters in \p src into \p dest, which must have
+/// room for src.size() characters.
+void widenASCII(llvh::ArrayRef<char> src, char16_t *dest);
+
+} // namespace hermes
+
+#endif // HERMES_SUPPORT_STRINGKERNELS_H
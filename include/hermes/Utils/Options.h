@@ -59,6 +59,10 @@ struct BytecodeGenerationOptions {
   /// Strip the source map URL.
   bool stripSourceMappingURL = false;
 
+  /// Number of threads on which to allocate registers and lower functions.
+  /// The generated bytecode does not depend on it.
+  unsigned numThreads = 1;
+
   /* implicit */ BytecodeGenerationOptions(OutputFormatKind format)
       : format(format) {}
 
@@ -110,6 +110,28 @@ class HadesGC final : public GCBase {
   void printStats(JSONEmitter &json) override;
   std::string getKindAsStr() const override;
 
+#ifdef HERMESVM_SERIALIZE
+  /// Segments are allocated on demand, so the space available for use is the
+  /// maximum heap size. The deserializer checks it against the size of the
+  /// heap that was serialized.
+  uint64_t size() const {
+    return maxHeapSize_;
+  }
+
+  void serializeWeakRefs(Serializer &s) override;
+  void deserializeWeakRefs(Deserializer &d) override;
+  void serializeHeap(Serializer &s) override;
+  void deserializeHeap(Deserializer &d) override;
+
+  /// Objects must not move while the heap is deserialized, so YG is promoted
+  /// to OG whenever it fills up, and no OG collection is started.
+  void deserializeStart() override;
+
+  /// Promote the remaining YG, so that no OG object points into the YG
+  /// without a dirty card, and restore the previous YG promotion mode.
+  void deserializeEnd() override;
+#endif
+
   /// \}
 
   /// \name GC non-virtual API
@@ -651,6 +673,11 @@ class HadesGC final : public GCBase {
   /// If true, turn off promoteYGToOG_ as soon as the first OG GC occurs.
   bool revertToYGAtTTI_;
 
+#ifdef HERMESVM_SERIALIZE
+  /// The value of promoteYGToOG_ before deserialization started.
+  bool promoteYGToOGBeforeDeserialize_{false};
+#endif
+
   /// Target OG occupancy ratio at the end of an OG collection.
   const double occupancyTarget_;
 
@@ -10,6 +10,7 @@
 
 #include "hermes/Regex/RegexTypes.h"
 #include "hermes/VM/JSObject.h"
+#include "hermes/VM/RegExpCache.h"
 #include "hermes/VM/RegExpMatch.h"
 #include "hermes/VM/SmallXString.h"
 
@@ -140,6 +141,13 @@ class JSRegExp final : public JSObject {
 
   regex::SyntaxFlags syntaxFlags_ = {};
 
+  /// Whether jitIndex_ has been looked up in the runtime's RegExpJITCache.
+  bool jitLookedUp_{false};
+
+  /// The index of the native code compiled from bytecode_ in the
+  /// RegExpJITCache, or kNoCode if the RegExp is interpreted.
+  RegExpJITCache::Index jitIndex_{RegExpJITCache::kNoCode};
+
   // Finalizer to clean up stored native regex
   static void _finalizeImpl(GCCell *cell, GC *gc);
   static size_t _mallocSizeImpl(GCCell *cell);
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_EXECUTIONPROFILER_H
+#define HERMES_VM_EXECUTIONPROFILER_H
+
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/Support/raw_ostream.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+class CodeBlock;
+class RuntimeModule;
+
+/// Collects the execution counts used for profile guided optimization: how
+/// often each function is called, the order in which functions are first
+/// called, and how often each basic block runs. Block counts are only
+/// available for bytecode compiled with -basic-block-profiling, which inserts
+/// a ProfilePoint instruction at the start of every block.
+///
+/// The profile is written as JSON and read back by the compiler with
+/// -profile-use. Functions are identified by the line and column where they
+/// start, which stay the same when the source is compiled again, except for
+/// the global function, whose location is "global":
+///
+///   {"version": 1, "functions": [{"name": "foo", "location": "3:1",
+///     "calls": 10, "first_execution": 2, "blocks": [10, 4, 6, 10]}]}
+///
+/// "first_execution" is the position of the function among all the functions
+/// in the order they were first called, or 0 if it was never called. "blocks"
+/// holds the execution count of each basic block, in the order of the blocks
+/// in the function when the bytecode was generated.
+class ExecutionProfiler {
+ public:
+  /// Record a call to the function of \p codeBlock.
+  void onFunctionEntry(CodeBlock *codeBlock) {
+    FunctionCounts &counts = getCounts(codeBlock);
+    if (counts.calls++ == 0)
+      counts.firstExecution = ++numExecutedFunctions_;
+  }
+
+  /// Record the execution of the basic block with profile point
+  /// \p pointIndex in \p codeBlock.
+  void onProfilePoint(CodeBlock *codeBlock, uint16_t pointIndex) {
+    std::vector<uint64_t> &blocks = getCounts(codeBlock).blocks;
+    if (pointIndex >= blocks.size())
+      blocks.resize(pointIndex + 1);
+    ++blocks[pointIndex];
+  }
+
+  /// Add the counts of \p module to the profile, before it is destroyed.
+  void removeRuntimeModule(RuntimeModule *module);
+
+  /// Write the profile of all the functions that were executed, and of the
+  /// functions that were not executed in the same modules, to \p OS.
+  void dump(llvh::raw_ostream &OS);
+
+ private:
+  /// The counts of a function, indexed by function ID in its module.
+  struct FunctionCounts {
+    /// Number of calls.
+    uint64_t calls{0};
+    /// Position of the first call among the first calls of all functions.
+    uint64_t firstExecution{0};
+    /// Execution counts indexed by profile point. The entry block has the
+    /// largest index, and index 0 is shared by all the blocks past 2^16.
+    std::vector<uint64_t> blocks{};
+  };
+
+  /// The profile of a function, keyed by its location in the output.
+  struct FunctionProfile {
+    std::string name;
+    uint64_t calls{0};
+    uint64_t firstExecution{0};
+    /// Execution counts in the order of the blocks in the function.
+    std::vector<uint64_t> blocks{};
+  };
+
+  using ProfileMap = std::map<std::string, FunctionProfile>;
+
+  /// \return the counts of the function of \p codeBlock.
+  FunctionCounts &getCounts(CodeBlock *codeBlock);
+
+  /// Add the counts \p moduleCounts of the functions of \p module to
+  /// \p profile. Functions without a source location are skipped.
+  static void addModuleProfile(
+      RuntimeModule *module,
+      const std::vector<FunctionCounts> &moduleCounts,
+      ProfileMap &profile);
+
+  /// Number of functions that were called at least once.
+  uint64_t numExecutedFunctions_{0};
+
+  /// Counts of the functions of each live module that executed code.
+  llvh::DenseMap<RuntimeModule *, std::vector<FunctionCounts>> modules_{};
+
+  /// Profile of the modules that were destroyed.
+  ProfileMap removedModules_{};
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_EXECUTIONPROFILER_H
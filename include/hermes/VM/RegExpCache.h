@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_VM_REGEXPCACHE_H
+#define HERMES_VM_REGEXPCACHE_H
+
+#include "hermes/Regex/RegexJIT.h"
+#include "hermes/VM/RuntimeStats.h"
+
+#include "llvh/ADT/ArrayRef.h"
+#include "llvh/ADT/Hashing.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hermes {
+namespace vm {
+
+/// A least recently used cache of compiled regular expression bytecode, keyed
+/// by the pattern source and the syntax flags. RegExps constructed repeatedly
+/// from the same dynamic pattern find their bytecode here instead of parsing
+/// and compiling the pattern again.
+/// Hits, misses and evictions are counted in the RuntimeStats passed to the
+/// constructor.
+class RegExpCache {
+ public:
+  /// Patterns longer than this many code units are never cached.
+  static constexpr size_t kMaxPatternLength = 1024;
+
+  /// Upper bound on the number of pattern and bytecode bytes held by the cache.
+  static constexpr size_t kMaxBytes = 256 * 1024;
+
+  /// Create a cache holding at most \p maxEntries entries. A \p maxEntries of
+  /// zero disables the cache.
+  RegExpCache(unsigned maxEntries, instrumentation::RuntimeStats &stats)
+      : maxEntries_(maxEntries), stats_(stats) {}
+
+  RegExpCache(const RegExpCache &) = delete;
+  void operator=(const RegExpCache &) = delete;
+
+  /// Look up the bytecode compiled from \p pattern with the syntax flags
+  /// \p flags, and make it the most recently used entry.
+  /// \return the bytecode, or nullptr if it is not in the cache. The bytecode
+  ///   remains valid until the next call to insert() or clear().
+  const std::vector<uint8_t> *lookup(
+      llvh::ArrayRef<char16_t> pattern,
+      uint8_t flags);
+
+  /// Record \p bytecode as the result of compiling \p pattern with \p flags,
+  /// evicting the least recently used entries if the cache is full.
+  /// The pattern must not already be in the cache.
+  void insert(
+      llvh::ArrayRef<char16_t> pattern,
+      uint8_t flags,
+      std::vector<uint8_t> bytecode);
+
+  /// Remove all entries.
+  void clear();
+
+  /// \return the number of entries in the cache.
+  size_t size() const {
+    return entries_.size();
+  }
+
+  /// \return the number of pattern and bytecode bytes held by the cache.
+  size_t getBytes() const {
+    return bytes_;
+  }
+
+ private:
+  struct Entry {
+    std::u16string pattern;
+    uint8_t flags;
+    std::vector<uint8_t> bytecode;
+
+    size_t bytes() const {
+      return pattern.size() * sizeof(char16_t) + bytecode.size();
+    }
+  };
+
+  /// Entries are identified by a reference to the pattern stored in the
+  /// Entry itself, which does not move since list nodes are stable.
+  struct Key {
+    llvh::ArrayRef<char16_t> pattern;
+    uint8_t flags;
+
+    bool operator==(const Key &other) const {
+      return flags == other.flags && pattern.equals(other.pattern);
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      return llvh::hash_combine(
+          llvh::hash_combine_range(key.pattern.begin(), key.pattern.end()),
+          key.flags);
+    }
+  };
+
+  using EntryList = std::list<Entry>;
+
+  /// Remove the least recently used entry.
+  void evictOne();
+
+  /// The maximum number of entries.
+  const unsigned maxEntries_;
+
+  /// Where hits, misses and evictions are counted.
+  instrumentation::RuntimeStats &stats_;
+
+  /// The entries, ordered from most to least recently used.
+  EntryList entries_{};
+
+  /// Maps the key of every entry to its position in entries_.
+  std::unordered_map<Key, EntryList::iterator, KeyHash> map_{};
+
+  /// Sum of Entry::bytes() over all entries.
+  size_t bytes_{0};
+};
+
+/// Native code compiled from RegExp bytecode, shared by all RegExps with the
+/// same bytecode. Entries are never evicted, so that RegExps may refer to them
+/// by index; once kMaxEntries bytecodes have been seen, other RegExps are left
+/// to the interpreter.
+class RegExpJITCache {
+ public:
+  /// The index of an entry, which is small enough to be stored in a JSRegExp
+  /// without growing it.
+  using Index = uint16_t;
+
+  /// Upper bound on the number of distinct bytecodes compiled.
+  static constexpr size_t kMaxEntries = 256;
+
+  /// The index of bytecode which has no native code.
+  static constexpr Index kNoCode = UINT16_MAX;
+
+  /// Create a cache which compiles RegExps only if \p enabled is set.
+  explicit RegExpJITCache(bool enabled) : enabled_(enabled) {}
+
+  RegExpJITCache(const RegExpJITCache &) = delete;
+  void operator=(const RegExpJITCache &) = delete;
+
+  /// \return whether RegExps should be compiled.
+  bool isEnabled() const {
+    return enabled_;
+  }
+
+  /// \return the index of the native code compiled from \p bytecode,
+  ///   compiling it if it has not been seen before, or kNoCode if it cannot be
+  ///   compiled.
+  Index getOrCompile(llvh::ArrayRef<uint8_t> bytecode);
+
+  /// \return the native code at \p index, or nullptr if it is kNoCode.
+  const regex::JITCompiledRegex *get(Index index) const {
+    return index == kNoCode ? nullptr : entries_[index].get();
+  }
+
+  /// \return the number of bytecodes seen, including those that could not be
+  ///   compiled.
+  size_t size() const {
+    return map_.size();
+  }
+
+ private:
+  const bool enabled_;
+
+  /// Compiled code, or null if the bytecode could not be compiled.
+  std::vector<std::unique_ptr<regex::JITCompiledRegex>> entries_{};
+
+  /// Indices into entries_, keyed by the bytecode itself.
+  std::unordered_map<std::string, Index> map_{};
+};
+
+} // namespace vm
+} // namespace hermes
+
+#endif // HERMES_VM_REGEXPCACHE_H
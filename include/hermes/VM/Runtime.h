@@ -34,6 +34,7 @@
 #include "hermes/VM/PropertyDescriptor.h"
 #include "hermes/VM/RegExpMatch.h"
 #include "hermes/VM/RuntimeModule.h"
+#include "hermes/VM/RegExpCache.h"
 #include "hermes/VM/RuntimeStats.h"
 #include "hermes/VM/Serializer.h"
 #include "hermes/VM/StackFrame.h"
@@ -85,6 +86,7 @@ class ScopedNativeDepthTracker;
 class ScopedNativeCallFrame;
 class SamplingProfiler;
 class CodeCoverageProfiler;
+class ExecutionProfiler;
 struct MockedEnvironment;
 struct StackTracesTree;
 
@@ -423,6 +425,19 @@ class Runtime : public HandleRootOwner,
   /// 256 characters are pre-allocated. The rest are allocated every time.
   Handle<StringPrimitive> getCharacterString(char16_t ch);
 
+  /// Strings up to this length are candidates for the short string cache.
+  static constexpr uint32_t kShortStringCacheMaxLength = 16;
+
+  /// Look up a string with the contents \p str in the short string cache.
+  /// \param hash the result of hashString(str).
+  /// \return the cached string, or nullptr if there is no such entry.
+  StringPrimitive *lookupShortString(ASCIIRef str, uint32_t hash);
+  StringPrimitive *lookupShortString(UTF16Ref str, uint32_t hash);
+
+  /// Record \p str, whose contents hash to \p hash, in the short string cache,
+  /// replacing any existing entry in its slot.
+  void insertShortString(StringPrimitive *str, uint32_t hash);
+
   CodeBlock *getEmptyCodeBlock() const {
     assert(emptyCodeBlock_ && "Invalid empty code block");
     return emptyCodeBlock_;
@@ -569,6 +584,16 @@ class Runtime : public HandleRootOwner,
     return runtimeStats_;
   }
 
+  /// \return the cache of compiled RegExp bytecode.
+  RegExpCache &getRegExpCache() {
+    return regExpCache_;
+  }
+
+  /// \return the cache of RegExps compiled to native code.
+  RegExpJITCache &getRegExpJITCache() {
+    return regExpJITCache_;
+  }
+
   /// Print the heap and other misc. stats to the given stream.
   void printHeapStats(llvh::raw_ostream &os);
 
@@ -824,6 +849,10 @@ class Runtime : public HandleRootOwner,
   /// will automatically register/unregister this runtime from profiling.
   std::unique_ptr<SamplingProfiler> samplingProfiler;
 
+  /// Execution counts for profile guided optimization, or null if they are
+  /// not being collected.
+  std::unique_ptr<ExecutionProfiler> executionProfiler;
+
 #ifdef HERMESVM_PROFILER_NATIVECALL
   /// Dump statistics about native calls.
   void dumpNativeCallStats(llvh::raw_ostream &OS);
@@ -1193,6 +1222,13 @@ class Runtime : public HandleRootOwner,
   /// Set of runtime statistics.
   instrumentation::RuntimeStats runtimeStats_;
 
+  /// Compiled RegExp bytecode, keyed by pattern and flags. Its statistics are
+  /// kept in runtimeStats_, which must be declared first.
+  RegExpCache regExpCache_;
+
+  /// RegExps compiled to native code, keyed by bytecode.
+  RegExpJITCache regExpJITCache_;
+
   /// Shared location to place native objects required by JSLib
   std::shared_ptr<RuntimeCommonStorage> commonStorage_;
 
@@ -1250,6 +1286,14 @@ class Runtime : public HandleRootOwner,
   /// to be scanned as roots in young-gen collections.
   std::vector<PinnedHermesValue> charStrings_{};
 
+  /// Number of slots in the short string cache.
+  static constexpr size_t kShortStringCacheSize = 512;
+
+  /// Direct-mapped cache of recently created short strings, indexed by the
+  /// hash of their contents. The entries are weak, so strings that are not
+  /// otherwise referenced are dropped by the GC.
+  WeakRoot<StringPrimitive> shortStringCache_[kShortStringCacheSize];
+
   /// Pointers to callable implementations of builtins.
   std::vector<Callable *> builtins_{};
 
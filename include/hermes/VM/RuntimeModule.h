@@ -234,14 +234,20 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
   void prepareForRuntimeShutdown();
 
   /// For opcodes that use a stringID as identifier explicitly, we know that
-  /// the compiler would have marked the stringID as identifier, and hence
-  /// we should have created the symbol during identifier table initialization.
-  /// The symbol must already exist in the map. This is a fast path.
-  SymbolID getSymbolIDMustExist(StringID stringID) {
-    assert(
-        stringIDMap_[stringID].isValid() &&
-        "Symbol must exist for this string ID");
-    return stringIDMap_[stringID];
+  /// the compiler would have marked the stringID as identifier. Identifiers
+  /// of a persistent module are registered lazily on first use, which doesn't
+  /// allocate in the GC heap; the identifiers of other modules were all
+  /// created when the module was imported. This is a fast path.
+  SymbolID getSymbolIDForIdentifier(StringID stringID) {
+    SymbolID id = stringIDMap_[stringID];
+    if (LLVM_UNLIKELY(!id.isValid())) {
+      assert(
+          flags_.persistent &&
+          "Symbol must exist for this string ID in a non-persistent module");
+      auto entry = bcProvider_->getStringTableEntry(stringID);
+      id = createSymbolFromStringIDMayAllocate(stringID, entry, llvh::None);
+    }
+    return id;
   }
 
   /// \return the \c SymbolID for a string by string index. The symbol may not
@@ -420,7 +426,8 @@ class RuntimeModule final : public llvh::ilist_node<RuntimeModule> {
   static RuntimeModule *deserialize(Deserializer &d);
 #endif
  private:
-  /// Import the string table from the supplied module.
+  /// Import the string table from the supplied module. The identifiers of a
+  /// persistent module are left to be registered when they are first used.
   void importStringIDMapMayAllocate();
 
   /// Initialize functionMap_, without actually creating the code blocks.
@@ -40,6 +40,13 @@ struct RuntimeStats {
     uint64_t count{0};
   };
 
+  /// Counters for the cache of compiled RegExp bytecode.
+  struct RegExpCacheStats {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+  };
+
   RuntimeStats(bool shouldSample) : shouldSample(shouldSample) {}
 
   /// Measure of host function callouts (outgoing from VM).
@@ -51,6 +58,9 @@ struct RuntimeStats {
   /// Measure of of jsi Function calls (incoming to VM).
   Statistic incomingFunction;
 
+  /// Lookups in the RegExp cache.
+  RegExpCacheStats regExpCache;
+
   /// The topmost RAIITimer in the stack.
   RAIITimer *timerStack{nullptr};
 
@@ -9,6 +9,7 @@
 #define HERMES_VM_STRINGBUILDER_H
 
 #include "hermes/ADT/SafeInt.h"
+#include "hermes/Support/StringKernels.h"
 #include "hermes/VM/Casting.h"
 #include "hermes/VM/Runtime.h"
 #include "hermes/VM/StringPrimitive.h"
@@ -89,10 +90,7 @@ class StringBuilder {
           ascii.data() + ascii.size(),
           strPrim_->castToASCIIPointerForWrite() + index_);
     } else {
-      std::copy(
-          ascii.data(),
-          ascii.data() + ascii.size(),
-          strPrim_->castToUTF16PointerForWrite() + index_);
+      widenASCII(ascii, strPrim_->castToUTF16PointerForWrite() + index_);
     }
     index_ += ascii.size();
   }
@@ -117,13 +115,25 @@ class StringBuilder {
 
   /// Append the first \p length characters from StringPrimitive \p other.
   void appendStringPrim(Handle<StringPrimitive> other, uint32_t length) {
+    appendStringPrim(other, 0, length);
+  }
+
+  /// Append \p length characters from StringPrimitive \p other, starting at
+  /// index \p start.
+  void appendStringPrim(
+      Handle<StringPrimitive> other,
+      uint32_t start,
+      uint32_t length) {
     assert(
         index_ + length <= strPrim_->getStringLength() &&
         "StringBuilder append out of bound");
+    assert(
+        start + length <= other->getStringLength() &&
+        "StringBuilder source range out of bound");
     if (other->isASCII()) {
-      appendASCIIRef({other->castToASCIIPointer(), length});
+      appendASCIIRef({other->castToASCIIPointer() + start, length});
     } else if (!strPrim_->isASCII()) {
-      appendUTF16Ref({other->castToUTF16Pointer(), length});
+      appendUTF16Ref({other->castToUTF16Pointer() + start, length});
     } else {
       // strPrim_ is ASCII, while other is UTF16. We have to recreate string.
       auto strRes = runtime_->ignoreAllocationFailure(StringPrimitive::create(
@@ -135,7 +145,7 @@ class StringBuilder {
       index_ = 0;
       // Append original string and other.
       appendASCIIRef(currentPartialString);
-      appendUTF16Ref({other->castToUTF16Pointer(), length});
+      appendUTF16Ref({other->castToUTF16Pointer() + start, length});
     }
   }
 
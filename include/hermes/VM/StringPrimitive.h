@@ -18,11 +18,13 @@
 
 #include "llvh/Support/TrailingObjects.h"
 
+#include <memory>
 #include <type_traits>
 
 namespace hermes {
 namespace vm {
 
+class ExternalStringOwner;
 class StringView;
 
 /// The base class for all types of StringPrimitives. In most of the cases,
@@ -50,6 +52,20 @@ class StringPrimitive : public VariableSizeRuntimeCell {
       llvh::ArrayRef<T> str,
       std::basic_string<T> *optStorage = nullptr);
 
+  /// Copy \p str into a new string primitive, which is ASCII if possible,
+  /// without consulting or updating the short string cache.
+  template <typename T>
+  static CallResult<HermesValue> createEfficientUncached(
+      Runtime *runtime,
+      llvh::ArrayRef<T> str);
+
+  /// Shared implementation of createExternal().
+  template <typename T>
+  static CallResult<HermesValue> createExternalImpl(
+      Runtime *runtime,
+      llvh::ArrayRef<T> str,
+      std::unique_ptr<ExternalStringOwner> owner);
+
   /// Create a new DynamicASCIIStringPrimitive if str is all ASCII, otherwise
   /// create a new DynamicUTF16StringPrimitive.
   static CallResult<HermesValue> createDynamic(Runtime *runtime, UTF16Ref str);
@@ -180,6 +196,22 @@ class StringPrimitive : public VariableSizeRuntimeCell {
       Runtime *runtime,
       std::basic_string<char16_t> &&str);
 
+  /// Create a StringPrimitive from the embedder-owned characters \p str, which
+  /// must remain valid and unchanged until \p owner is destroyed. Strings of at
+  /// least EXTERNAL_STRING_MIN_SIZE characters refer to \p str without copying
+  /// it, credit its size to the GC as external memory, and destroy \p owner
+  /// when they are finalized. Shorter strings are copied, and \p owner is
+  /// destroyed before returning.
+  static CallResult<HermesValue> createExternal(
+      Runtime *runtime,
+      ASCIIRef str,
+      std::unique_ptr<ExternalStringOwner> owner);
+
+  static CallResult<HermesValue> createExternal(
+      Runtime *runtime,
+      UTF16Ref str,
+      std::unique_ptr<ExternalStringOwner> owner);
+
   /// Like the above, but the created StringPrimitives will be
   /// allocated in a "long-lived" area of the heap (if the GC supports
   /// that concept).
@@ -518,9 +550,20 @@ class DynamicStringPrimitive final
   }
 };
 
+/// Keeps alive characters that are owned by the embedder and referenced, without
+/// copying, by an ExternalStringPrimitive. It is destroyed when the string is
+/// finalized, which may happen on a background GC thread, and implementations
+/// release the characters in their destructor.
+class ExternalStringOwner {
+ public:
+  virtual ~ExternalStringOwner() = default;
+};
+
 /// An immutable JavaScript primitive string consisting of length and a pointer
 /// to characters (either char or char16). The storage uses std::string or
 /// std::u16string, and the object's finalizer deallocates the storage.
+/// Alternatively, the characters may be owned by the embedder and kept alive by
+/// an ExternalStringOwner, which the finalizer destroys.
 /// Note: while StringPrimitive extends VariableSizeRuntimeCell, these subtypes
 /// are not actually variable-sized: we indicate that they are fixed-size in the
 /// metadata.
@@ -572,6 +615,8 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static const VTable vt;
 
   size_t calcExternalMemorySize() const {
+    if (hostChars_)
+      return getStringLength() * sizeof(T);
     return contents_.capacity() * sizeof(T);
   }
 
@@ -581,9 +626,20 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   template <class BasicString>
   ExternalStringPrimitive(Runtime *runtime, BasicString &&contents);
 
+  /// Construct an ExternalStringPrimitive referring to the embedder-owned
+  /// characters \p hostChars, which are kept alive by \p owner until the string
+  /// is finalized. The new string takes ownership of \p owner.
+  ExternalStringPrimitive(
+      Runtime *runtime,
+      Ref hostChars,
+      ExternalStringOwner *owner);
+
  private:
   /// Destructor deallocates the contents_ string.
-  ~ExternalStringPrimitive() = default;
+  ~ExternalStringPrimitive() {
+    if (!hostChars_)
+      contents_.~CopyableStdString();
+  }
 
   /// Transfer ownership of an std::string into a new StringPrim. Throw \c
   /// RangeError if the string is longer than \c MAX_STRING_LENGTH characters.
@@ -604,7 +660,18 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   /// \c CallResult<HermesValue>. This should only be used by StringBuilder.
   static CallResult<HermesValue> create(Runtime *runtime, uint32_t length);
 
+  /// Create a StringPrim object referring to the embedder-owned characters
+  /// \p str without copying them. \p owner is destroyed when the string is
+  /// finalized, or immediately if the string cannot be created. Throw \c
+  /// RangeError if the string is longer than \c MAX_STRING_LENGTH characters.
+  static CallResult<HermesValue> createWithOwner(
+      Runtime *runtime,
+      Ref str,
+      std::unique_ptr<ExternalStringOwner> owner);
+
   const T *getRawPointer() const {
+    if (hostChars_)
+      return hostChars_;
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -614,6 +681,7 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   /// normally be done, but for those rare cases, this method gives access to
   /// the writable buffer.
   T *getRawPointerForWrite() {
+    assert(!hostChars_ && "cannot write to embedder-owned characters");
     // C++11 defines this to be valid even if the string is empty.
     return &contents_[0];
   }
@@ -631,9 +699,22 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
   static void _snapshotAddEdgesImpl(GCCell *cell, GC *gc, HeapSnapshot &snap);
   static void _snapshotAddNodesImpl(GCCell *cell, GC *gc, HeapSnapshot &snap);
 
-  /// The backing storage of this string. Note that the string's length is fixed
-  /// and must always be equal to StringPrimitive::getStringLength().
-  CopyableStdString contents_{};
+  /// The embedder-owned characters of this string, or nullptr if they are
+  /// stored in contents_.
+  const T *hostChars_{nullptr};
+
+  /// Only one of these is active, depending on hostChars_. An empty std::string
+  /// would not be safe to move with memcpy, so it is not constructed at all for
+  /// embedder-owned characters.
+  union {
+    /// The backing storage of this string. Note that the string's length is
+    /// fixed and must always be equal to StringPrimitive::getStringLength().
+    CopyableStdString contents_;
+
+    /// Keeps hostChars_ alive. Owned by this string and destroyed in the
+    /// finalizer.
+    ExternalStringOwner *hostOwner_;
+  };
 };
 
 /// An immutable JavaScript primitive consisting of a pointer to an
@@ -140,6 +140,18 @@ OptValue<DebugSourceLocation> DebugInfo::getLocationForAddress(
   return llvh::None;
 }
 
+OptValue<DebugSourceLocation> DebugInfo::getFunctionLocation(
+    uint32_t debugOffset) const {
+  assert(debugOffset < data_.size() && "Debug offset out of range");
+  FunctionDebugInfoDeserializer fdid(data_.getData(), debugOffset);
+  if (auto file = getFilenameForAddress(debugOffset)) {
+    DebugSourceLocation location = fdid.getCurrent();
+    location.filenameId = *file;
+    return location;
+  }
+  return llvh::None;
+}
+
 OptValue<DebugSearchResult> DebugInfo::getAddressForLocation(
     uint32_t filenameId,
     uint32_t targetLine,
@@ -20,12 +20,14 @@
 #include "hermes/BCGen/Lowering.h"
 #include "hermes/IR/Analysis.h"
 #include "hermes/IR/CFG.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IR.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/IR/IRVerifier.h"
 #include "hermes/IR/Instrs.h"
 #include "hermes/Optimizer/PassManager/Pass.h"
 #include "hermes/Optimizer/PassManager/PassManager.h"
+#include "hermes/Support/ParallelFor.h"
 #include "hermes/Support/PerfSection.h"
 #include "hermes/Support/UTF8.h"
 
@@ -47,6 +49,11 @@ const unsigned kFastRegisterAllocationThreshold = 250;
 // time memory usage.
 const uint64_t kRegisterAllocationMemoryLimit = 10L * 1024 * 1024;
 
+// When generating code on several threads, allocate registers for this many
+// functions per thread before selecting their instructions, which bounds the
+// number of register allocations alive at once.
+const size_t kFunctionsPerThreadBatch = 32;
+
 void lowerIR(Module *M, const BytecodeGenerationOptions &options) {
   if (M->isLowered())
     return;
@@ -105,6 +112,54 @@ void lowerIR(Module *M, const BytecodeGenerationOptions &options) {
   }
 }
 
+/// Allocate registers for the non-lazy function \p F, and run the lowering
+/// passes that depend on the allocation. Only \p F is modified, so this may
+/// run concurrently for different functions of a module under a
+/// ConcurrentIRScope.
+/// \return the register allocation.
+std::unique_ptr<HVMRegisterAllocator> allocateRegisters(
+    Function *F,
+    const BytecodeGenerationOptions &options) {
+  auto RA = llvh::make_unique<HVMRegisterAllocator>(F);
+  if (!options.optimizationEnabled) {
+    RA->setFastPassThreshold(kFastRegisterAllocationThreshold);
+    RA->setMemoryLimit(kRegisterAllocationMemoryLimit);
+  }
+  PostOrderAnalysis PO(F);
+  /// The order of the blocks is reverse-post-order, which is a simply
+  /// topological sort.
+  llvh::SmallVector<BasicBlock *, 16> order(PO.rbegin(), PO.rend());
+  RA->allocate(order);
+
+  if (options.format == DumpRA) {
+    RA->dump();
+  }
+
+  PassManager PM;
+  PM.addPass(new LowerStoreInstrs(*RA));
+  PM.addPass(new LowerCalls(*RA));
+  if (options.optimizationEnabled) {
+    PM.addPass(new MovElimination(*RA));
+    PM.addPass(new RecreateCheapValues(*RA));
+    PM.addPass(new LoadConstantValueNumbering(*RA));
+  }
+  PM.addPass(new SpillRegisters(*RA));
+  if (options.basicBlockProfiling) {
+    // Insert after all other passes so that it sees final basic block
+    // list.
+    PM.addPass(new InsertProfilePoint());
+  }
+  PM.run(F);
+
+  if (options.format == DumpLRA)
+    RA->dump();
+
+  if (options.format == DumpPostRA)
+    F->dump();
+
+  return RA;
+}
+
 /// Used in delta optimizing mode.
 /// \return a UniquingStringLiteralAccumulator seeded with strings  from a
 /// bytecode provider \p bcProvider.
@@ -138,6 +193,41 @@ UniquingStringLiteralAccumulator stringAccumulatorFromBCProvider(
       std::move(css), std::move(isIdentifier)};
 }
 
+/// Move the functions of \p M that were called in \p profile to the front of
+/// the module, in the order in which they were first called, followed by the
+/// remaining functions in their original order. Function IDs and bodies,
+/// literal buffers and strings are all laid out in module order, so this keeps
+/// what runs at startup on as few pages of the bytecode file as possible.
+void orderFunctionsByFirstExecution(
+    Module *M,
+    const ExecutionProfile &profile) {
+  // The top level function stays first, since it may be identified by its
+  // position.
+  Function *topLevel = M->getTopLevelFunction();
+  std::vector<std::pair<uint64_t, Function *>> order;
+  for (auto &F : *M) {
+    uint64_t firstExecution = UINT64_MAX;
+    if (&F == topLevel) {
+      firstExecution = 0;
+    } else if (auto *functionProfile = profile.getFunctionProfile(&F)) {
+      if (functionProfile->firstExecution)
+        firstExecution = functionProfile->firstExecution;
+    }
+    order.emplace_back(firstExecution, &F);
+  }
+  std::stable_sort(
+      order.begin(),
+      order.end(),
+      [](const std::pair<uint64_t, Function *> &a,
+         const std::pair<uint64_t, Function *> &b) {
+        return a.first < b.first;
+      });
+
+  auto &functions = M->getFunctionList();
+  for (auto &entry : order)
+    functions.splice(functions.end(), functions, entry.second->getIterator());
+}
+
 } // namespace
 
 std::unique_ptr<BytecodeModule> hbc::generateBytecodeModule(
@@ -171,6 +261,10 @@ std::unique_ptr<BytecodeModule> hbc::generateBytecodeModule(
   if (options.format == DumpLIR)
     M->dump();
 
+  const ExecutionProfile *profile = M->getContext().getExecutionProfile();
+  if (profile)
+    orderFunctionsByFirstExecution(M, *profile);
+
   BytecodeModuleGenerator BMGen(options);
 
   if (segment) {
@@ -219,8 +313,12 @@ std::unique_ptr<BytecodeModule> hbc::generateBytecodeModule(
       traverseCJSModuleNames(M, shouldGenerate, addString);
     }
 
+    // With a profile, the strings were found in the order in which their
+    // functions first ran, which is worth keeping.
     BMGen.initializeStringTable(UniquingStringLiteralAccumulator::toTable(
-        std::move(strings), options.optimizationEnabled));
+        std::move(strings),
+        options.optimizationEnabled,
+        /* keepInsertionOrder */ profile != nullptr));
   }
 
   // Add each function to BMGen so that each function has a unique ID.
@@ -251,64 +349,66 @@ std::unique_ptr<BytecodeModule> hbc::generateBytecodeModule(
   // Allow reusing the debug cache between functions
   HBCISelDebugCache debugCache;
 
-  // Bytecode generation for each function.
-  for (auto &F : *M) {
-    if (!shouldGenerate(&F)) {
-      continue;
-    }
-
-    std::unique_ptr<BytecodeFunctionGenerator> funcGen;
-
-    if (F.isLazy()) {
-      funcGen = BytecodeFunctionGenerator::create(BMGen, 0);
-    } else {
-      HVMRegisterAllocator RA(&F);
-      if (!options.optimizationEnabled) {
-        RA.setFastPassThreshold(kFastRegisterAllocationThreshold);
-        RA.setMemoryLimit(kRegisterAllocationMemoryLimit);
-      }
-      PostOrderAnalysis PO(&F);
-      /// The order of the blocks is reverse-post-order, which is a simply
-      /// topological sort.
-      llvh::SmallVector<BasicBlock *, 16> order(PO.rbegin(), PO.rend());
-      RA.allocate(order);
-
-      if (options.format == DumpRA) {
-        RA.dump();
-      }
-
-      PassManager PM;
-      PM.addPass(new LowerStoreInstrs(RA));
-      PM.addPass(new LowerCalls(RA));
-      if (options.optimizationEnabled) {
-        PM.addPass(new MovElimination(RA));
-        PM.addPass(new RecreateCheapValues(RA));
-        PM.addPass(new LoadConstantValueNumbering(RA));
-      }
-      PM.addPass(new SpillRegisters(RA));
-      if (options.basicBlockProfiling) {
-        // Insert after all other passes so that it sees final basic block
-        // list.
-        PM.addPass(new InsertProfilePoint());
+  // Register allocation and the lowering that depends on it only touch the
+  // function being generated, so they may run on several threads, a batch of
+  // functions at a time. Instruction selection fills in tables shared by the
+  // whole module, so it runs on this thread in module order, which keeps the
+  // bytecode independent of the number of threads. Dumping the IR of each
+  // function requires a single thread to keep the output in order.
+  unsigned numThreads = options.numThreads;
+  if (options.format == DumpRA || options.format == DumpLRA ||
+      options.format == DumpPostRA ||
+      M->getContext().getCodeGenerationSettings().dumpIRBetweenPasses) {
+    numThreads = 1;
+  }
+  const size_t batchSize =
+      numThreads > 1 ? size_t(numThreads) * kFunctionsPerThreadBatch : 1;
+  llvh::Optional<ConcurrentIRScope> concurrentIR;
+  if (numThreads > 1)
+    concurrentIR.emplace();
+
+  std::vector<Function *> batch;
+  std::vector<std::unique_ptr<HVMRegisterAllocator>> allocations;
+  auto generateBatch = [&]() {
+    allocations.clear();
+    allocations.resize(batch.size());
+    parallelFor(batch.size(), numThreads, [&](size_t i) {
+      if (!batch[i]->isLazy())
+        allocations[i] = allocateRegisters(batch[i], options);
+    });
+
+    // Bytecode generation for each function.
+    for (size_t i = 0, e = batch.size(); i < e; ++i) {
+      Function *F = batch[i];
+      std::unique_ptr<BytecodeFunctionGenerator> funcGen;
+
+      if (F->isLazy()) {
+        funcGen = BytecodeFunctionGenerator::create(BMGen, 0);
+      } else {
+        HVMRegisterAllocator &RA = *allocations[i];
+        funcGen =
+            BytecodeFunctionGenerator::create(BMGen, RA.getMaxRegisterUsage());
+        HBCISel hbciSel(F, funcGen.get(), RA, scopeAnalysis, options);
+        hbciSel.populateDebugCache(debugCache);
+        hbciSel.generate(sourceMapGen);
+        debugCache = hbciSel.getDebugCache();
       }
-      PM.run(&F);
-
-      if (options.format == DumpLRA)
-        RA.dump();
-
-      if (options.format == DumpPostRA)
-        F.dump();
 
-      funcGen =
-          BytecodeFunctionGenerator::create(BMGen, RA.getMaxRegisterUsage());
-      HBCISel hbciSel(&F, funcGen.get(), RA, scopeAnalysis, options);
-      hbciSel.populateDebugCache(debugCache);
-      hbciSel.generate(sourceMapGen);
-      debugCache = hbciSel.getDebugCache();
+      BMGen.setFunctionGenerator(F, std::move(funcGen));
+      allocations[i].reset();
     }
+    batch.clear();
+  };
 
-    BMGen.setFunctionGenerator(&F, std::move(funcGen));
+  for (auto &F : *M) {
+    if (!shouldGenerate(&F)) {
+      continue;
+    }
+    batch.push_back(&F);
+    if (batch.size() == batchSize)
+      generateBatch();
   }
+  generateBatch();
 
   return BMGen.generate();
 }
@@ -11,10 +11,12 @@
 #include "hermes/BCGen/HBC/BytecodeGenerator.h"
 #include "hermes/BCGen/HBC/HBC.h"
 #include "hermes/IR/Analysis.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/SourceMap/SourceMapGenerator.h"
 #include "hermes/Support/Statistic.h"
 
 #include "llvh/ADT/Optional.h"
+#include "llvh/ADT/SmallPtrSet.h"
 
 #define DEBUG_TYPE "hbc-backend-isel"
 
@@ -36,6 +38,12 @@ STATISTIC(
 STATISTIC(
     NumCacheSlots,
     "Number of cache slots allocated for all put/get property instructions");
+STATISTIC(
+    NumProfiledLayouts,
+    "Number of functions whose blocks were laid out using a profile");
+STATISTIC(
+    NumColdBlocks,
+    "Number of never executed blocks moved to the end of their function");
 
 /// Given a list of basic blocks \p blocks linearized into the order they will
 /// be generated, \return the set of those basic blocks containing backwards
@@ -55,6 +63,68 @@ static DenseSet<const BasicBlock *> basicBlocksWithBackwardSuccessors(
   return result;
 }
 
+/// Reorder the blocks of \p F, given in reverse post order in \p order, using
+/// the execution counts \p counts of the blocks in the order of the function's
+/// block list. Each block is followed by the successor it most often branched
+/// to, unless that was placed already, so that the hot path falls through, and
+/// the blocks that never executed are moved to the end, in their original
+/// order.
+static void layoutBlocksWithProfile(
+    Function *F,
+    llvh::SmallVectorImpl<BasicBlock *> &order,
+    llvh::ArrayRef<uint64_t> counts) {
+  llvh::DenseMap<const BasicBlock *, uint64_t> blockCounts;
+  unsigned index = 0;
+  for (BasicBlock &BB : *F)
+    blockCounts[&BB] = counts[index++];
+  // Nothing can be learned about a function that never ran.
+  if (!blockCounts[order.front()])
+    return;
+
+  // The number of times the edge from BB to succ was taken is the count of
+  // succ if BB is its only predecessor. Otherwise it is estimated as what is
+  // left of the count of BB after the edges to such successors.
+  auto edgeCount = [&blockCounts](BasicBlock *BB, BasicBlock *succ) {
+    if (pred_count_unique(succ) == 1)
+      return blockCounts[succ];
+    uint64_t count = blockCounts[BB];
+    for (BasicBlock *other : successors(BB)) {
+      if (other != succ && pred_count_unique(other) == 1)
+        count -= std::min(count, blockCounts[other]);
+    }
+    return std::min(count, blockCounts[succ]);
+  };
+
+  llvh::SmallVector<BasicBlock *, 16> layout;
+  llvh::SmallPtrSet<const BasicBlock *, 16> placed;
+  for (BasicBlock *start : order) {
+    if (placed.count(start) || !blockCounts[start])
+      continue;
+    for (BasicBlock *BB = start; BB;) {
+      layout.push_back(BB);
+      placed.insert(BB);
+      BasicBlock *hottest = nullptr;
+      uint64_t hottestCount = 0;
+      for (BasicBlock *succ : successors(BB)) {
+        uint64_t count = placed.count(succ) ? 0 : edgeCount(BB, succ);
+        if (count > hottestCount) {
+          hottest = succ;
+          hottestCount = count;
+        }
+      }
+      BB = hottest;
+    }
+  }
+  for (BasicBlock *BB : order) {
+    if (!placed.count(BB)) {
+      layout.push_back(BB);
+      ++NumColdBlocks;
+    }
+  }
+  order.assign(layout.begin(), layout.end());
+  ++NumProfiledLayouts;
+}
+
 void HVMRegisterAllocator::handleInstruction(Instruction *I) {
   if (auto *CI = llvh::dyn_cast<CallInst>(I)) {
     return allocateCallInst(CI);
@@ -266,6 +336,16 @@ void HBCISel::addDebugSourceLocationInfo(SourceMapGenerator *outSourceMap) {
     BCFGen_->addDebugSourceLocation(info);
   }
 
+  // Profiled functions are identified by their location, so give them one even
+  // if none of their instructions has a location.
+  if (!hasDebugInfo && bytecodeGenerationOptions_.basicBlockProfiling &&
+      getDebugSourceLocation(manager, F_->getSourceRange().Start, &info)) {
+    info.address = 0;
+    info.statement = 0;
+    BCFGen_->addDebugSourceLocation(info);
+    hasDebugInfo = true;
+  }
+
   // If there's no debug info, don't set the function location.
   // This avoids polluting the string table with source file names.
   if (hasDebugInfo) {
@@ -446,6 +526,8 @@ void HBCISel::generateBinaryOperatorInst(
 
   bool isBothNumber = Inst->getLeftHandSide()->getType().isNumberType() &&
       Inst->getRightHandSide()->getType().isNumberType();
+  bool isBothString = Inst->getLeftHandSide()->getType().isStringType() &&
+      Inst->getRightHandSide()->getType().isStringType();
 
   using OpKind = BinaryOperatorInst::OpKind;
 
@@ -488,6 +570,8 @@ void HBCISel::generateBinaryOperatorInst(
     case OpKind::AddKind: // +   (+=)
       if (isBothNumber) {
         BCFGen_->emitAddN(res, left, right);
+      } else if (isBothString) {
+        BCFGen_->emitAddS(res, left, right);
       } else {
         BCFGen_->emitAdd(res, left, right);
       }
@@ -696,7 +780,12 @@ void HBCISel::generateLoadPropertyInst(
   }
 
   auto propReg = encodeValue(prop);
-  BCFGen_->emitGetByVal(resultReg, objReg, propReg);
+  if (Inst->getObject()->getType().isObjectType() &&
+      prop->getType().isNumberType()) {
+    BCFGen_->emitGetByValN(resultReg, objReg, propReg);
+  } else {
+    BCFGen_->emitGetByVal(resultReg, objReg, propReg);
+  }
 }
 
 void HBCISel::generateTryLoadGlobalPropertyInst(
@@ -942,6 +1031,8 @@ void HBCISel::generateResumeGeneratorInst(
 
 void HBCISel::generateCondBranchInst(CondBranchInst *Inst, BasicBlock *next) {
   auto condReg = encodeValue(Inst->getCondition());
+  // A condition known to be a boolean doesn't need to be converted.
+  bool isBoolean = Inst->getCondition()->getType().isBooleanType();
 
   BasicBlock *trueBlock = Inst->getTrueDest();
   BasicBlock *falseBlock = Inst->getFalseDest();
@@ -949,14 +1040,16 @@ void HBCISel::generateCondBranchInst(CondBranchInst *Inst, BasicBlock *next) {
   // Emit a conditional jump to the 'False' destination and a fall-through to
   // the 'True' side.
   if (next == trueBlock) {
-    auto loc = BCFGen_->emitJmpFalseLong(0, condReg);
+    auto loc = isBoolean ? BCFGen_->emitJmpFalseBLong(0, condReg)
+                         : BCFGen_->emitJmpFalseLong(0, condReg);
     registerLongJump(loc, falseBlock);
     return;
   }
 
   // Emit a conditional jump to the 'True' destination and a fall-through to the
   // 'False' side.
-  auto loc = BCFGen_->emitJmpTrueLong(0, condReg);
+  auto loc = isBoolean ? BCFGen_->emitJmpTrueBLong(0, condReg)
+                       : BCFGen_->emitJmpTrueLong(0, condReg);
   registerLongJump(loc, trueBlock);
 
   // Try to eliminate the branch by using a fall-through. If the destination
@@ -1596,6 +1689,11 @@ void HBCISel::generate(SourceMapGenerator *outSourceMap) {
   /// The order of the blocks is reverse-post-order, which is a simply
   /// topological sort.
   llvh::SmallVector<BasicBlock *, 16> order(PO.rbegin(), PO.rend());
+  if (auto *profile = F_->getContext().getExecutionProfile()) {
+    auto counts = profile->getBlockCounts(F_);
+    if (!counts.empty())
+      layoutBlocksWithProfile(F_, order, counts);
+  }
 
   // If we are compiling with debugger or otherwise need async break checks,
   // decide which blocks need runtime async break checks: blocks with backwards
@@ -67,7 +67,8 @@ std::vector<StringKind::Entry> StringLiteralTable::getStringKinds() const {
 
 /* static */ StringLiteralTable UniquingStringLiteralAccumulator::toTable(
     UniquingStringLiteralAccumulator accum,
-    bool optimize) {
+    bool optimize,
+    bool keepInsertionOrder) {
   auto &storage = accum.storage_;
   auto &strings = accum.strings_;
   auto &isIdentifier = accum.isIdentifier_;
@@ -158,14 +159,26 @@ std::vector<StringKind::Entry> StringLiteralTable::getStringKinds() const {
     return ix;
   };
 
-  // Sort indices within each frequency class by kind, and alphabetically.
+  // Sort indices within each frequency class by kind, and alphabetically or
+  // by insertion order.
   const auto indicesFrom = [&remap, &indices](size_t ix) {
     return indices.begin() + remap(ix);
   };
+  const auto byKindAndOrigIndex = [](const Index &a, const Index &b) {
+    return std::make_tuple(a.kind, a.origIndex) <
+        std::make_tuple(b.kind, b.origIndex);
+  };
+  const auto sortIndices = [&](size_t from, size_t to) {
+    if (keepInsertionOrder) {
+      std::sort(indicesFrom(from), indicesFrom(to), byKindAndOrigIndex);
+    } else {
+      std::sort(indicesFrom(from), indicesFrom(to));
+    }
+  };
 
-  std::sort(indicesFrom(0), indicesFrom(UINT8_MAX));
-  std::sort(indicesFrom(UINT8_MAX), indicesFrom(UINT16_MAX));
-  std::sort(indicesFrom(UINT16_MAX), indicesFrom(SIZE_MAX));
+  sortIndices(0, UINT8_MAX);
+  sortIndices(UINT8_MAX, UINT16_MAX);
+  sortIndices(UINT16_MAX, SIZE_MAX);
 
   { // Add the new strings to the storage.
     std::vector<llvh::StringRef> refs;
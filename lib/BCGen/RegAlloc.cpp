@@ -12,6 +12,7 @@
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/IR/Instrs.h"
 #include "hermes/Support/PerfSection.h"
+#include "hermes/Support/Statistic.h"
 #include "hermes/Utils/Dumper.h"
 
 #include "llvh/ADT/PostOrderIterator.h"
@@ -19,10 +20,15 @@
 #include "llvh/Support/Debug.h"
 #include "llvh/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <queue>
 
 #define DEBUG_TYPE "regalloc"
 
+STATISTIC(
+    NumMovsEliminated,
+    "Number of Movs and stack loads allocated to the register they read");
+
 using namespace hermes;
 
 using llvh::cast;
@@ -240,6 +246,34 @@ void RegisterAllocator::lowerPhis(ArrayRef<BasicBlock *> order) {
       }
     }
   }
+
+  // Given a sequence of MOVs that was generated by the PHI lowering, try to
+  // shorten the lifetime of intervals by reusing copies. For example, we
+  // shorten the lifetime of %0 by making %2 use %1. This is done before the
+  // live intervals are calculated, so that they reflect the shorter lifetime.
+  // %1 = MovInst %0
+  // %2 = MovInst %0
+  for (BasicBlock *BB : order) {
+    DenseMap<Value *, MovInst *> lastCopy;
+
+    for (Instruction &I : *BB) {
+      auto *mov = llvh::dyn_cast<MovInst>(&I);
+      if (!mov)
+        continue;
+
+      Value *op = mov->getSingleOperand();
+      if (llvh::isa<Literal>(op))
+        continue;
+
+      // If we've made a copy inside this basic block then use the copy.
+      auto it = lastCopy.find(op);
+      if (it != lastCopy.end()) {
+        mov->setOperand(it->second, 0);
+      }
+
+      lastCopy[op] = mov;
+    }
+  }
 }
 
 void RegisterAllocator::calculateLocalLiveness(
@@ -429,32 +463,38 @@ void RegisterAllocator::coalesce(
     }
   }
 
-  // Given a sequence of MOVs that was generated by the PHI lowering, try to
-  // shorten the lifetime of intervals by reusing copies. For example, we
-  // shorten the lifetime of %0 by making %2 use %1.
-  // %1 = MovInst %0
-  // %2 = MovInst %0
-  for (BasicBlock *BB : order) {
-    DenseMap<Value *, MovInst *> lastCopy;
-
-    for (Instruction &I : *BB) {
-      auto *mov = llvh::dyn_cast<MovInst>(&I);
-      if (!mov)
-        continue;
+  /// \return the instruction whose interval \p I was merged into, or \p I if
+  /// it was not merged. Merged intervals are always remapped to the final
+  /// destination, so a single lookup is enough.
+  auto findDest = [&map](Instruction *I) {
+    auto it = map.find(I);
+    return it == map.end() ? I : it->second;
+  };
 
-      Value *op = mov->getSingleOperand();
-      if (llvh::isa<Literal>(op))
-        continue;
+  /// Merge the interval of \p src, and all the intervals merged into it,
+  /// into the interval of \p dest.
+  auto merge = [this, &map](Instruction *src, Instruction *dest) {
+    unsigned destIdx = getInstructionNumber(dest);
+    unsigned srcIdx = getInstructionNumber(src);
+    Interval &srcIvl = instructionInterval_[srcIdx];
 
-      // If we've made a copy inside this basic block then use the copy.
-      auto it = lastCopy.find(op);
-      if (it != lastCopy.end()) {
-        mov->setOperand(it->second, 0);
+    LLVM_DEBUG(
+        dbgs() << "Coalescing instruction @" << srcIdx << "  " << srcIvl
+               << " -> @" << destIdx << "  " << instructionInterval_[destIdx]
+               << "\n");
+
+    for (auto &it : map) {
+      if (it.second == src) {
+        LLVM_DEBUG(
+            dbgs() << "Remapping @" << getInstructionNumber(it.first)
+                   << " from @" << srcIdx << " to @" << destIdx << "\n");
+        it.second = dest;
       }
-
-      lastCopy[op] = mov;
     }
-  }
+
+    instructionInterval_[destIdx].add(srcIvl);
+    map[src] = dest;
+  };
 
   // Optimize the program by coalescing multiple live intervals into a single
   // long interval. This phase is optional.
@@ -465,54 +505,67 @@ void RegisterAllocator::coalesce(
         continue;
 
       auto *op = llvh::dyn_cast<Instruction>(mov->getSingleOperand());
-      if (!op)
+      if (!op || !hasInstructionNumber(op))
         continue;
 
-      // Don't coalesce intervals that are already coalesced to other intervals
-      // or that there are other intervals that are coalesced into it, or if
-      // the interval is pre-allocated.
-      if (map.count(op) || isAllocated(op) || isAllocated(mov))
+      // The operand and the MOV may both have been merged into other intervals
+      // already, like the PHI nodes and the MOVs that feed them. Try to merge
+      // the interval of the operand into the interval of the MOV.
+      Instruction *src = findDest(op);
+      Instruction *dest = findDest(mov);
+      if (src == dest)
         continue;
 
-      // If the MOV is already coalesced into some other interval then merge the
-      // operand into that interval.
-      Instruction *dest = mov;
+      // Don't coalesce intervals that are pre-allocated.
+      if (isAllocated(src) || isAllocated(dest))
+        continue;
 
       // Don't handle instructions with target specific lowering because this
       // means that we won't release them (and call the target specific hook)
       // until the whole register is freed.
-      if (isManuallyAllocatedInterval(op))
+      if (hasTargetSpecificLowering(src))
         continue;
 
-      // If the mov is already merged into another interval then find the
-      // destination interval and try to merge the current interval into it.
-      while (map.count(dest)) {
-        dest = map[dest];
-      }
-
       unsigned destIdx = getInstructionNumber(dest);
-      unsigned opIdx = getInstructionNumber(op);
-      Interval &destIvl = instructionInterval_[destIdx];
-      Interval &opIvl = instructionInterval_[opIdx];
+      unsigned srcIdx = getInstructionNumber(src);
+      if (instructionInterval_[destIdx].intersects(
+              instructionInterval_[srcIdx]))
+        continue;
 
-      if (destIvl.intersects(opIvl))
+      merge(src, dest);
+    }
+  }
+
+  // A stack location has a register of its own, so a load from it can use that
+  // register as long as the location is not written while the loaded value is
+  // live.
+  for (BasicBlock *BB : order) {
+    for (Instruction &I : *BB) {
+      auto *load = llvh::dyn_cast<LoadStackInst>(&I);
+      if (!load || map.count(load) || isAllocated(load))
         continue;
 
-      LLVM_DEBUG(
-          dbgs() << "Coalescing instruction @" << opIdx << "  " << opIvl
-                 << " -> @" << destIdx << "  " << destIvl << "\n");
+      auto *alloc = load->getPtr();
+      Instruction *dest = findDest(alloc);
+      if (isAllocated(dest))
+        continue;
 
-      for (auto &it : map) {
-        if (it.second == op) {
-          LLVM_DEBUG(
-              dbgs() << "Remapping @" << getInstructionNumber(it.first)
-                     << " from @" << opIdx << " to @" << destIdx << "\n");
-          it.second = dest;
+      Interval &loadIvl = getInstructionInterval(load);
+      bool clobbered = false;
+      for (auto *U : alloc->getUsers()) {
+        auto *store = llvh::dyn_cast<StoreStackInst>(U);
+        if (!store || !hasInstructionNumber(store))
+          continue;
+        unsigned storeIdx = getInstructionNumber(store);
+        if (loadIvl.intersects(Segment(storeIdx, storeIdx + 1))) {
+          clobbered = true;
+          break;
         }
       }
+      if (clobbered)
+        continue;
 
-      instructionInterval_[destIdx].add(opIvl);
-      map[op] = dest;
+      merge(load, dest);
     }
   }
 }
@@ -631,105 +684,159 @@ void RegisterAllocator::allocate(ArrayRef<BasicBlock *> order) {
 
   coalesce(coalesced, order);
 
-  // Compare two intervals and return the one that starts first.
-  auto startsFirst = [&](unsigned a, unsigned b) {
-    Interval &IA = instructionInterval_[a];
-    Interval &IB = instructionInterval_[b];
-    return IA.start() < IB.start() || (IA.start() == IB.start() && a < b);
-  };
-
-  // Compare two intervals and return the one that starts first. If two
-  // intervals end at the same place, schedule the instruction before the
-  // operands.
+  // Allocate the intervals in the order in which they start. An interval may
+  // have holes, like a value that is used before a loop and after it but not
+  // inside it, and another interval may use the same register in those holes.
+  // This gives the effect of splitting live ranges at their holes, without
+  // the MOVs, and keeps the frame small. A register is available to an
+  // interval if no interval that was allocated to it intersects the new one.
+  using InstList = llvh::SmallVector<unsigned, 32>;
 
-  auto endsFirst = [&](unsigned a, unsigned b) {
-    auto &aInterval = instructionInterval_[a];
-    auto &bInterval = instructionInterval_[b];
-    if (bInterval.end() == aInterval.end()) {
-      return bInterval.start() > aInterval.start() ||
-          (bInterval.start() == aInterval.start() && b > a);
-    }
-    return bInterval.end() > aInterval.end();
+  unsigned numIntervals = getMaxInstrIndex();
+  llvh::SmallVector<size_t, 32> starts(numIntervals);
+  llvh::SmallVector<size_t, 32> ends(numIntervals);
+  InstList intervals;
+  for (unsigned i = 0; i < numIntervals; i++) {
+    // Don't try to allocate registers that were merged into other live
+    // intervals.
+    if (coalesced.count(instructionsByNumbers_[i]))
+      continue;
+    instructionInterval_[i] = instructionInterval_[i].compress();
+    starts[i] = instructionInterval_[i].start();
+    ends[i] = instructionInterval_[i].end();
+    intervals.push_back(i);
+  }
+  std::sort(intervals.begin(), intervals.end(), [&](unsigned a, unsigned b) {
+    return starts[a] < starts[b] || (starts[a] == starts[b] && a < b);
+  });
+
+  // Returns true if the interval \p a ends after the interval \p b, so that
+  // the live interval that ends first is at the top of the queue.
+  auto endsLater = [&](unsigned a, unsigned b) {
+    return ends[a] > ends[b] || (ends[a] == ends[b] && a > b);
   };
 
-  using InstList = llvh::SmallVector<unsigned, 32>;
-
-  std::priority_queue<unsigned, InstList, decltype(endsFirst)> intervals(
-      endsFirst);
+  // The allocated intervals that have not ended yet, and the number of them
+  // that use each register. A register is used in the register file as long
+  // as some interval that was allocated to it has not ended.
+  std::priority_queue<unsigned, InstList, decltype(endsLater)> liveIntervals(
+      endsLater);
+  llvh::SmallVector<unsigned, 32> numLiveIntervals;
+
+  // A live interval without holes intersects every interval that starts
+  // before it ends, so its register is blocked without looking at it. Only the
+  // live intervals with holes need to be checked against the new interval.
+  llvh::SmallVector<unsigned, 32> numSolidIntervals;
+  BitVector solid;
+  InstList holeyIntervals;
+
+  auto hasHoles = [&](unsigned idx) {
+    return instructionInterval_[idx].segments_.size() > 1;
+  };
 
-  for (int i = 0, e = getMaxInstrIndex(); i < e; i++) {
-    intervals.push(i);
-  }
+  // Frees the register of the interval of the instruction number \p idx,
+  // unless another live interval still uses it.
+  auto release = [&](unsigned idx) {
+    Instruction *I = instructionsByNumbers_[idx];
+    Register R = getRegister(I);
+    unsigned reg = R.getIndex();
+    LLVM_DEBUG(
+        dbgs() << "\t Deleting interval " << instructionInterval_[idx]
+               << " that's allocated to register " << R
+               << " used by instruction " << I->getName() << "\n");
+    if (!hasHoles(idx) && --numSolidIntervals[reg] == 0)
+      solid.reset(reg);
+    if (--numLiveIntervals[reg] == 0)
+      file.killRegister(R);
+    handleInstruction(I);
+  };
 
-  std::priority_queue<unsigned, InstList, decltype(startsFirst)>
-      liveIntervalsQueue(startsFirst);
+  // The registers that are used by live intervals that intersect the current
+  // interval.
+  BitVector blocked;
 
   // Perform the register allocation:
-  while (!intervals.empty()) {
-    unsigned instIdx = intervals.top();
-    intervals.pop();
+  for (unsigned instIdx : intervals) {
     Instruction *inst = instructionsByNumbers_[instIdx];
     Interval &instInterval = instructionInterval_[instIdx];
-    unsigned currentIndex = instInterval.end();
+    size_t currentIndex = starts[instIdx];
 
     LLVM_DEBUG(
         dbgs() << "Looking at index " << currentIndex << ": " << instInterval
                << " " << inst->getName() << "\n");
 
-    // Free all of the intervals that start after the current index.
-    while (!liveIntervalsQueue.empty()) {
-      LLVM_DEBUG(
-          dbgs() << "\t Cleaning up for index " << currentIndex << " PQ("
-                 << liveIntervalsQueue.size() << ")\n");
-
-      unsigned topIdx = liveIntervalsQueue.top();
-      Interval &range = instructionInterval_[topIdx];
-      LLVM_DEBUG(dbgs() << "\t Earliest interval: " << range << "\n");
-
-      // Flush empty intervals and intervals that finished after our index.
-      bool nonEmptyInterval = range.size();
-      if (range.start() < currentIndex && nonEmptyInterval) {
-        break;
-      }
-
-      liveIntervalsQueue.pop();
-
-      Instruction *I = instructionsByNumbers_[topIdx];
-      Register R = getRegister(I);
-      LLVM_DEBUG(
-          dbgs() << "\t Reached idx #" << currentIndex << " deleting inverval "
-                 << range << " that's allocated to register " << R
-                 << " used by instruction " << I->getName() << "\n");
-      file.killRegister(R);
-
-      handleInstruction(I);
-    }
-
-    // Don't try to allocate registers that were merged into other live
-    // intervals.
-    if (coalesced.count(inst)) {
-      continue;
+    // Free the intervals that ended before the current one starts.
+    while (!liveIntervals.empty() &&
+           ends[liveIntervals.top()] <= currentIndex) {
+      release(liveIntervals.top());
+      liveIntervals.pop();
     }
+    holeyIntervals.erase(
+        std::remove_if(
+            holeyIntervals.begin(),
+            holeyIntervals.end(),
+            [&](unsigned idx) { return ends[idx] <= currentIndex; }),
+        holeyIntervals.end());
+
+    unsigned numRegs = file.getMaxRegisterUsage();
+    numLiveIntervals.resize(numRegs);
+    numSolidIntervals.resize(numRegs);
+    solid.resize(numRegs);
 
     // Allocate a register for the live interval that we are currently handling.
     if (!isAllocated(inst)) {
-      Register R = file.allocateRegister();
+      blocked = solid;
+      for (unsigned liveIdx : holeyIntervals) {
+        unsigned reg = getRegister(instructionsByNumbers_[liveIdx]).getIndex();
+        if (!blocked.test(reg) && starts[liveIdx] < ends[instIdx] &&
+            instructionInterval_[liveIdx].intersects(instInterval))
+          blocked.set(reg);
+      }
+
+      // Skip the registers that are used without a live interval, which were
+      // reserved.
+      int reg = blocked.find_first_unset();
+      while (reg >= 0 && file.isUsed(Register(reg)) && !numLiveIntervals[reg])
+        reg = blocked.find_next_unset(reg);
+
+      Register R;
+      if (reg >= 0 && file.isUsed(Register(reg))) {
+        // The register is only used by intervals that live in the holes of
+        // this one.
+        R = Register(reg);
+      } else {
+        // All of the registers before the first free one are blocked, so this
+        // is the lowest available register, or a new one.
+        R = file.allocateRegister();
+        assert(
+            (reg < 0 || R.getIndex() == (unsigned)reg) &&
+            "Expected the first free register");
+      }
       updateRegister(inst, R);
     }
 
     // Mark the current instruction as live and remember to perform target
     // specific calls when we are done with the bundle.
-    liveIntervalsQueue.push(instIdx);
+    unsigned reg = getRegister(inst).getIndex();
+    if (numLiveIntervals.size() <= reg) {
+      numLiveIntervals.resize(reg + 1);
+      numSolidIntervals.resize(reg + 1);
+      solid.resize(reg + 1);
+    }
+    ++numLiveIntervals[reg];
+    if (hasHoles(instIdx)) {
+      holeyIntervals.push_back(instIdx);
+    } else {
+      ++numSolidIntervals[reg];
+      solid.set(reg);
+    }
+    liveIntervals.push(instIdx);
   } // For each instruction in the function.
 
   // Free the remaining intervals.
-  while (!liveIntervalsQueue.empty()) {
-    Instruction *I = instructionsByNumbers_[liveIntervalsQueue.top()];
-    LLVM_DEBUG(
-        dbgs() << "Free register used by instruction " << I->getName() << "\n");
-    file.killRegister(getRegister(I));
-    handleInstruction(I);
-    liveIntervalsQueue.pop();
+  while (!liveIntervals.empty()) {
+    release(liveIntervals.top());
+    liveIntervals.pop();
   }
 
   // Allocate registers for the coalesced registers.
@@ -738,6 +845,16 @@ void RegisterAllocator::allocate(ArrayRef<BasicBlock *> order) {
     Instruction *dest = RP.second;
     updateRegister(RP.first, getRegister(dest));
   }
+
+  // Count the copies that no longer need to be emitted.
+  for (auto &RP : coalesced) {
+    Instruction *I = RP.first;
+    if (!llvh::isa<MovInst>(I) && !llvh::isa<LoadStackInst>(I))
+      continue;
+    auto *op = llvh::dyn_cast<Instruction>(I->getOperand(0));
+    if (op && isAllocated(op) && getRegister(op) == getRegister(I))
+      ++NumMovsEliminated;
+  }
 }
 
 void RegisterAllocator::calculateLiveIntervals(ArrayRef<BasicBlock *> order) {
@@ -18,6 +18,7 @@
 #include "hermes/ConsoleHost/ConsoleHost.h"
 #include "hermes/FlowParser/FlowParser.h"
 #include "hermes/IR/Analysis.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IR.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/IR/IRVerifier.h"
@@ -51,6 +52,7 @@
 #include "zip/src/zip.h"
 
 #include <sstream>
+#include <thread>
 
 #define DEBUG_TYPE "hermes"
 
@@ -512,6 +514,15 @@ static opt<bool> ReusePropCache(
 static CLFlag
     Inline('f', "inline", true, "inlining of functions", CompilerCategory);
 
+static opt<unsigned> InlineThreshold(
+    "Xinline-threshold",
+    desc(
+        "Maximum number of instructions of a function that is inlined at "
+        "several call sites"),
+    init(OptimizationSettings().inlineThreshold),
+    Hidden,
+    cat(CompilerCategory));
+
 static CLFlag Outline(
     'f',
     "outline",
@@ -544,6 +555,26 @@ static opt<std::string> BaseBytecodeFile(
     llvh::cl::init(""),
     cat(CompilerCategory));
 
+static opt<std::string> ProfileUse(
+    "profile-use",
+    desc(
+        "Guide optimization with the execution counts written by "
+        "hermes -profile-generate"),
+    cat(CompilerCategory));
+
+static opt<unsigned> Threads(
+    "threads",
+    desc(
+        "Number of threads used to optimize and generate bytecode, or 0 for "
+        "one per core. The output does not depend on it."),
+    init(1),
+    cat(CompilerCategory));
+
+static llvh::cl::alias _Threads(
+    "j",
+    desc("Alias for --threads"),
+    llvh::cl::aliasopt(Threads));
+
 static opt<unsigned> PadFunctionBodiesPercent(
     "pad-function-bodies-percent",
     desc(
@@ -1023,6 +1054,13 @@ static void setWarningsAreErrorsFromFlags(SourceErrorManager &sm) {
   }
 }
 
+/// \return the number of threads to compile with, respecting the command line
+/// flags.
+unsigned numThreadsFromFlags() {
+  return cl::Threads ? cl::Threads
+                     : std::max(1u, std::thread::hardware_concurrency());
+}
+
 /// Create a Context, respecting the command line flags.
 /// \return the Context.
 std::shared_ptr<Context> createContext(
@@ -1048,6 +1086,10 @@ std::shared_ptr<Context> createContext(
 
   optimizationOpts.inlining = cl::OptimizationLevel != cl::OptLevel::O0 &&
       cl::BytecodeFormat == cl::BytecodeFormatKind::HBC && cl::Inline;
+  // When collecting a profile, don't copy functions into several call sites,
+  // so that the functions whose inlining depends on the profile are profiled.
+  optimizationOpts.inlineThreshold =
+      cl::BasicBlockProfiling ? 0 : (unsigned)cl::InlineThreshold;
   optimizationOpts.outlining =
       cl::OptimizationLevel != cl::OptLevel::O0 && cl::Outline;
 
@@ -1058,6 +1100,7 @@ std::shared_ptr<Context> createContext(
   optimizationOpts.staticBuiltins =
       cl::StaticBuiltins == cl::StaticBuiltinSetting::ForceOn;
   optimizationOpts.staticRequire = cl::StaticRequire;
+  optimizationOpts.numThreads = numThreadsFromFlags();
 
   auto context = std::make_shared<Context>(
       codeGenOpts,
@@ -1139,6 +1182,20 @@ std::shared_ptr<Context> createContext(
   return context;
 }
 
+/// Read the execution profile named by -profile-use into \p context.
+/// \return false on failure, after printing an error message.
+static bool loadExecutionProfile(Context &context) {
+  auto profileBuf = memoryBufferFromFile(cl::ProfileUse, /*stdinOk*/ false);
+  if (!profileBuf)
+    return false;
+  SourceErrorManager sm;
+  auto profile = ExecutionProfile::parse(profileBuf->getMemBufferRef(), sm);
+  if (!profile)
+    return false;
+  context.setExecutionProfile(std::move(profile));
+  return true;
+}
+
 /// Parse \p file into a JSON value.
 /// \param alloc the allocator to use for JSON parsing.
 /// \return a metadata JSONObject allocated in the user-specified allocator,
@@ -1955,6 +2012,7 @@ CompileResult processSourceFiles(
       cl::OutputSourceMap || cl::DebugInfoLevel == cl::DebugLevel::g0;
 
   genOptions.stripFunctionNames = cl::StripFunctionNames;
+  genOptions.numThreads = numThreadsFromFlags();
 
   // If the dump target is None, return bytecode in an executable form.
   if (cl::DumpTarget == Execute) {
@@ -2180,6 +2238,8 @@ CompileResult compileFromCommandLineOptions() {
   } else {
     std::shared_ptr<Context> context =
         createContext(std::move(resolutionTable), std::move(segments));
+    if (!cl::ProfileUse.empty() && !loadExecutionProfile(*context))
+      return InputFileError;
     return processSourceFiles(context, std::move(fileBufs));
   }
 }
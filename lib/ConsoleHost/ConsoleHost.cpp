@@ -15,6 +15,7 @@
 #include "hermes/VM/JSObject.h"
 #include "hermes/VM/MockedEnvironment.h"
 #include "hermes/VM/NativeArgs.h"
+#include "hermes/VM/Profiler/ExecutionProfiler.h"
 #include "hermes/VM/Profiler/SamplingProfiler.h"
 #include "hermes/VM/Runtime.h"
 #include "hermes/VM/StringPrimitive.h"
@@ -463,6 +464,10 @@ bool executeHBCBytecodeImpl(
     vm::SamplingProfiler::enable();
   }
 
+  if (!options.profileGenerateFile.empty()) {
+    runtime->executionProfiler = std::make_unique<vm::ExecutionProfiler>();
+  }
+
   llvh::StringRef sourceURL{};
   if (filename)
     sourceURL = *filename;
@@ -550,6 +555,18 @@ bool executeHBCBytecodeImpl(
   }
 #endif
 
+  if (runtime->executionProfiler) {
+    std::error_code EC;
+    llvh::raw_fd_ostream OS(options.profileGenerateFile, EC);
+    if (EC) {
+      llvh::errs() << "Could not write the profile to "
+                   << options.profileGenerateFile << ": " << EC.message()
+                   << "\n";
+      return false;
+    }
+    runtime->executionProfiler->dump(OS);
+  }
+
   return !threwException;
 }
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/IR/ExecutionProfile.h"
+
+#include "hermes/IR/IR.h"
+#include "hermes/Parser/JSONParser.h"
+
+#include <algorithm>
+
+using namespace hermes::parser;
+
+namespace hermes {
+
+/// Version of the profile format that can be read.
+static constexpr uint64_t kExecutionProfileVersion = 1;
+
+/// Hot functions are the most called functions that together account for
+/// this fraction of all the calls.
+static constexpr double kHotCallFraction = 0.9;
+
+/// A function called fewer times than this is never hot.
+static constexpr uint64_t kMinHotCallCount = 100;
+
+std::unique_ptr<ExecutionProfile> ExecutionProfile::parse(
+    llvh::MemoryBufferRef profile,
+    SourceErrorManager &sm) {
+  JSLexer::Allocator alloc;
+  JSONFactory factory(alloc);
+  JSONParser jsonParser(factory, profile, sm);
+
+  llvh::Optional<JSONValue *> parsed = jsonParser.parse();
+  if (!parsed.hasValue()) {
+    // The parser has already reported the error.
+    return nullptr;
+  }
+
+  SMLoc genericLoc = SMLoc::getFromPointer(profile.getBufferStart());
+
+  auto *json = llvh::dyn_cast_or_null<JSONObject>(parsed.getValue());
+  if (!json) {
+    sm.error(genericLoc, "Expected a profile object");
+    return nullptr;
+  }
+  auto *version = llvh::dyn_cast_or_null<JSONNumber>(json->get("version"));
+  if (!version || (uint64_t)version->getValue() != kExecutionProfileVersion) {
+    sm.error(genericLoc, "Unsupported profile version");
+    return nullptr;
+  }
+  auto *functions = llvh::dyn_cast_or_null<JSONArray>(json->get("functions"));
+  if (!functions) {
+    sm.error(genericLoc, "'functions' key missing from profile");
+    return nullptr;
+  }
+
+  std::unique_ptr<ExecutionProfile> result{new ExecutionProfile()};
+  std::vector<uint64_t> callCounts;
+  for (const JSONValue *value : *functions) {
+    auto *function = llvh::dyn_cast<JSONObject>(value);
+    auto *location = function
+        ? llvh::dyn_cast_or_null<JSONString>(function->get("location"))
+        : nullptr;
+    auto *calls = function
+        ? llvh::dyn_cast_or_null<JSONNumber>(function->get("calls"))
+        : nullptr;
+    if (!location || !calls) {
+      sm.error(genericLoc, "Profile entry without a location or calls");
+      return nullptr;
+    }
+
+    FunctionProfile &entry = result->functions_[location->str()];
+    entry.calls = calls->getValue();
+    if (auto *first = llvh::dyn_cast_or_null<JSONNumber>(
+            function->get("first_execution")))
+      entry.firstExecution = first->getValue();
+    if (auto *blocks =
+            llvh::dyn_cast_or_null<JSONArray>(function->get("blocks"))) {
+      for (const JSONValue *count : *blocks) {
+        auto *number = llvh::dyn_cast<JSONNumber>(count);
+        if (!number) {
+          sm.error(genericLoc, "Block count is not a number");
+          return nullptr;
+        }
+        entry.blockCounts.push_back(number->getValue());
+      }
+    }
+    callCounts.push_back(entry.calls);
+  }
+
+  // Find the call count from which functions are hot.
+  std::sort(callCounts.begin(), callCounts.end(), std::greater<uint64_t>());
+  uint64_t totalCalls = 0;
+  for (uint64_t count : callCounts)
+    totalCalls += count;
+  uint64_t hotCalls = 0;
+  for (uint64_t count : callCounts) {
+    if (count < kMinHotCallCount)
+      break;
+    result->hotCallCount_ = count;
+    hotCalls += count;
+    if (hotCalls >= totalCalls * kHotCallFraction)
+      break;
+  }
+
+  return result;
+}
+
+const ExecutionProfile::FunctionProfile *ExecutionProfile::getFunctionProfile(
+    Function *F) const {
+  std::string key = "global";
+  if (!F->isGlobalScope()) {
+    SourceErrorManager::SourceCoords coords{};
+    if (!F->getContext().getSourceErrorManager().findBufferLineAndLoc(
+            F->getSourceRange().Start, coords, /*translate*/ true))
+      return nullptr;
+    key = std::to_string(coords.line) + ":" + std::to_string(coords.col);
+  }
+  auto it = functions_.find(key);
+  return it == functions_.end() ? nullptr : &it->second;
+}
+
+llvh::ArrayRef<uint64_t> ExecutionProfile::getBlockCounts(Function *F) const {
+  const FunctionProfile *profile = getFunctionProfile(F);
+  if (!profile || profile->blockCounts.size() != F->size())
+    return {};
+  return profile->blockCounts;
+}
+
+} // namespace hermes
@@ -17,6 +17,8 @@
 #include "hermes/Support/OSCompat.h"
 #include "hermes/Utils/Dumper.h"
 
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <type_traits>
 
@@ -51,6 +53,31 @@ using llvh::dyn_cast;
 #include "hermes/IR/ValueKinds.def"
 #undef QUOTE
 
+namespace {
+
+/// The number of live ConcurrentIRScopes.
+std::atomic<unsigned> concurrentIRScopes{0};
+
+/// Serializes changes to IR shared between functions while a
+/// ConcurrentIRScope exists.
+std::mutex sharedIRMutex;
+
+} // namespace
+
+ConcurrentIRScope::ConcurrentIRScope() {
+  concurrentIRScopes.fetch_add(1, std::memory_order_relaxed);
+}
+
+ConcurrentIRScope::~ConcurrentIRScope() {
+  concurrentIRScopes.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::unique_lock<std::mutex> ConcurrentIRScope::lock() {
+  if (LLVM_LIKELY(concurrentIRScopes.load(std::memory_order_relaxed) == 0))
+    return {};
+  return std::unique_lock<std::mutex>(sharedIRMutex);
+}
+
 void Value::destroy(Value *V) {
   if (!V)
     return;
@@ -111,7 +138,9 @@ void Value::removeUse(Use U) {
     auto &operands = Users[U.second]->Operands;
     for (int i = 0, e = operands.size(); i < e; i++) {
       if (operands[i] == oldUse) {
-        operands[i] = {this, U.second};
+        // The user may belong to a function being transformed on another
+        // thread, which may be reading the value but not the index.
+        operands[i].second = U.second;
         return;
       }
     }
@@ -260,12 +289,16 @@ Instruction::Instruction(
 }
 
 void Instruction::pushOperand(Value *Val) {
-  Operands.push_back({nullptr, 0});
+  {
+    auto lock = ConcurrentIRScope::lock();
+    Operands.push_back({nullptr, 0});
+  }
   setOperand(Val, getNumOperands() - 1);
 }
 
 void Instruction::setOperand(Value *Val, unsigned Index) {
   assert(Index < Operands.size() && "Not all operands have been pushed!");
+  auto lock = ConcurrentIRScope::lock();
 
   Value *CurrentValue = Operands[Index].first;
 
@@ -300,6 +333,7 @@ void Instruction::removeOperand(unsigned index) {
   // We call to setOperand before deleting the operand because setOperand
   // un-registers the user from the user list.
   setOperand(nullptr, index);
+  auto lock = ConcurrentIRScope::lock();
   Operands.erase(Operands.begin() + index);
 }
 
@@ -322,11 +356,13 @@ void Instruction::eraseOperand(Value *Value) {
   }
 
   // Now remove all null operands from the list.
-  auto new_end = std::remove_if(
-      Operands.begin(), Operands.end(), [](Use U) { return !U.first; });
-  Operands.erase(new_end, Operands.end());
-
-  assert(!Value->hasUser(this) && "corrupt uselist");
+  {
+    auto lock = ConcurrentIRScope::lock();
+    auto new_end = std::remove_if(
+        Operands.begin(), Operands.end(), [](Use U) { return !U.first; });
+    Operands.erase(new_end, Operands.end());
+    assert(!Value->hasUser(this) && "corrupt uselist");
+  }
 }
 
 void Instruction::insertBefore(Instruction *InsertPos) {
@@ -712,6 +748,7 @@ void Module::dump() {
 }
 
 LiteralNumber *Module::getLiteralNumber(double value) {
+  auto lock = ConcurrentIRScope::lock();
   // Check to see if we've already seen this tuple before.
   llvh::FoldingSetNodeID ID;
 
@@ -728,6 +765,7 @@ LiteralNumber *Module::getLiteralNumber(double value) {
 }
 
 LiteralString *Module::getLiteralString(Identifier value) {
+  auto lock = ConcurrentIRScope::lock();
   // Check to see if we've already seen this tuple before.
   llvh::FoldingSetNodeID ID;
 
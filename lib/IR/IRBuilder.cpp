@@ -156,8 +156,7 @@ GlobalObjectProperty *IRBuilder::createGlobalObjectProperty(
 GlobalObjectProperty *IRBuilder::createGlobalObjectProperty(
     StringRef name,
     bool declared) {
-  return createGlobalObjectProperty(
-      M->getContext().getIdentifier(name), declared);
+  return createGlobalObjectProperty(createIdentifier(name), declared);
 }
 
 Parameter *IRBuilder::createParameter(Function *Parent, Identifier Name) {
@@ -233,6 +232,7 @@ EmptySentinel *IRBuilder::getEmptySentinel() {
 }
 
 Identifier IRBuilder::createIdentifier(StringRef str) {
+  auto lock = ConcurrentIRScope::lock();
   return M->getContext().getIdentifier(str);
 }
 
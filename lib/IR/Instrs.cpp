@@ -262,6 +262,17 @@ void PhiInst::addEntry(Value *val, BasicBlock *BB) {
   pushOperand(BB);
 }
 
+SideEffectKind LoadPropertyInst::getSideEffect() {
+  // The length of a string primitive is an immutable own property.
+  if (getObject()->getType().isStringType()) {
+    if (auto *prop = llvh::dyn_cast<LiteralString>(getProperty())) {
+      if (prop->getValue().str() == "length")
+        return SideEffectKind::None;
+    }
+  }
+  return SideEffectKind::Unknown;
+}
+
 void PhiInst::removeEntry(unsigned index) {
   // Remove the pair at the right offset. See calculation of getEntry above.
   unsigned startIdx = indexOfPhiEntry(index);
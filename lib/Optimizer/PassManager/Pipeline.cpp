@@ -71,8 +71,14 @@ void hermes::runFullOptimizationPasses(Module &M) {
 
   PM.addInstSimplify();
   PM.addFuncSigOpts();
+  // Fold the constants that FuncSigOpts passed into functions, and the
+  // branches that depend on them.
+  PM.addSCCP();
   PM.addDCE();
   PM.addSimplifyCFG();
+  // Replace object literals that don't escape with stack locations, which
+  // Mem2Reg then promotes to registers.
+  PM.addScalarReplacement();
   PM.addMem2Reg();
   PM.addAuditor();
 
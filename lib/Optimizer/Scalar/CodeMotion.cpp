@@ -14,6 +14,8 @@
 #include "hermes/Support/Statistic.h"
 
 #include "llvh/ADT/DenseMap.h"
+#include "llvh/ADT/DenseSet.h"
+#include "llvh/ADT/SmallPtrSet.h"
 #include "llvh/Support/Debug.h"
 
 #include <algorithm>
@@ -25,6 +27,7 @@ using llvh::isa;
 STATISTIC(NumCM, "Number of instructions moved");
 STATISTIC(NumHoistedCond, "Number of instructions hoisted from conditionals");
 STATISTIC(NumHoistedLoop, "Number of instructions hoisted from loops");
+STATISTIC(NumHoistedLoads, "Number of property loads hoisted from loops");
 STATISTIC(NumSunk, "Number of instructions sunk");
 
 /// Search the \p searchBudget instructions following \p copy in search of
@@ -107,17 +110,149 @@ static bool hoistCBI(CondBranchInst *CBI) {
   }
 }
 
+namespace {
+/// Proves that a property load in a loop reads the same value on every
+/// iteration, and can be executed once before the loop without side effects.
+/// Getters and mutable prototypes make this impossible to know for an
+/// arbitrary object, so only own properties of objects allocated in the
+/// function are handled: the object must not be seen by any other code before
+/// or during the loop, and the loop must not write the property.
+class InvariantLoadAnalysis {
+  const DominanceInfo &dominance_;
+
+  /// For each loop header, the blocks that can reach it: the blocks of the
+  /// loop and those that may run before it.
+  llvh::DenseMap<const BasicBlock *, llvh::DenseSet<const BasicBlock *>>
+      reachingBlocks_{};
+
+  const llvh::DenseSet<const BasicBlock *> &getReachingBlocks(
+      BasicBlock *header);
+
+ public:
+  explicit InvariantLoadAnalysis(const DominanceInfo &dominance)
+      : dominance_(dominance) {}
+
+  /// \returns true if \p LPI, in the loop with header \p header, can be
+  /// hoisted to just before \p branchInst, the last instruction in the
+  /// preheader of the loop.
+  bool isInvariant(
+      LoadPropertyInst *LPI,
+      BasicBlock *header,
+      Instruction *branchInst);
+};
+} // anonymous namespace
+
+const llvh::DenseSet<const BasicBlock *> &
+InvariantLoadAnalysis::getReachingBlocks(BasicBlock *header) {
+  auto it = reachingBlocks_.find(header);
+  if (it != reachingBlocks_.end())
+    return it->second;
+
+  auto &reaching = reachingBlocks_[header];
+  llvh::SmallVector<const BasicBlock *, 16> worklist{header};
+  reaching.insert(header);
+  while (!worklist.empty()) {
+    for (const BasicBlock *pred : predecessors(worklist.pop_back_val())) {
+      if (reaching.insert(pred).second)
+        worklist.push_back(pred);
+    }
+  }
+  return reaching;
+}
+
+bool InvariantLoadAnalysis::isInvariant(
+    LoadPropertyInst *LPI,
+    BasicBlock *header,
+    Instruction *branchInst) {
+  // Subclasses load from the global object.
+  if (LPI->getKind() != ValueKind::LoadPropertyInstKind)
+    return false;
+  auto *key = llvh::dyn_cast<LiteralString>(LPI->getProperty());
+  if (!key)
+    return false;
+
+  auto *alloc = llvh::dyn_cast<Instruction>(LPI->getObject());
+  if (!alloc ||
+      !(isa<AllocObjectInst>(alloc) ||
+        isa<HBCAllocObjectFromBufferInst>(alloc)) ||
+      !dominance_.properlyDominates(alloc, branchInst))
+    return false;
+
+  // The properties that the object certainly has when the loop is entered.
+  llvh::SmallPtrSet<LiteralString *, 8> ownKeys{};
+  if (auto *AOFBI = llvh::dyn_cast<HBCAllocObjectFromBufferInst>(alloc)) {
+    for (unsigned i = 0, e = AOFBI->getKeyValuePairCount(); i < e; ++i) {
+      if (auto *ownKey =
+              llvh::dyn_cast<LiteralString>(AOFBI->getKeyValuePair(i).first))
+        ownKeys.insert(ownKey);
+    }
+  }
+  for (Instruction *U : alloc->getUsers()) {
+    auto *SOPI = llvh::dyn_cast<StoreOwnPropertyInst>(U);
+    if (SOPI && SOPI->getObject() == alloc &&
+        dominance_.properlyDominates(SOPI, branchInst)) {
+      if (auto *ownKey = llvh::dyn_cast<LiteralString>(SOPI->getProperty()))
+        ownKeys.insert(ownKey);
+    }
+  }
+  if (!ownKeys.count(key))
+    return false;
+
+  // Loads and stores of own properties neither run other code nor let the
+  // object escape. Any other use must not run before or during the loop.
+  const auto &reaching = getReachingBlocks(header);
+  for (Instruction *U : alloc->getUsers()) {
+    BasicBlock *BB = U->getParent();
+    if (!reaching.count(BB))
+      continue;
+    bool inLoop = dominance_.dominates(header, BB);
+
+    LiteralString *storedKey = nullptr;
+    if (U->getKind() == ValueKind::LoadPropertyInstKind) {
+      auto *load = cast<LoadPropertyInst>(U);
+      auto *loadKey = llvh::dyn_cast<LiteralString>(load->getProperty());
+      if (load->getObject() == alloc && loadKey && ownKeys.count(loadKey))
+        continue;
+      return false;
+    } else if (U->getKind() == ValueKind::StorePropertyInstKind) {
+      auto *store = cast<StorePropertyInst>(U);
+      storedKey = llvh::dyn_cast<LiteralString>(store->getProperty());
+      if (store->getObject() != alloc || store->getStoredValue() == alloc ||
+          !storedKey || !ownKeys.count(storedKey))
+        return false;
+    } else if (auto *SOPI = llvh::dyn_cast<StoreOwnPropertyInst>(U)) {
+      if (SOPI->getObject() != alloc || SOPI->getStoredValue() == alloc)
+        return false;
+      storedKey = llvh::dyn_cast<LiteralString>(SOPI->getProperty());
+      // A computed key may be the one being loaded.
+      if (!storedKey && inLoop)
+        return false;
+    } else {
+      return false;
+    }
+
+    if (inLoop && storedKey == key)
+      return false;
+  }
+  return true;
+}
+
 /// Check whether \p inst, an instruction in a loop, can be hoisted to just
 /// before \p branchInst, the last instruction in the preheader of the loop.
 /// Only certain types of instructions can be hoisted, and their dependencies
 /// must dominate \p branchInst.
 /// \param dominance the dominance tree for the function
+/// \param header the header of the loop
+/// \param loads decides which property loads can be hoisted
 /// \returns true if \p inst is safe to hoist.
 static bool canHoistFromLoop(
     Instruction *inst,
     Instruction *branchInst,
-    const DominanceInfo &dominance) {
-  if (!isSimpleSideEffectFreeInstruction(inst)) {
+    const DominanceInfo &dominance,
+    BasicBlock *header,
+    InvariantLoadAnalysis &loads) {
+  bool isSimple = isSimpleSideEffectFreeInstruction(inst);
+  if (!isSimple && !llvh::isa<LoadPropertyInst>(inst)) {
     return false;
   }
   for (int i = 0, e = inst->getNumOperands(); i < e; ++i) {
@@ -126,7 +261,8 @@ static bool canHoistFromLoop(
       return false;
     }
   }
-  return true;
+  return isSimple ||
+      loads.isInvariant(cast<LoadPropertyInst>(inst), header, branchInst);
 }
 
 /// Try to hoist instructions from a loop block to the preheader.
@@ -134,7 +270,8 @@ static bool canHoistFromLoop(
 static bool hoistInstructionsFromLoop(
     BasicBlock *BB,
     const DominanceInfo &dominance,
-    const LoopAnalysis &loops) {
+    const LoopAnalysis &loops,
+    InvariantLoadAnalysis &loads) {
   bool changed = false;
   BasicBlock *preheader = loops.getLoopPreheader(BB);
   if (!preheader) {
@@ -145,17 +282,20 @@ static bool hoistInstructionsFromLoop(
     return changed;
   }
   Instruction *branchInst = &preheader->back();
+  BasicBlock *header = loops.getLoopHeader(BB);
 
   for (auto it = BB->begin(), e = BB->end(); it != e;) {
     // Save the advanced iterator here since calling inst->moveBefore below
     // invalidates the iterator.
     auto nextIt = std::next(it);
     Instruction *inst = &*it;
-    if (canHoistFromLoop(inst, branchInst, dominance)) {
+    if (canHoistFromLoop(inst, branchInst, dominance, header, loads)) {
       inst->moveBefore(branchInst);
       changed = true;
       ++NumCM;
       ++NumHoistedLoop;
+      if (llvh::isa<LoadPropertyInst>(inst))
+        ++NumHoistedLoads;
     }
     it = nextIt;
   }
@@ -215,6 +355,7 @@ bool CodeMotion::runOnFunction(Function *F) {
 
   DominanceInfo dominance(F);
   LoopAnalysis loops(F, dominance);
+  InvariantLoadAnalysis loads(dominance);
 
   // Scan the function in post order (from end to start) and:
   //
@@ -231,7 +372,7 @@ bool CodeMotion::runOnFunction(Function *F) {
   // loops last, but post-order doesn't guarantee that.
   for (auto *BB : PO) {
     changed |= sinkInstructionsInBlock(BB, dominance, loops);
-    changed |= hoistInstructionsFromLoop(BB, dominance, loops);
+    changed |= hoistInstructionsFromLoop(BB, dominance, loops, loads);
   }
 
   return changed;
@@ -8,7 +8,9 @@
 #define DEBUG_TYPE "inline"
 #include "hermes/Optimizer/Scalar/Inlining.h"
 
+#include "hermes/IR/Analysis.h"
 #include "hermes/IR/CFG.h"
+#include "hermes/IR/ExecutionProfile.h"
 #include "hermes/IR/IRBuilder.h"
 #include "hermes/Optimizer/Scalar/Utils.h"
 #include "hermes/Support/Statistic.h"
@@ -20,6 +22,15 @@ using llvh::dyn_cast;
 using llvh::isa;
 
 STATISTIC(NumInlinedCalls, "Number of inlined calls");
+STATISTIC(NumInlinedFunctions, "Number of functions inlined into all callers");
+STATISTIC(NumMovedVariables, "Number of variables moved into the caller");
+STATISTIC(
+    NumColdNotInlined,
+    "Number of functions not inlined because they never ran in the profile");
+
+/// How much bigger than the threshold the functions that are hot in the
+/// profile may be when they are inlined at several call sites.
+static constexpr unsigned kHotInlineFactor = 4;
 
 namespace hermes {
 
@@ -46,28 +57,44 @@ static llvh::SmallVector<BasicBlock *, 4> orderDFS(Function *F) {
   return order;
 }
 
+/// What inlining a function into its callers involves.
+struct InlineInfo {
+  /// The number of instructions that are copied to every call site.
+  unsigned size{0};
+  /// Whether the function creates closures. Such a function can only be
+  /// inlined at a single call site, since every closure must be created by a
+  /// single instruction.
+  bool createsClosures{false};
+};
+
 /// \return true if the function \p F satisfies the conditions for being
-///   inlined.
-static bool canBeInlined(Function *F, Function *intoFunction) {
-  // If it has captured variables, it can't be inlined.
-  if (!F->getFunctionScope()->getVariables().empty()) {
+///   inlined into \p intoFunction, and describe the inlining in \p info.
+static bool
+canBeInlined(Function *F, Function *intoFunction, InlineInfo &info) {
+  // Calling a generator function creates a generator instead of running the
+  // body.
+  if (llvh::isa<GeneratorFunction>(F) || llvh::isa<GeneratorInnerFunction>(F))
     return false;
-  }
 
   // If the functions have different strictness, we can't inline them, since
   // we don't have strict/non-strict version of instructions (TODO).
   if (F->isStrictMode() != intoFunction->isStrictMode())
     return false;
 
+  info = InlineInfo{};
   for (BasicBlock *oldBB : orderDFS(F)) {
     for (auto &I : *oldBB) {
       switch (I.getKind()) {
         case ValueKind::CreateArgumentsInstKind:
-        // TODO: we can't deal with changing the scope depth of functions yet.
-        case ValueKind::CreateFunctionInstKind:
-        case ValueKind::CreateGeneratorInstKind:
+        case ValueKind::GetNewTargetInstKind:
+        // Local eval looks up the variables of the enclosing scopes by name.
+        case ValueKind::DirectEvalInstKind:
           // Fail.
           return false;
+        case ValueKind::CreateFunctionInstKind:
+        case ValueKind::CreateGeneratorInstKind:
+          info.createsClosures = true;
+          break;
         case ValueKind::CallBuiltinInstKind:
           if (cast<CallBuiltinInst>(&I)->getBuiltinIndex() ==
               BuiltinMethod::HermesBuiltin_copyRestArgs) {
@@ -77,12 +104,70 @@ static bool canBeInlined(Function *F, Function *intoFunction) {
         default:
           break;
       }
+      if (!llvh::isa<ReturnInst>(I))
+        ++info.size;
     }
   }
 
   return true;
 }
 
+/// \return true if \p F contains a direct eval, which may refer to any of its
+///   variables by name.
+static bool hasDirectEval(Function *F) {
+  for (BasicBlock &BB : *F) {
+    for (Instruction &I : BB) {
+      if (llvh::isa<DirectEvalInst>(I))
+        return true;
+    }
+  }
+  return false;
+}
+
+/// Lazily computed loop analysis of the functions being inlined into.
+class LoopCache {
+  llvh::DenseMap<Function *, std::unique_ptr<LoopAnalysis>> loops_{};
+
+ public:
+  /// \return true if \p I may execute more than once per invocation of its
+  ///   function.
+  bool isInLoop(Instruction *I) {
+    BasicBlock *BB = I->getParent();
+    Function *F = BB->getParent();
+    auto &loops = loops_[F];
+    if (!loops) {
+      DominanceInfo DT(F);
+      loops.reset(new LoopAnalysis(F, DT));
+    }
+    return loops->isBlockInLoop(BB);
+  }
+
+  /// Forget the analysis of \p F after its CFG changed.
+  void invalidate(Function *F) {
+    loops_.erase(F);
+  }
+};
+
+/// Move the variables of \p F into the function scope of \p intoFunction,
+/// where \p F is about to be inlined. The variables are only captured by
+/// closures created in \p F, which will be created in \p intoFunction from now
+/// on, so they can be accessed from the same depth in the scope chain. This is
+/// only correct if \p F is inlined at a single call site that runs at most once
+/// per invocation of \p intoFunction.
+static void
+moveVariables(IRBuilder &builder, Function *F, Function *intoFunction) {
+  for (Variable *oldVar : F->getFunctionScope()->getVariables()) {
+    Variable *newVar = builder.createVariable(
+        intoFunction->getFunctionScope(),
+        oldVar->getDeclKind(),
+        oldVar->getName());
+    newVar->setObeysTDZ(oldVar->getObeysTDZ());
+    newVar->setType(oldVar->getType());
+    oldVar->replaceAllUsesWith(newVar);
+    ++NumMovedVariables;
+  }
+}
+
 /// Inline a function into the current insertion point, which must be at the
 /// end of a basic block because a branch will be inserted.
 /// \param F the function to inline
@@ -170,8 +255,9 @@ static Value *inlineFunction(
         assert(newOp && "operand not visited before instruction");
       } else if (
           llvh::isa<Label>(oldOp) || llvh::isa<Literal>(oldOp) ||
-          llvh::isa<Variable>(oldOp) || llvh::isa<EmptySentinel>(oldOp)) {
-        // Labels, literals and variables are unchanged.
+          llvh::isa<Variable>(oldOp) || llvh::isa<EmptySentinel>(oldOp) ||
+          llvh::isa<Function>(oldOp)) {
+        // Labels, literals, variables and functions are unchanged.
         newOp = oldOp;
       } else {
         llvh::errs() << "INVALID OPERAND FOR : " << I->getKindStr() << '\n';
@@ -262,35 +348,89 @@ static Value *inlineFunction(
 }
 
 bool Inlining::runOnModule(Module *M) {
-  if (!M->getContext().getOptimizationSettings().inlining)
+  const OptimizationSettings &settings =
+      M->getContext().getOptimizationSettings();
+  if (!settings.inlining)
     return false;
 
+  const ExecutionProfile *profile = M->getContext().getExecutionProfile();
   bool changed = false;
 
+  // Functions that were inlined into all their callers. Calls within them are
+  // not inlined, since the functions are about to be deleted.
+  llvh::SmallPtrSet<Function *, 16> inlinedFunctions{};
+  llvh::SmallVector<Function *, 16> inlinedList{};
+  LoopCache loops{};
+
   for (Function &F : *M) {
-    for (Instruction *I : F.getUsers()) {
+    // Copy the users, since the loop erases the instructions that create F.
+    llvh::SmallVector<Instruction *, 2> creators{
+        F.getUsers().begin(), F.getUsers().end()};
+    for (Instruction *I : creators) {
       auto *CFI = llvh::dyn_cast<CreateFunctionInst>(I);
       if (!CFI)
         continue;
 
-      // Check if the function is used only once directly by a CallInst.
-      // We can't use getCallSites() (yet) because it also considers constructor
-      // calls as well usages through environment variables.
-
-      if (!CFI->hasOneUser() ||
-          CFI->getUsers()[0]->getKind() != ValueKind::CallInstKind) {
+      Function *intoFunction = CFI->getParent()->getParent();
+      if (inlinedFunctions.count(intoFunction))
         continue;
+
+      // Check if the function is only used directly by calls, so that it can
+      // be inlined at all of them. We can't use getCallSites() (yet) because
+      // it also considers constructor calls as well usages through environment
+      // variables.
+      llvh::SmallVector<CallInst *, 2> calls{};
+      for (Instruction *U : CFI->getUsers()) {
+        auto *CI = llvh::dyn_cast<CallInst>(U);
+        if (!CI || CI->getKind() != ValueKind::CallInstKind ||
+            !isDirectCallee(CFI, CI)) {
+          calls.clear();
+          break;
+        }
+        calls.push_back(CI);
       }
-      auto *CI = cast<CallInst>(CFI->getUsers()[0]);
-      if (!isDirectCallee(CFI, CI))
+      if (calls.empty())
         continue;
 
-      Function *intoFunction = CI->getParent()->getParent();
-
       auto *FC = CFI->getFunctionCode();
-      if (!canBeInlined(FC, intoFunction))
+      InlineInfo info;
+      if (!canBeInlined(FC, intoFunction, info))
         continue;
 
+      bool hasVariables = !FC->getFunctionScope()->getVariables().empty();
+      if (calls.size() == 1) {
+        // Inlining at a single call site doesn't duplicate code. If the
+        // function has captured variables, they become variables of the
+        // caller, which is only possible if the call runs once per invocation
+        // of the caller.
+        if (hasVariables &&
+            (loops.isInLoop(calls[0]) || hasDirectEval(intoFunction)))
+          continue;
+      } else {
+        // Every call site gets a copy of the function, so only small
+        // functions are inlined, and a bit bigger ones if one of the calls is
+        // in a loop.
+        if (hasVariables || info.createsClosures)
+          continue;
+        // A profile tells which functions are not worth copying because they
+        // never ran, and which are worth copying even if they are bigger.
+        unsigned threshold = settings.inlineThreshold;
+        if (profile && profile->isCold(FC)) {
+          ++NumColdNotInlined;
+          continue;
+        }
+        if (profile && profile->isHot(FC))
+          threshold *= kHotInlineFactor;
+        for (CallInst *CI : calls) {
+          if (loops.isInLoop(CI)) {
+            threshold *= 2;
+            break;
+          }
+        }
+        if (info.size > threshold)
+          continue;
+      }
+
       LLVM_DEBUG(llvh::dbgs() << "Inlining function '"
                               << FC->getInternalNameStr() << "' ";
                  FC->getContext().getSourceErrorManager().dumpCoords(
@@ -299,33 +439,68 @@ bool Inlining::runOnModule(Module *M) {
                               << intoFunction->getInternalNameStr() << "' ";
                  FC->getContext().getSourceErrorManager().dumpCoords(
                      llvh::dbgs(), intoFunction->getSourceRange().Start);
-                 llvh::dbgs() << "\n";);
+                 llvh::dbgs() << " at " << calls.size() << " call sites\n";);
 
       IRBuilder builder(M);
+      if (hasVariables)
+        moveVariables(builder, FC, intoFunction);
+
+      for (CallInst *CI : calls) {
+        // Split the block in two and move all instructions following the call
+        // to the new block.
+        BasicBlock *nextBlock = builder.createBasicBlock(intoFunction);
+        builder.setInsertionBlock(nextBlock);
+
+        // Move the rest of the instructions.
+        auto it = CI->getIterator();
+        ++it; // Skip over the call.
+        auto e = CI->getParent()->end();
+        while (it != e)
+          builder.transferInstructionToCurrentBlock(&*it++);
+
+        // Perform the inlining.
+        builder.setInsertionPointAfter(CI);
+
+        auto *returnValue = inlineFunction(builder, FC, CI, nextBlock);
+        CI->replaceAllUsesWith(returnValue);
+        CI->eraseFromParent();
+
+        ++NumInlinedCalls;
+      }
+      loops.invalidate(intoFunction);
+      CFI->eraseFromParent();
+      changed = true;
 
-      // Split the block in two and move all instructions following the call
-      // to the new block.
-      BasicBlock *nextBlock = builder.createBasicBlock(intoFunction);
-      builder.setInsertionBlock(nextBlock);
-
-      // Move the rest of the instructions.
-      auto it = CI->getIterator();
-      ++it; // Skip over the call.
-      auto e = CI->getParent()->end();
-      while (it != e)
-        builder.transferInstructionToCurrentBlock(&*it++);
-
-      // Perform the inlining.
-      builder.setInsertionPointAfter(CI);
-
-      auto *returnValue = inlineFunction(builder, FC, CI, nextBlock);
-      CI->replaceAllUsesWith(returnValue);
-      CI->eraseFromParent();
+      // Any remaining creators of FC are in functions that were inlined
+      // already.
+      inlinedFunctions.insert(FC);
+      inlinedList.push_back(FC);
+      ++NumInlinedFunctions;
+    }
+  }
 
-      ++NumInlinedCalls;
-      changed = true;
+  // Delete the inlined functions, outermost first, since deleting a function
+  // deletes the instructions creating the functions nested in it. A function
+  // whose variables were moved must not be kept, because closures created in
+  // it would still access the moved variables.
+  llvh::SmallVector<Function *, 16> toDestroy{};
+  for (bool erased = true; erased;) {
+    erased = false;
+    for (Function *&F : inlinedList) {
+      if (F && !F->hasUsers()) {
+        F->eraseFromParentNoDestroy();
+        toDestroy.push_back(F);
+        F = nullptr;
+        erased = true;
+      }
     }
   }
+  for (Function *F : inlinedList) {
+    (void)F;
+    assert(!F && "inlined function is still created somewhere");
+  }
+  for (Function *F : toDestroy)
+    Value::destroy(F);
 
   return changed;
 }
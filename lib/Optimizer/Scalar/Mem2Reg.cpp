@@ -743,6 +743,10 @@ static void promoteAllocStackToSSA(
     }
   }
 
+  // The allocation itself is dead once all of its loads and stores are gone.
+  if (!ASI->hasUsers())
+    ASI->eraseFromParent();
+
   NumAlloc++;
   LLVM_DEBUG(llvh::dbgs() << " Finished placing Phis \n");
 }
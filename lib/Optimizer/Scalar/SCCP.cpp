@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// Sparse conditional constant propagation, after Wegman and Zadeck.
+///
+/// Every instruction starts out unknown, and is lowered to a constant or to
+/// overdefined as the blocks that contain it are found to be executable,
+/// starting from the entry block. A conditional branch with a constant
+/// condition only makes the edge it takes executable, and a phi only merges
+/// the values that flow in along executable edges, so a constant guarded by
+/// a constant condition propagates past the merge point.
+///
+/// Once the solver is done, constant instructions are replaced with their
+/// value and constant branches with direct branches. The blocks that become
+/// unreachable are left for SimplifyCFG to delete.
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "sccp"
+#include "hermes/Optimizer/Scalar/SCCP.h"
+
+#include "hermes/IR/CFG.h"
+#include "hermes/IR/IRBuilder.h"
+#include "hermes/IR/IREval.h"
+#include "hermes/IR/Instrs.h"
+#include "hermes/Support/Statistic.h"
+
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/ADT/DenseSet.h"
+#include "llvh/Support/Debug.h"
+
+using namespace hermes;
+using llvh::dbgs;
+using llvh::dyn_cast;
+using llvh::isa;
+
+STATISTIC(NumConstants, "Number of instructions replaced with constants");
+STATISTIC(NumBranches, "Number of branches folded");
+
+namespace {
+
+/// An element of the lattice: an unknown value, a single constant, or any
+/// value (overdefined).
+class LatticeValue {
+  enum class Kind { Unknown, Constant, Overdefined };
+
+  Kind kind_;
+  Literal *constant_;
+
+  LatticeValue(Kind kind, Literal *constant)
+      : kind_(kind), constant_(constant) {}
+
+ public:
+  LatticeValue() : LatticeValue(Kind::Unknown, nullptr) {}
+
+  static LatticeValue constant(Literal *lit) {
+    return LatticeValue(Kind::Constant, lit);
+  }
+  static LatticeValue overdefined() {
+    return LatticeValue(Kind::Overdefined, nullptr);
+  }
+
+  bool isUnknown() const {
+    return kind_ == Kind::Unknown;
+  }
+  bool isOverdefined() const {
+    return kind_ == Kind::Overdefined;
+  }
+
+  /// \return the constant, or nullptr if the value isn't a constant.
+  Literal *getConstant() const {
+    return constant_;
+  }
+
+  /// Merge \p other into this value.
+  void meet(const LatticeValue &other) {
+    if (isOverdefined() || other.isUnknown())
+      return;
+    if (isUnknown() || other.isOverdefined())
+      *this = other;
+    else if (constant_ != other.constant_)
+      *this = overdefined();
+  }
+
+  bool operator==(const LatticeValue &other) const {
+    return kind_ == other.kind_ && constant_ == other.constant_;
+  }
+  bool operator!=(const LatticeValue &other) const {
+    return !(*this == other);
+  }
+};
+
+class SCCPSolver {
+  IRBuilder &builder_;
+
+  /// The values of the instructions visited so far.
+  llvh::DenseMap<Instruction *, LatticeValue> values_{};
+
+  /// The blocks that can execute.
+  llvh::DenseSet<BasicBlock *> executableBlocks_{};
+
+  /// The CFG edges that can be taken.
+  llvh::DenseSet<std::pair<BasicBlock *, BasicBlock *>> executableEdges_{};
+
+  /// Blocks that have become executable, and must have all of their
+  /// instructions visited.
+  llvh::SmallVector<BasicBlock *, 16> blockWorklist_{};
+
+  /// Instructions whose operands have changed value.
+  llvh::SmallVector<Instruction *, 32> instWorklist_{};
+
+  /// Blocks ending with a branch on a constant, mapped to the successor that
+  /// the branch takes.
+  llvh::DenseMap<BasicBlock *, BasicBlock *> constantBranches_{};
+
+ public:
+  explicit SCCPSolver(IRBuilder &builder) : builder_(builder) {}
+
+  /// Find the executable blocks of \p F and the values of its instructions.
+  void solve(Function *F);
+
+  /// \return the value of \p V.
+  LatticeValue getValue(Value *V) const;
+
+  bool isExecutable(BasicBlock *BB) const {
+    return executableBlocks_.count(BB);
+  }
+
+  /// \return the only successor that the terminator of \p BB can branch to,
+  ///   if it is a conditional branch or switch on a constant.
+  BasicBlock *getConstantBranchTarget(BasicBlock *BB) const {
+    auto it = constantBranches_.find(BB);
+    return it == constantBranches_.end() ? nullptr : it->second;
+  }
+
+ private:
+  /// Update the value of \p I to \p value, and revisit its users if it
+  /// changed.
+  void setValue(Instruction *I, LatticeValue value);
+
+  /// Mark the edge from \p from to \p to as executable.
+  void markEdge(BasicBlock *from, BasicBlock *to);
+
+  /// Mark all of the outgoing edges of \p BB as executable.
+  void markAllSuccessors(BasicBlock *BB);
+
+  /// Mark the outgoing edges of \p TI that can be taken as executable.
+  void visitTerminator(TerminatorInst *TI);
+
+  void visit(Instruction *I);
+  LatticeValue visitPhi(PhiInst *phi);
+  LatticeValue visitUnaryOperator(UnaryOperatorInst *UOI);
+  LatticeValue visitBinaryOperator(BinaryOperatorInst *BOI);
+
+  /// \return the successor that the conditional branch or switch \p TI
+  ///   takes when its condition is \p cond, or nullptr if \p cond is null
+  ///   or the successor can't be determined.
+  BasicBlock *getBranchTarget(TerminatorInst *TI, Literal *cond);
+};
+
+LatticeValue SCCPSolver::getValue(Value *V) const {
+  if (auto *lit = dyn_cast<Literal>(V))
+    return LatticeValue::constant(lit);
+  if (auto *I = dyn_cast<Instruction>(V)) {
+    auto it = values_.find(I);
+    return it == values_.end() ? LatticeValue() : it->second;
+  }
+  // Parameters, variables, functions and the like.
+  return LatticeValue::overdefined();
+}
+
+void SCCPSolver::setValue(Instruction *I, LatticeValue value) {
+  LatticeValue &current = values_[I];
+  if (current == value)
+    return;
+  assert(
+      (current.isUnknown() || value.isOverdefined()) &&
+      "lattice values can only be lowered");
+  current = value;
+  for (Instruction *U : I->getUsers())
+    instWorklist_.push_back(U);
+}
+
+void SCCPSolver::markEdge(BasicBlock *from, BasicBlock *to) {
+  if (!executableEdges_.insert({from, to}).second)
+    return;
+  if (executableBlocks_.insert(to).second) {
+    blockWorklist_.push_back(to);
+    return;
+  }
+  // The block has already been visited, but its phis have a new input.
+  for (Instruction &I : *to) {
+    if (auto *phi = dyn_cast<PhiInst>(&I))
+      instWorklist_.push_back(phi);
+  }
+}
+
+void SCCPSolver::markAllSuccessors(BasicBlock *BB) {
+  for (BasicBlock *succ : successors(BB))
+    markEdge(BB, succ);
+}
+
+BasicBlock *SCCPSolver::getBranchTarget(TerminatorInst *TI, Literal *cond) {
+  if (!cond)
+    return nullptr;
+  if (auto *CBI = dyn_cast<CondBranchInst>(TI)) {
+    LiteralBool *B = evalToBoolean(builder_, cond);
+    if (!B)
+      return nullptr;
+    return B->getValue() ? CBI->getTrueDest() : CBI->getFalseDest();
+  }
+
+  auto *SI = cast<SwitchInst>(TI);
+  for (unsigned i = 0, e = SI->getNumCasePair(); i < e; ++i) {
+    auto casePair = SI->getCasePair(i);
+    auto *equal = llvh::dyn_cast_or_null<LiteralBool>(evalBinaryOperator(
+        BinaryOperatorInst::OpKind::StrictlyEqualKind,
+        builder_,
+        cond,
+        casePair.first));
+    if (!equal)
+      return nullptr;
+    if (equal->getValue())
+      return casePair.second;
+  }
+  return SI->getDefaultDestination();
+}
+
+void SCCPSolver::visitTerminator(TerminatorInst *TI) {
+  BasicBlock *BB = TI->getParent();
+  Value *cond = nullptr;
+  if (auto *CBI = dyn_cast<CondBranchInst>(TI))
+    cond = CBI->getCondition();
+  else if (auto *SI = dyn_cast<SwitchInst>(TI))
+    cond = SI->getInputValue();
+
+  if (cond) {
+    LatticeValue value = getValue(cond);
+    if (value.isUnknown())
+      return;
+    if (BasicBlock *dest = getBranchTarget(TI, value.getConstant())) {
+      constantBranches_[BB] = dest;
+      markEdge(BB, dest);
+      return;
+    }
+    constantBranches_.erase(BB);
+  }
+  markAllSuccessors(BB);
+}
+
+LatticeValue SCCPSolver::visitPhi(PhiInst *phi) {
+  BasicBlock *BB = phi->getParent();
+  LatticeValue result{};
+  for (unsigned i = 0, e = phi->getNumEntries(); i < e; ++i) {
+    auto entry = phi->getEntry(i);
+    if (executableEdges_.count({entry.second, BB}))
+      result.meet(getValue(entry.first));
+  }
+  return result;
+}
+
+LatticeValue SCCPSolver::visitUnaryOperator(UnaryOperatorInst *UOI) {
+  LatticeValue op = getValue(UOI->getSingleOperand());
+  if (!op.getConstant())
+    return op;
+  if (Literal *result = evalUnaryOperator(
+          UOI->getOperatorKind(), builder_, op.getConstant()))
+    return LatticeValue::constant(result);
+  return LatticeValue::overdefined();
+}
+
+LatticeValue SCCPSolver::visitBinaryOperator(BinaryOperatorInst *BOI) {
+  LatticeValue lhs = getValue(BOI->getLeftHandSide());
+  LatticeValue rhs = getValue(BOI->getRightHandSide());
+  if (lhs.isOverdefined() || rhs.isOverdefined())
+    return LatticeValue::overdefined();
+  if (lhs.isUnknown() || rhs.isUnknown())
+    return LatticeValue();
+  if (Literal *result = evalBinaryOperator(
+          BOI->getOperatorKind(),
+          builder_,
+          lhs.getConstant(),
+          rhs.getConstant()))
+    return LatticeValue::constant(result);
+  return LatticeValue::overdefined();
+}
+
+void SCCPSolver::visit(Instruction *I) {
+  if (auto *TI = dyn_cast<TerminatorInst>(I))
+    return visitTerminator(TI);
+  if (auto *phi = dyn_cast<PhiInst>(I))
+    return setValue(I, visitPhi(phi));
+  if (auto *UOI = dyn_cast<UnaryOperatorInst>(I))
+    return setValue(I, visitUnaryOperator(UOI));
+  if (auto *BOI = dyn_cast<BinaryOperatorInst>(I))
+    return setValue(I, visitBinaryOperator(BOI));
+  setValue(I, LatticeValue::overdefined());
+}
+
+void SCCPSolver::solve(Function *F) {
+  BasicBlock *entry = &*F->begin();
+  executableBlocks_.insert(entry);
+  blockWorklist_.push_back(entry);
+
+  for (;;) {
+    while (!blockWorklist_.empty() || !instWorklist_.empty()) {
+      while (!instWorklist_.empty()) {
+        Instruction *I = instWorklist_.pop_back_val();
+        if (isExecutable(I->getParent()))
+          visit(I);
+      }
+      if (!blockWorklist_.empty()) {
+        for (Instruction &I : *blockWorklist_.pop_back_val())
+          visit(&I);
+      }
+    }
+
+    // A branch on a value that is still unknown would leave its successors
+    // unexecutable, even though nothing proves that they are. Give up on
+    // such branches and keep going until nothing changes.
+    llvh::SmallVector<BasicBlock *, 4> unresolved{};
+    for (BasicBlock *BB : executableBlocks_) {
+      TerminatorInst *TI = BB->getTerminator();
+      Value *cond = nullptr;
+      if (auto *CBI = dyn_cast<CondBranchInst>(TI))
+        cond = CBI->getCondition();
+      else if (auto *SI = dyn_cast<SwitchInst>(TI))
+        cond = SI->getInputValue();
+      if (cond && getValue(cond).isUnknown())
+        unresolved.push_back(BB);
+    }
+    bool changed = false;
+    for (BasicBlock *BB : unresolved) {
+      for (BasicBlock *succ : successors(BB)) {
+        if (!executableEdges_.count({BB, succ})) {
+          markEdge(BB, succ);
+          changed = true;
+        }
+      }
+    }
+    if (!changed)
+      return;
+  }
+}
+
+} // anonymous namespace
+
+/// Replace the terminator of \p BB with a branch to \p dest, and remove the
+/// incoming values from \p BB from the phis of the other successors.
+static void replaceWithDirectBranch(
+    IRBuilder &builder,
+    BasicBlock *BB,
+    BasicBlock *dest) {
+  TerminatorInst *TI = BB->getTerminator();
+  llvh::SmallPtrSet<BasicBlock *, 8> visited{};
+  for (BasicBlock *succ : successors(BB)) {
+    if (!visited.insert(succ).second)
+      continue;
+    for (Instruction &I : *succ) {
+      auto *phi = dyn_cast<PhiInst>(&I);
+      if (!phi)
+        continue;
+      if (succ != dest) {
+        phi->removeEntry(BB);
+        continue;
+      }
+      // Several cases of a switch may lead to the same block. Keep one
+      // entry for it.
+      bool found = false;
+      for (unsigned i = 0; i < phi->getNumEntries();) {
+        if (phi->getEntry(i).second != BB) {
+          ++i;
+        } else if (!found) {
+          found = true;
+          ++i;
+        } else {
+          phi->removeEntry(i);
+        }
+      }
+    }
+  }
+
+  builder.setInsertionBlock(BB);
+  builder.createBranchInst(dest);
+  TI->eraseFromParent();
+}
+
+bool SCCP::runOnFunction(Function *F) {
+  IRBuilder builder(F);
+  SCCPSolver solver(builder);
+  solver.solve(F);
+
+  bool changed = false;
+  for (BasicBlock &BB : *F) {
+    if (!solver.isExecutable(&BB))
+      continue;
+
+    IRBuilder::InstructionDestroyer destroyer;
+    for (Instruction &I : BB) {
+      if (!isa<PhiInst>(&I) && !isa<UnaryOperatorInst>(&I) &&
+          !isa<BinaryOperatorInst>(&I))
+        continue;
+      // Evaluating an operator on constants has no side effects, so the
+      // instruction can be deleted.
+      if (Literal *lit = solver.getValue(&I).getConstant()) {
+        I.replaceAllUsesWith(lit);
+        destroyer.add(&I);
+        ++NumConstants;
+        changed = true;
+      }
+    }
+
+    if (BasicBlock *dest = solver.getConstantBranchTarget(&BB)) {
+      LLVM_DEBUG(
+          dbgs() << "Folding a branch in " << F->getInternalNameStr()
+                 << "\n");
+      replaceWithDirectBranch(builder, &BB, dest);
+      ++NumBranches;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+Pass *hermes::createSCCP() {
+  return new SCCP();
+}
+
+#undef DEBUG_TYPE
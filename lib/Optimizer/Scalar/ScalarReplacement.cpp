@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// Scalar replacement of object literals.
+///
+/// An object literal whose only uses are loads and stores of its own
+/// properties, with constant names, cannot be observed outside of those
+/// instructions: no code can add, delete or reconfigure its properties, and
+/// its prototype is never consulted. Each property is then replaced by a stack
+/// location, initialized where the object was allocated:
+///
+/// \code
+///   %0 = AllocObjectLiteralInst "x" : string, %a, "y" : string, %b
+///   %1 = StorePropertyInst 3 : number, %0 : object, "x" : string
+///   %2 = LoadPropertyInst %0 : object, "x" : string
+/// \endcode
+///
+/// becomes
+///
+/// \code
+///   %0 = AllocStackInst $x
+///   %1 = AllocStackInst $y
+///   ...
+///   %2 = StoreStackInst %a, %0
+///   %3 = StoreStackInst %b, %1
+///   %4 = StoreStackInst 3 : number, %0
+///   %5 = LoadStackInst %0
+/// \endcode
+///
+/// and Mem2Reg later removes the stack locations.
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "scalarreplacement"
+#include "hermes/Optimizer/Scalar/ScalarReplacement.h"
+
+#include "hermes/IR/IRBuilder.h"
+#include "hermes/IR/Instrs.h"
+#include "hermes/Support/Statistic.h"
+
+#include "llvh/ADT/DenseMap.h"
+#include "llvh/Support/Debug.h"
+
+STATISTIC(NumObjectsReplaced, "Number of object literals replaced by scalars");
+STATISTIC(NumAccessesReplaced, "Number of property accesses replaced");
+
+namespace hermes {
+
+using llvh::dyn_cast;
+
+/// \return the name of the property accessed by \p property if it is a
+///   constant string, or null otherwise.
+static LiteralString *getConstantKey(Value *property) {
+  auto *key = dyn_cast<LiteralString>(property);
+  // __proto__ is an accessor of Object.prototype, which the object literal
+  // inherits, unless it defines its own.
+  if (!key || key->getValue().str() == "__proto__")
+    return nullptr;
+  return key;
+}
+
+/// \return true if the only uses of \p alloc are loads and stores of its own
+///   properties, which are listed in \p slots.
+static bool isReplaceable(
+    AllocObjectLiteralInst *alloc,
+    const llvh::DenseMap<LiteralString *, AllocStackInst *> &slots) {
+  for (Instruction *U : alloc->getUsers()) {
+    LiteralString *key;
+    if (U->getKind() == ValueKind::LoadPropertyInstKind) {
+      auto *LPI = cast<LoadPropertyInst>(U);
+      if (LPI->getObject() != alloc)
+        return false;
+      key = getConstantKey(LPI->getProperty());
+    } else if (U->getKind() == ValueKind::StorePropertyInstKind) {
+      auto *SPI = cast<StorePropertyInst>(U);
+      // Storing the object itself lets it escape.
+      if (SPI->getObject() != alloc || SPI->getStoredValue() == alloc)
+        return false;
+      key = getConstantKey(SPI->getProperty());
+    } else {
+      return false;
+    }
+    // Accessing a missing property would read the prototype, or add a
+    // property to the object.
+    if (!key || !slots.count(key))
+      return false;
+  }
+  return true;
+}
+
+/// Try to replace the properties of \p alloc with stack locations allocated
+/// in the entry block of its function.
+/// \return true if the object was replaced.
+static bool replaceObject(IRBuilder &builder, AllocObjectLiteralInst *alloc) {
+  // Map each property name to the location that replaces it. The locations
+  // are only created once the object is known to be replaceable.
+  llvh::DenseMap<LiteralString *, AllocStackInst *> slots{};
+  for (unsigned i = 0, e = alloc->getKeyValuePairCount(); i < e; ++i) {
+    auto *key = getConstantKey(alloc->getKey(i));
+    if (!key)
+      return false;
+    slots[key] = nullptr;
+  }
+  if (!isReplaceable(alloc, slots))
+    return false;
+
+  Function *F = alloc->getParent()->getParent();
+  builder.setInsertionPoint(&*F->begin()->begin());
+  for (unsigned i = 0, e = alloc->getKeyValuePairCount(); i < e; ++i) {
+    auto *key = cast<LiteralString>(alloc->getKey(i));
+    AllocStackInst *&slot = slots[key];
+    if (!slot)
+      slot = builder.createAllocStackInst(key->getValue());
+  }
+
+  // Initialize the properties in order, so that the last of several
+  // definitions of the same name wins.
+  builder.setInsertionPoint(alloc);
+  for (unsigned i = 0, e = alloc->getKeyValuePairCount(); i < e; ++i) {
+    builder.createStoreStackInst(
+        alloc->getValue(i), slots[cast<LiteralString>(alloc->getKey(i))]);
+  }
+
+  IRBuilder::InstructionDestroyer destroyer;
+  for (Instruction *U : alloc->getUsers()) {
+    builder.setInsertionPoint(U);
+    if (auto *LPI = dyn_cast<LoadPropertyInst>(U)) {
+      auto *LSI = builder.createLoadStackInst(
+          slots[cast<LiteralString>(LPI->getProperty())]);
+      LPI->replaceAllUsesWith(LSI);
+    } else {
+      auto *SPI = cast<StorePropertyInst>(U);
+      builder.createStoreStackInst(
+          SPI->getStoredValue(),
+          slots[cast<LiteralString>(SPI->getProperty())]);
+    }
+    destroyer.add(U);
+    ++NumAccessesReplaced;
+  }
+  destroyer.add(alloc);
+
+  ++NumObjectsReplaced;
+  return true;
+}
+
+bool ScalarReplacement::runOnFunction(Function *F) {
+  IRBuilder builder(F);
+  llvh::SmallVector<AllocObjectLiteralInst *, 4> allocs{};
+  for (BasicBlock &BB : *F) {
+    for (Instruction &I : BB) {
+      if (auto *alloc = dyn_cast<AllocObjectLiteralInst>(&I))
+        allocs.push_back(alloc);
+    }
+  }
+
+  bool changed = false;
+  for (AllocObjectLiteralInst *alloc : allocs) {
+    if (replaceObject(builder, alloc)) {
+      LLVM_DEBUG(
+          llvh::dbgs() << "Replaced an object literal in "
+                       << F->getInternalNameStr() << "\n");
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+Pass *createScalarReplacement() {
+  return new ScalarReplacement();
+}
+
+} // namespace hermes
+
+#undef DEBUG_TYPE
@@ -230,6 +230,7 @@ bool hermes::isSimpleSideEffectFreeInstruction(Instruction *I) {
     case ValueKind::GetNewTargetInstKind:
     case ValueKind::UnaryOperatorInstKind:
     case ValueKind::BinaryOperatorInstKind:
+    case ValueKind::LoadPropertyInstKind:
     case ValueKind::HBCResolveEnvironmentKind:
     case ValueKind::HBCLoadConstInstKind:
     case ValueKind::HBCGetGlobalObjectInstKind:
@@ -1554,6 +1554,10 @@ end:
     } else {
       buf.append(start, curCharPtr_);
     }
+    if (auto fast = parseDecimalFastPath(buf.begin(), buf.end())) {
+      val = *fast;
+      goto done;
+    }
     buf.push_back(0);
     char *endPtr;
     val = ::hermes_g_strtod(buf.data(), &endPtr);
@@ -6,12 +6,18 @@
  */
 
 #include "hermes/Regex/Executor.h"
+#include "hermes/Regex/RegexJIT.h"
 #include "hermes/Regex/RegexTraits.h"
 #include "hermes/Support/OptValue.h"
 
+#include "llvh/ADT/DenseSet.h"
 #include "llvh/ADT/SmallVector.h"
 #include "llvh/Support/TrailingObjects.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 // This file contains the machinery for executing a regexp compiled to bytecode.
 
 namespace hermes {
@@ -20,6 +26,9 @@ namespace regex {
 template <class Traits>
 struct State;
 
+template <class Traits>
+class LockstepMatcher;
+
 /// The kind of error that occurred when trying to find a match.
 enum class MatchRuntimeErrorType {
   /// No error occurred.
@@ -395,6 +404,14 @@ struct Context {
   /// state->cursor_.currentPointer().
   const CodeUnit *match(State<Traits> *state, bool onlyAtStart);
 
+  /// Run the given State \p state like match(), but without backtracking: all
+  /// viable paths through the regex are advanced through the input together,
+  /// so the time taken is linear in the length of the input. This may only be
+  /// used if the regex is backtrack-free (see RegexBytecodeHeader).
+  const CodeUnit *matchWithoutBacktracking(
+      State<Traits> *state,
+      bool onlyAtStart);
+
   /// Backtrack the given state \p s with the backtrack stack \p bts.
   /// \return true if we backatracked, false if we exhausted the stack.
   LLVM_NODISCARD
@@ -434,7 +451,18 @@ struct Context {
       State<Traits> *s,
       BacktrackStack &bts);
 
+  /// Use the prefilter in \p header to find the first index, starting at \p
+  /// index, at which a match may begin in the \p length code units at \p
+  /// start. \return that index, or length + 1 if there is none.
+  static size_t nextPrefilterCandidate(
+      const RegexBytecodeHeader *header,
+      const CodeUnit *start,
+      size_t index,
+      size_t length);
+
  private:
+  friend class LockstepMatcher<Traits>;
+
   /// Do initialization of the given state before it enters the loop body
   /// described by the LoopInsn \p loop, including setting up any backtracking
   /// state.
@@ -450,6 +478,10 @@ struct Context {
   template <Width1Opcode w1opcode>
   inline bool matchWidth1(const Insn *insn, CodeUnit c) const;
 
+  /// \return true if the char \p c matches the Width1 instruction \p insn,
+  /// whose opcode is only known at runtime.
+  bool matchWidth1(const Insn *insn, CodeUnit c) const;
+
   /// \return true if all chars, stored in contiguous memory after \p insn,
   /// match the chars in state \p s in the same order, case insensitive. Note
   /// the count of chars is given in \p insn.
@@ -535,9 +567,8 @@ bool isLineTerminator(CharT c) {
 }
 
 template <class Traits>
-bool matchesLeftAnchor(Context<Traits> &ctx, State<Traits> &s) {
+bool matchesLeftAnchor(const Context<Traits> &ctx, const Cursor<Traits> &c) {
   bool matchesAnchor = false;
-  const Cursor<Traits> &c = s.cursor_;
   if (c.atLeft()) {
     // Beginning of text.
     matchesAnchor = true;
@@ -551,9 +582,8 @@ bool matchesLeftAnchor(Context<Traits> &ctx, State<Traits> &s) {
 }
 
 template <class Traits>
-bool matchesRightAnchor(Context<Traits> &ctx, State<Traits> &s) {
+bool matchesRightAnchor(const Context<Traits> &ctx, const Cursor<Traits> &c) {
   bool matchesAnchor = false;
-  const Cursor<Traits> &c = s.cursor_;
   if (c.atRight() && !(ctx.flags_ & constants::matchNotEndOfLine)) {
     matchesAnchor = true;
   } else if (
@@ -564,6 +594,24 @@ bool matchesRightAnchor(Context<Traits> &ctx, State<Traits> &s) {
   return matchesAnchor;
 }
 
+/// \return whether the cursor \p c is at a word boundary (\b).
+template <class Traits>
+bool matchesWordBoundary(const Context<Traits> &ctx, const Cursor<Traits> &c) {
+  const auto *charPointer = c.currentPointer();
+
+  bool prevIsWordchar = false;
+  if (!c.atLeft())
+    prevIsWordchar =
+        ctx.traits_.characterHasType(charPointer[-1], CharacterClass::Words);
+
+  bool currentIsWordchar = false;
+  if (!c.atRight())
+    currentIsWordchar =
+        ctx.traits_.characterHasType(charPointer[0], CharacterClass::Words);
+
+  return prevIsWordchar != currentIsWordchar;
+}
+
 /// \return true if all chars, stored in contiguous memory after \p insn,
 /// match the chars in state \p s in the same order. Note the count of chars
 /// is given in \p insn.
@@ -802,6 +850,28 @@ bool Context<Traits>::matchWidth1(const Insn *base, CodeUnit c) const {
   llvm_unreachable("Invalid width 1 opcode");
 }
 
+template <class Traits>
+bool Context<Traits>::matchWidth1(const Insn *insn, CodeUnit c) const {
+  using W1 = Width1Opcode;
+  switch (static_cast<Width1Opcode>(insn->opcode)) {
+    case W1::MatchChar8:
+      return matchWidth1<W1::MatchChar8>(insn, c);
+    case W1::MatchChar16:
+      return matchWidth1<W1::MatchChar16>(insn, c);
+    case W1::MatchCharICase8:
+      return matchWidth1<W1::MatchCharICase8>(insn, c);
+    case W1::MatchCharICase16:
+      return matchWidth1<W1::MatchCharICase16>(insn, c);
+    case W1::MatchAny:
+      return matchWidth1<W1::MatchAny>(insn, c);
+    case W1::MatchAnyButNewline:
+      return matchWidth1<W1::MatchAnyButNewline>(insn, c);
+    case W1::Bracket:
+      return matchWidth1<W1::Bracket>(insn, c);
+  }
+  llvm_unreachable("Invalid width 1 opcode");
+}
+
 template <class Traits>
 template <Width1Opcode w1opcode>
 uint32_t Context<Traits>::matchWidth1LoopBody(
@@ -895,6 +965,60 @@ OptValue<bool> Context<Traits>::matchWidth1Loop(
   return true;
 }
 
+/// \return a pointer to the first code unit equal to \p c in [\p first, \p
+/// last), or last if there is none.
+static const char *findCodeUnit(const char *first, const char *last, char16_t c) {
+  if (c > 0xFF)
+    return last;
+  const void *found = memchr(first, c, last - first);
+  return found ? static_cast<const char *>(found) : last;
+}
+
+static const char16_t *
+findCodeUnit(const char16_t *first, const char16_t *last, char16_t c) {
+  return std::find(first, last, c);
+}
+
+template <class Traits>
+size_t Context<Traits>::nextPrefilterCandidate(
+    const RegexBytecodeHeader *header,
+    const CodeUnit *start,
+    size_t index,
+    size_t length) {
+  // Code units are compared as unsigned values, so that 8-bit input is
+  // zero-extended.
+  using UnsignedUnit = typename std::make_unsigned<CodeUnit>::type;
+  const char16_t *chars = header->prefilterChars;
+  const CodeUnit *pos = start + index;
+  const CodeUnit *const end = start + length;
+
+  if (size_t prefixLength = header->prefixLength) {
+    for (;;) {
+      pos = findCodeUnit(pos, end, chars[0]);
+      if (static_cast<size_t>(end - pos) < prefixLength)
+        return length + 1;
+      size_t i = 1;
+      while (i < prefixLength && UnsignedUnit(pos[i]) == chars[i])
+        ++i;
+      if (i == prefixLength)
+        return pos - start;
+      ++pos;
+    }
+  }
+
+  const uint8_t count = header->firstCharCount;
+  assert(count > 0 && "Prefilter must not be empty");
+  if (count == 1) {
+    pos = findCodeUnit(pos, end, chars[0]);
+    return pos == end ? length + 1 : pos - start;
+  }
+  for (; pos != end; ++pos) {
+    if (std::find(chars, chars + count, UnsignedUnit(*pos)) != chars + count)
+      return pos - start;
+  }
+  return length + 1;
+}
+
 /// ES6 21.2.5.2.3. Effectively this skips surrogate pairs if the regexp has the
 /// Unicode flag set.
 template <class Traits>
@@ -957,6 +1081,12 @@ auto Context<Traits>::match(State<Traits> *s, bool onlyAtStart)
       (c.forwards() || locsToCheckCount == 1) &&
       "Can only check one location when cursor is backwards");
 
+  // When searching, skip the locations at which the regex cannot match.
+  const auto *header =
+      reinterpret_cast<const RegexBytecodeHeader *>(bytecodeStream_.data());
+  const bool usePrefilter =
+      !onlyAtStart && (header->prefixLength || header->firstCharCount);
+
   // Macro used when a state fails to match.
 #define BACKTRACK()                            \
   do {                                         \
@@ -970,6 +1100,12 @@ auto Context<Traits>::match(State<Traits> *s, bool onlyAtStart)
 
   for (size_t locIndex = 0; locIndex < locsToCheckCount;
        locIndex = advanceStringIndex(startLoc, locIndex, charsToRight)) {
+    if (usePrefilter) {
+      locIndex =
+          nextPrefilterCandidate(header, startLoc, locIndex, charsToRight);
+      if (locIndex >= locsToCheckCount)
+        break;
+    }
     const CodeUnit *potentialMatchLocation = startLoc + locIndex;
     c.setCurrentPointer(potentialMatchLocation);
     s->ip_ = startIp;
@@ -984,13 +1120,13 @@ auto Context<Traits>::match(State<Traits> *s, bool onlyAtStart)
           return potentialMatchLocation;
 
         case Opcode::LeftAnchor:
-          if (!matchesLeftAnchor(*this, *s))
+          if (!matchesLeftAnchor(*this, c))
             BACKTRACK();
           s->ip_ += sizeof(LeftAnchorInsn);
           break;
 
         case Opcode::RightAnchor:
-          if (!matchesRightAnchor(*this, *s))
+          if (!matchesRightAnchor(*this, c))
             BACKTRACK();
           s->ip_ += sizeof(RightAnchorInsn);
           break;
@@ -1148,20 +1284,7 @@ auto Context<Traits>::match(State<Traits> *s, bool onlyAtStart)
 
         case Opcode::WordBoundary: {
           const WordBoundaryInsn *insn = llvh::cast<WordBoundaryInsn>(base);
-          const auto *charPointer = c.currentPointer();
-
-          bool prevIsWordchar = false;
-          if (!c.atLeft())
-            prevIsWordchar = traits_.characterHasType(
-                charPointer[-1], CharacterClass::Words);
-
-          bool currentIsWordchar = false;
-          if (!c.atRight())
-            currentIsWordchar =
-                traits_.characterHasType(charPointer[0], CharacterClass::Words);
-
-          bool isWordBoundary = (prevIsWordchar != currentIsWordchar);
-          if (isWordBoundary ^ insn->invert)
+          if (matchesWordBoundary(*this, c) ^ insn->invert)
             s->ip_ += sizeof(WordBoundaryInsn);
           else
             BACKTRACK();
@@ -1464,6 +1587,500 @@ auto Context<Traits>::match(State<Traits> *s, bool onlyAtStart)
   return nullptr;
 }
 
+/// A thread of execution in the non-backtracking executor.
+struct LockstepThread {
+  /// The instruction the thread is waiting to execute. This is either Goal or
+  /// an instruction that consumes input.
+  uint32_t ip;
+
+  /// Instruction-specific state: the index of the next character to match in
+  /// a MatchNChar8 or MatchNCharICase8, or the iteration count of a
+  /// Width1Loop. Zero for all other instructions.
+  uint32_t aux;
+
+  /// The input offset at which this thread's match attempt began.
+  uint32_t matchStart;
+};
+
+/// A list of threads, ordered from highest to lowest priority. A thread has
+/// higher priority than another if the backtracking executor would have
+/// explored its path first.
+struct LockstepThreadList {
+  /// The threads in the list.
+  std::vector<LockstepThread> threads;
+
+  /// The captured ranges of each thread, stored contiguously in thread order.
+  std::vector<CapturedRange> captures;
+
+  bool empty() const {
+    return threads.empty();
+  }
+
+  void clear() {
+    threads.clear();
+    captures.clear();
+  }
+};
+
+/// LockstepMatcher implements Context::matchWithoutBacktracking(). It is a Pike
+/// VM: rather than trying one path through the regex and backtracking on
+/// failure, it keeps a list of the threads which may still match and advances
+/// all of them one code unit at a time. Threads which reach the same
+/// instruction with the same state at the same input position can never
+/// diverge afterwards, so only the highest priority one is kept, which bounds
+/// the number of threads by the size of the regex.
+template <class Traits>
+class LockstepMatcher {
+  using CodeUnit = typename Traits::CodeUnit;
+
+  /// An item on the work stack used to follow the paths from an instruction
+  /// which do not consume input.
+  struct WorkItem {
+    enum class Kind : uint8_t {
+      /// Follow the instruction at ip, with instruction state aux.
+      Explore,
+      /// Add a thread waiting at ip, with instruction state aux.
+      AddThread,
+      /// Enter the body of the BeginLoop at ip.
+      EnterLoopBody,
+      /// Restore the captured range of the group ip to range.
+      RestoreCapture,
+    };
+    Kind kind;
+    uint32_t ip;
+    uint32_t aux;
+    CapturedRange range;
+  };
+
+  Context<Traits> &ctx_;
+
+  /// The instructions, following the header.
+  const uint8_t *const bytecode_;
+
+  /// Count of capture groups.
+  const uint32_t markedCount_;
+
+  /// For each bytecode offset, one more than the input offset at which it was
+  /// last reached. This identifies the instructions already reached by the
+  /// thread list being built.
+  std::vector<uint32_t> reached_;
+
+  /// The (ip, aux) pairs with nonzero aux reached by the thread list being
+  /// built.
+  llvh::DenseSet<uint64_t> reachedWithAux_;
+
+  /// The work stack used by addThreads().
+  std::vector<WorkItem> work_;
+
+  /// The captured ranges of the path being followed by addThreads().
+  llvh::SmallVector<CapturedRange, 16> captures_;
+
+ public:
+  explicit LockstepMatcher(Context<Traits> &ctx)
+      : ctx_(ctx),
+        bytecode_(&ctx.bytecodeStream_[sizeof(RegexBytecodeHeader)]),
+        markedCount_(ctx.markedCount_),
+        reached_(ctx.bytecodeStream_.size(), 0),
+        captures_(ctx.markedCount_, {kNotMatched, kNotMatched}) {}
+
+  /// See Context::matchWithoutBacktracking().
+  const CodeUnit *match(State<Traits> *s, bool onlyAtStart);
+
+ private:
+  const Insn *insnAt(uint32_t ip) const {
+    return reinterpret_cast<const Insn *>(&bytecode_[ip]);
+  }
+
+  /// Mark the instruction \p ip with state \p aux as reached by the thread
+  /// list for input offset \p pos. \return false if it was already reached.
+  bool markReached(uint32_t ip, uint32_t aux, uint32_t pos) {
+    if (aux != 0)
+      return reachedWithAux_.insert((uint64_t(ip) << 32) | aux).second;
+    if (reached_[ip] == pos + 1)
+      return false;
+    reached_[ip] = pos + 1;
+    return true;
+  }
+
+  /// Follow every path that does not consume input from the instruction \p ip
+  /// with state \p aux, at input offset \p pos, in priority order. Add a
+  /// thread with the captured ranges captures_ and match start \p matchStart
+  /// to \p list at each instruction that does consume input.
+  void addThreads(
+      LockstepThreadList &list,
+      uint32_t ip,
+      uint32_t aux,
+      uint32_t pos,
+      uint32_t matchStart);
+
+  /// Push the work items for a choice between entering the body of \p loop at
+  /// \p ip and exiting it.
+  void pushLoopChoice(const BeginLoopInsn *loop, uint32_t ip) {
+    WorkItem exit{WorkItem::Kind::Explore, loop->notTakenTarget, 0, {}};
+    WorkItem enter{WorkItem::Kind::EnterLoopBody, ip, 0, {}};
+    // The work stack is LIFO, so push the preferred choice last.
+    work_.push_back(loop->greedy ? exit : enter);
+    work_.push_back(loop->greedy ? enter : exit);
+  }
+
+  /// Advance the thread \p thread, whose captured ranges have been copied to
+  /// captures_, past the code unit \p c at input offset \p pos, adding the
+  /// resulting threads to \p list.
+  void step(
+      LockstepThreadList &list,
+      const LockstepThread &thread,
+      CodeUnit c,
+      uint32_t pos);
+};
+
+template <class Traits>
+void LockstepMatcher<Traits>::addThreads(
+    LockstepThreadList &list,
+    uint32_t ip,
+    uint32_t aux,
+    uint32_t pos,
+    uint32_t matchStart) {
+  using Kind = typename WorkItem::Kind;
+  const Cursor<Traits> c{ctx_.first_, ctx_.first_ + pos, ctx_.last_, true};
+  const auto flags = ctx_.flags_;
+  auto explore = [this](uint32_t target, uint32_t targetAux = 0) {
+    work_.push_back(WorkItem{Kind::Explore, target, targetAux, {}});
+  };
+  auto restoreCapture = [this](uint32_t mexp) {
+    work_.push_back(WorkItem{Kind::RestoreCapture, mexp, 0, captures_[mexp]});
+  };
+
+  explore(ip, aux);
+  while (!work_.empty()) {
+    WorkItem item = work_.back();
+    work_.pop_back();
+    switch (item.kind) {
+      case Kind::Explore:
+        break;
+      case Kind::AddThread:
+        list.threads.push_back(LockstepThread{item.ip, item.aux, matchStart});
+        list.captures.insert(
+            list.captures.end(), captures_.begin(), captures_.end());
+        continue;
+      case Kind::RestoreCapture:
+        captures_[item.ip] = item.range;
+        continue;
+      case Kind::EnterLoopBody: {
+        // Reset the capture groups in the loop body, restoring them once the
+        // paths through the body have been followed.
+        const auto *loop = llvh::cast<BeginLoopInsn>(insnAt(item.ip));
+        for (uint32_t mexp = loop->mexpBegin; mexp != loop->mexpEnd; mexp++) {
+          restoreCapture(mexp);
+          captures_[mexp] = {kNotMatched, kNotMatched};
+        }
+        item.ip += sizeof(BeginLoopInsn);
+        break;
+      }
+    }
+
+    if (!markReached(item.ip, item.aux, pos))
+      continue;
+    const Insn *base = insnAt(item.ip);
+    switch (base->opcode) {
+      case Opcode::Goal:
+      case Opcode::MatchAny:
+      case Opcode::MatchAnyButNewline:
+      case Opcode::MatchChar8:
+      case Opcode::MatchChar16:
+      case Opcode::MatchCharICase8:
+      case Opcode::MatchCharICase16:
+      case Opcode::MatchNChar8:
+      case Opcode::MatchNCharICase8:
+      case Opcode::Bracket:
+        list.threads.push_back(LockstepThread{item.ip, item.aux, matchStart});
+        list.captures.insert(
+            list.captures.end(), captures_.begin(), captures_.end());
+        break;
+
+      case Opcode::LeftAnchor:
+        if (matchesLeftAnchor(ctx_, c))
+          explore(item.ip + sizeof(LeftAnchorInsn));
+        break;
+
+      case Opcode::RightAnchor:
+        if (matchesRightAnchor(ctx_, c))
+          explore(item.ip + sizeof(RightAnchorInsn));
+        break;
+
+      case Opcode::WordBoundary: {
+        const auto *insn = llvh::cast<WordBoundaryInsn>(base);
+        if (matchesWordBoundary(ctx_, c) ^ insn->invert)
+          explore(item.ip + sizeof(WordBoundaryInsn));
+        break;
+      }
+
+      case Opcode::Alternation: {
+        const auto *alt = llvh::cast<AlternationInsn>(base);
+        if (c.satisfiesConstraints(flags, alt->secondaryConstraints))
+          explore(alt->secondaryBranch);
+        if (c.satisfiesConstraints(flags, alt->primaryConstraints))
+          explore(item.ip + sizeof(AlternationInsn));
+        break;
+      }
+
+      case Opcode::Jump32:
+        explore(llvh::cast<Jump32Insn>(base)->target);
+        break;
+
+      case Opcode::BeginMarkedSubexpression: {
+        const auto *insn = llvh::cast<BeginMarkedSubexpressionInsn>(base);
+        restoreCapture(insn->mexp);
+        captures_[insn->mexp].start = pos;
+        explore(item.ip + sizeof(BeginMarkedSubexpressionInsn));
+        break;
+      }
+
+      case Opcode::EndMarkedSubexpression: {
+        const auto *insn = llvh::cast<EndMarkedSubexpressionInsn>(base);
+        restoreCapture(insn->mexp);
+        captures_[insn->mexp].end = pos;
+        explore(item.ip + sizeof(EndMarkedSubexpressionInsn));
+        break;
+      }
+
+      case Opcode::BeginLoop: {
+        // Entering the loop from outside, with no iterations so far. The loop
+        // is backtrack-free, so min <= 1 and max is at most 1 or unbounded.
+        const auto *loop = llvh::cast<BeginLoopInsn>(base);
+        if (!c.satisfiesConstraints(flags, loop->loopeeConstraints)) {
+          if (loop->min == 0)
+            explore(loop->notTakenTarget);
+        } else if (loop->min > 0) {
+          work_.push_back(WorkItem{Kind::EnterLoopBody, item.ip, 0, {}});
+        } else if (loop->max == 0) {
+          explore(loop->notTakenTarget);
+        } else {
+          pushLoopChoice(loop, item.ip);
+        }
+        break;
+      }
+
+      case Opcode::EndLoop: {
+        // At least one iteration has completed, so the minimum is met. The
+        // body cannot match the empty string, so the empty iteration check
+        // does not apply.
+        uint32_t loopIp = llvh::cast<EndLoopInsn>(base)->target;
+        const auto *loop = llvh::cast<BeginLoopInsn>(insnAt(loopIp));
+        if (loop->max <= 1)
+          explore(loop->notTakenTarget);
+        else
+          pushLoopChoice(loop, loopIp);
+        break;
+      }
+
+      case Opcode::BeginSimpleLoop: {
+        // Simple loops are greedy. Constraints are checked on every iteration,
+        // which is harmless because a body that cannot match never matches.
+        const auto *loop = llvh::cast<BeginSimpleLoopInsn>(base);
+        explore(loop->notTakenTarget);
+        if (c.satisfiesConstraints(flags, loop->loopeeConstraints))
+          explore(item.ip + sizeof(BeginSimpleLoopInsn));
+        break;
+      }
+
+      case Opcode::EndSimpleLoop:
+        explore(llvh::cast<EndSimpleLoopInsn>(base)->target);
+        break;
+
+      case Opcode::Width1Loop: {
+        // The iteration count is carried in aux.
+        const auto *loop = llvh::cast<Width1LoopInsn>(base);
+        WorkItem exit{Kind::Explore, loop->notTakenTarget, 0, {}};
+        WorkItem body{Kind::AddThread, item.ip, item.aux, {}};
+        bool canExit = item.aux >= loop->min;
+        bool canLoop = item.aux < loop->max;
+        if (loop->greedy) {
+          if (canExit)
+            work_.push_back(exit);
+          if (canLoop)
+            work_.push_back(body);
+        } else {
+          if (canLoop)
+            work_.push_back(body);
+          if (canExit)
+            work_.push_back(exit);
+        }
+        break;
+      }
+
+      case Opcode::U16MatchAny:
+      case Opcode::U16MatchAnyButNewline:
+      case Opcode::U16MatchChar32:
+      case Opcode::U16MatchCharICase32:
+      case Opcode::U16Bracket:
+      case Opcode::BackRef:
+      case Opcode::Lookaround:
+        llvm_unreachable("Instruction requires backtracking");
+    }
+  }
+}
+
+template <class Traits>
+void LockstepMatcher<Traits>::step(
+    LockstepThreadList &list,
+    const LockstepThread &thread,
+    CodeUnit c,
+    uint32_t pos) {
+  const Insn *base = insnAt(thread.ip);
+  uint32_t width;
+  switch (base->opcode) {
+    case Opcode::MatchNChar8: {
+      const auto *insn = llvh::cast<MatchNChar8Insn>(base);
+      const char *chars = reinterpret_cast<const char *>(insn + 1);
+      if (c != chars[thread.aux])
+        return;
+      if (thread.aux + 1 < insn->charCount)
+        addThreads(list, thread.ip, thread.aux + 1, pos + 1, thread.matchStart);
+      else
+        addThreads(
+            list, thread.ip + insn->totalWidth(), 0, pos + 1, thread.matchStart);
+      return;
+    }
+
+    case Opcode::MatchNCharICase8: {
+      const auto *insn = llvh::cast<MatchNCharICase8Insn>(base);
+      const char *chars = reinterpret_cast<const char *>(insn + 1);
+      char instC = chars[thread.aux];
+      if (c != instC &&
+          (char32_t)ctx_.traits_.canonicalize(c, false) != (char32_t)instC)
+        return;
+      if (thread.aux + 1 < insn->charCount)
+        addThreads(list, thread.ip, thread.aux + 1, pos + 1, thread.matchStart);
+      else
+        addThreads(
+            list, thread.ip + insn->totalWidth(), 0, pos + 1, thread.matchStart);
+      return;
+    }
+
+    case Opcode::Width1Loop: {
+      const auto *loop = llvh::cast<Width1LoopInsn>(base);
+      if (!ctx_.matchWidth1(static_cast<const Insn *>(&loop[1]), c))
+        return;
+      // Iteration counts past the minimum are indistinguishable in an
+      // unbounded loop, so merge them to keep the number of threads bounded.
+      uint32_t iterations = thread.aux + 1;
+      if (loop->max == std::numeric_limits<uint32_t>::max())
+        iterations = std::min(iterations, loop->min);
+      addThreads(list, thread.ip, iterations, pos + 1, thread.matchStart);
+      return;
+    }
+
+    case Opcode::Bracket:
+      if (ctx_.matchWidth1(base, c))
+        addThreads(
+            list,
+            thread.ip + llvh::cast<BracketInsn>(base)->totalWidth(),
+            0,
+            pos + 1,
+            thread.matchStart);
+      return;
+
+    case Opcode::MatchAny:
+      width = sizeof(MatchAnyInsn);
+      break;
+    case Opcode::MatchAnyButNewline:
+      width = sizeof(MatchAnyButNewlineInsn);
+      break;
+    case Opcode::MatchChar8:
+      width = sizeof(MatchChar8Insn);
+      break;
+    case Opcode::MatchChar16:
+      width = sizeof(MatchChar16Insn);
+      break;
+    case Opcode::MatchCharICase8:
+      width = sizeof(MatchCharICase8Insn);
+      break;
+    case Opcode::MatchCharICase16:
+      width = sizeof(MatchCharICase16Insn);
+      break;
+
+    default:
+      llvm_unreachable("Thread waiting at an instruction that does not consume");
+  }
+
+  // The remaining instructions are fixed-size Width1 instructions.
+  if (ctx_.matchWidth1(base, c))
+    addThreads(list, thread.ip + width, 0, pos + 1, thread.matchStart);
+}
+
+template <class Traits>
+auto LockstepMatcher<Traits>::match(State<Traits> *s, bool onlyAtStart)
+    -> const CodeUnit * {
+  assert(s->cursor_.forwards() && "Lockstep matching is only forwards");
+  const CodeUnit *const first = ctx_.first_;
+  const uint32_t startPos = s->cursor_.offsetFromLeft();
+  const uint32_t length = ctx_.last_ - first;
+  const uint32_t startIp = s->ip_;
+
+  const auto *header =
+      reinterpret_cast<const RegexBytecodeHeader *>(ctx_.bytecodeStream_.data());
+  const bool usePrefilter =
+      !onlyAtStart && (header->prefixLength || header->firstCharCount);
+
+  LockstepThreadList current, next;
+  const CodeUnit *matchStart = nullptr;
+
+  for (uint32_t pos = startPos;; ++pos) {
+    // Start a new match attempt at this position, with the lowest priority,
+    // until a match is found.
+    if (!matchStart && (pos == startPos || !onlyAtStart)) {
+      if (usePrefilter && current.empty()) {
+        size_t index = ctx_.nextPrefilterCandidate(
+            header, first + startPos, pos - startPos, length - startPos);
+        if (index > length - startPos)
+          break;
+        pos = startPos + index;
+      }
+      std::fill(
+          captures_.begin(),
+          captures_.end(),
+          CapturedRange{kNotMatched, kNotMatched});
+      addThreads(current, startIp, 0, pos, pos);
+    }
+    if (current.empty()) {
+      // Every attempt so far has failed. Try the next start position, if any.
+      if (matchStart || onlyAtStart || pos == length)
+        break;
+      continue;
+    }
+
+    // Advance each thread past the code unit at pos, in priority order. A
+    // thread at the goal has matched, and lower priority threads are dropped.
+    reachedWithAux_.clear();
+    next.clear();
+    for (size_t i = 0, e = current.threads.size(); i < e; ++i) {
+      const LockstepThread &thread = current.threads[i];
+      const CapturedRange *threadCaptures = &current.captures[i * markedCount_];
+      if (insnAt(thread.ip)->opcode == Opcode::Goal) {
+        matchStart = first + thread.matchStart;
+        std::copy_n(threadCaptures, markedCount_, s->capturedRanges_.begin());
+        s->cursor_.setCurrentPointer(first + pos);
+        break;
+      }
+      if (pos == length)
+        continue;
+      std::copy_n(threadCaptures, markedCount_, captures_.begin());
+      step(next, thread, first[pos], pos);
+    }
+    if (pos == length)
+      break;
+    std::swap(current, next);
+  }
+  return matchStart;
+}
+
+template <class Traits>
+auto Context<Traits>::matchWithoutBacktracking(
+    State<Traits> *s,
+    bool onlyAtStart) -> const CodeUnit * {
+  return LockstepMatcher<Traits>(*this).match(s, onlyAtStart);
+}
+
 /// Entry point for searching a string via regex compiled bytecode.
 /// Given the bytecode \p bytecode, search the range starting at \p first up to
 /// (not including) \p last with the flags \p matchFlags. If the search
@@ -1477,7 +2094,8 @@ MatchRuntimeResult searchWithBytecodeImpl(
     uint32_t start,
     uint32_t length,
     std::vector<CapturedRange> *m,
-    constants::MatchFlagType matchFlags) {
+    constants::MatchFlagType matchFlags,
+    const JITCompiledRegex *jit) {
   assert(
       bytecode.size() >= sizeof(RegexBytecodeHeader) && "Bytecode too small");
   auto header = reinterpret_cast<const RegexBytecodeHeader *>(bytecode.data());
@@ -1488,6 +2106,32 @@ MatchRuntimeResult searchWithBytecodeImpl(
   if (!cursor.satisfiesConstraints(matchFlags, header->constraints))
     return MatchRuntimeResult::NoMatch;
 
+  // We check only one location if either the regex pattern constrains us to, or
+  // the flags request it (via the sticky flag 'y').
+  bool onlyAtStart = (header->constraints & MatchConstraintAnchoredAtStart) ||
+      (matchFlags & constants::matchOnlyAtStart);
+
+  if (jit) {
+    // The compiled code tries every location, so skip to the first one the
+    // prefilter accepts.
+    uint32_t jitStart = start;
+    if (!onlyAtStart && (header->prefixLength || header->firstCharCount)) {
+      size_t index = Context<Traits>::nextPrefilterCandidate(
+          header, first + start, 0, length - start);
+      if (index > length - start)
+        return MatchRuntimeResult::NoMatch;
+      jitStart += index;
+    }
+    switch (jit->search(first, jitStart, length, onlyAtStart, matchFlags, m)) {
+      case JITCompiledRegex::Result::Match:
+        return MatchRuntimeResult::Match;
+      case JITCompiledRegex::Result::NoMatch:
+        return MatchRuntimeResult::NoMatch;
+      case JITCompiledRegex::Result::Fallback:
+        break;
+    }
+  }
+
   auto markedCount = header->markedCount;
   auto loopCount = header->loopCount;
 
@@ -1501,13 +2145,32 @@ MatchRuntimeResult searchWithBytecodeImpl(
       header->loopCount);
   State<Traits> state{cursor, markedCount, loopCount};
 
-  // We check only one location if either the regex pattern constrains us to, or
-  // the flags request it (via the sticky flag 'y').
-  bool onlyAtStart = (header->constraints & MatchConstraintAnchoredAtStart) ||
-      (matchFlags & constants::matchOnlyAtStart);
+  const CharT *matchStartLoc = nullptr;
+  if (header->backtrackFree && (matchFlags & constants::matchNonBacktracking)) {
+    matchStartLoc = ctx.matchWithoutBacktracking(&state, onlyAtStart);
+  } else {
+    // The backtracking executor is usually much faster, but may take
+    // exponential time. If the regex can be executed without backtracking,
+    // limit the backtracks to a number proportional to the input length, then
+    // switch executors. This bounds the total time linearly.
+    if (header->backtrackFree) {
+      ctx.backtracksRemaining_ = std::min<uint64_t>(
+          kBacktrackLimit,
+          std::max<uint64_t>(
+              kMinFallbackBacktracks,
+              uint64_t(length) * kFallbackBacktracksPerCodeUnit));
+    }
+    matchStartLoc = ctx.match(&state, onlyAtStart);
+    if (header->backtrackFree &&
+        ctx.error_ == MatchRuntimeErrorType::MaxStackDepth) {
+      ctx.error_ = MatchRuntimeErrorType::None;
+      state = State<Traits>{cursor, markedCount, loopCount};
+      matchStartLoc = ctx.matchWithoutBacktracking(&state, onlyAtStart);
+    }
+  }
 
   auto result = MatchRuntimeResult::NoMatch;
-  if (const CharT *matchStartLoc = ctx.match(&state, onlyAtStart)) {
+  if (matchStartLoc) {
     // Match succeeded. Return captured ranges. The first range is the total
     // match, followed by any capture groups.
     if (m != nullptr) {
@@ -1535,9 +2198,10 @@ MatchRuntimeResult searchWithBytecode(
     uint32_t start,
     uint32_t length,
     std::vector<CapturedRange> *m,
-    constants::MatchFlagType matchFlags) {
+    constants::MatchFlagType matchFlags,
+    const JITCompiledRegex *jit) {
   return searchWithBytecodeImpl<char16_t, UTF16RegexTraits>(
-      bytecode, first, start, length, m, matchFlags);
+      bytecode, first, start, length, m, matchFlags, jit);
 }
 
 MatchRuntimeResult searchWithBytecode(
@@ -1546,9 +2210,10 @@ MatchRuntimeResult searchWithBytecode(
     uint32_t start,
     uint32_t length,
     std::vector<CapturedRange> *m,
-    constants::MatchFlagType matchFlags) {
+    constants::MatchFlagType matchFlags,
+    const JITCompiledRegex *jit) {
   return searchWithBytecodeImpl<char, ASCIIRegexTraits>(
-      bytecode, first, start, length, m, matchFlags);
+      bytecode, first, start, length, m, matchFlags, jit);
 }
 
 } // namespace regex
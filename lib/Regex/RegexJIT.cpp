@@ -0,0 +1,994 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/Regex/RegexJIT.h"
+
+#include "hermes/Regex/RegexTypes.h"
+
+#include "llvh/ADT/SmallVector.h"
+#include "llvh/Support/Casting.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// This file contains a compiler from regex bytecode to x86-64 code.
+
+namespace hermes {
+namespace regex {
+
+#ifdef HERMES_REGEX_JIT
+
+namespace {
+
+/// x86-64 general purpose registers, numbered as in instruction encodings.
+enum Reg : uint8_t {
+  RAX = 0,
+  RCX = 1,
+  RDX = 2,
+  RSP = 4,
+  RSI = 6,
+  RDI = 7,
+  R8 = 8,
+  R9 = 9,
+  R10 = 10,
+  R11 = 11,
+};
+
+/// Condition codes, as encoded in Jcc and CMOVcc.
+enum class Cond : uint8_t {
+  B = 0x2,
+  AE = 0x3,
+  E = 0x4,
+  NE = 0x5,
+  BE = 0x6,
+  A = 0x7,
+};
+
+/// A minimal assembler for the handful of x86-64 instructions the regex
+/// compiler needs. All jumps use 32 bit displacements, which are resolved by
+/// finish().
+class Assembler {
+ public:
+  using Label = uint32_t;
+
+  Label newLabel() {
+    labelOffsets_.push_back(-1);
+    return labelOffsets_.size() - 1;
+  }
+
+  void bind(Label label) {
+    assert(labelOffsets_[label] < 0 && "Label bound twice");
+    labelOffsets_[label] = code_.size();
+  }
+
+  size_t offset() const {
+    return code_.size();
+  }
+
+  /// Resolve all jumps. \return the code.
+  const std::vector<uint8_t> &finish() {
+    for (const auto &fixup : fixups_) {
+      assert(labelOffsets_[fixup.second] >= 0 && "Jump to unbound label");
+      int32_t rel = labelOffsets_[fixup.second] - int32_t(fixup.first + 4);
+      memcpy(&code_[fixup.first], &rel, sizeof(rel));
+    }
+    fixups_.clear();
+    return code_;
+  }
+
+  void jmp(Label label) {
+    byte(0xE9);
+    rel32(label);
+  }
+
+  void jcc(Cond cond, Label label) {
+    byte(0x0F);
+    byte(0x80 | uint8_t(cond));
+    rel32(label);
+  }
+
+  /// movzx dst32, byte/word [base + disp]
+  void movzx(Reg dst, bool wide, Reg base, int32_t disp) {
+    rex(false, dst, base);
+    byte(0x0F);
+    byte(wide ? 0xB7 : 0xB6);
+    mem(dst, base, disp);
+  }
+
+  /// lea dst, [base + disp]
+  void lea(bool w, Reg dst, Reg base, int32_t disp) {
+    rex(w, dst, base);
+    byte(0x8D);
+    mem(dst, base, disp);
+  }
+
+  /// cmp r, imm32
+  void cmpImm(bool w, Reg r, int32_t imm) {
+    aluImm(w, 7, r, imm);
+  }
+
+  /// add r64, imm32
+  void addImm(Reg r, int32_t imm) {
+    aluImm(true, 0, r, imm);
+  }
+
+  /// sub r64, imm32
+  void subImm(Reg r, int32_t imm) {
+    aluImm(true, 5, r, imm);
+  }
+
+  /// cmp a, b
+  void cmp(bool w, Reg a, Reg b) {
+    aluReg(w, 0x39, a, b);
+  }
+
+  /// mov dst, src
+  void mov(bool w, Reg dst, Reg src) {
+    aluReg(w, 0x89, dst, src);
+  }
+
+  /// sub dst64, src64
+  void sub(Reg dst, Reg src) {
+    aluReg(true, 0x29, dst, src);
+  }
+
+  /// xor dst32, src32
+  void xor32(Reg dst, Reg src) {
+    aluReg(false, 0x31, dst, src);
+  }
+
+  /// test a32, b32
+  void test32(Reg a, Reg b) {
+    aluReg(false, 0x85, a, b);
+  }
+
+  /// shr r64, 1
+  void shr1(Reg r) {
+    rex(true, 0, r);
+    byte(0xD1);
+    modrm(3, 5, r);
+  }
+
+  /// mov r32, imm32
+  void movImm(Reg r, uint32_t imm) {
+    rex(false, 0, r);
+    byte(0xB8 | (r & 7));
+    imm32(imm);
+  }
+
+  /// cmovcc dst64, src64
+  void cmov(Cond cond, Reg dst, Reg src) {
+    rex(true, dst, src);
+    byte(0x0F);
+    byte(0x40 | uint8_t(cond));
+    modrm(3, dst, src);
+  }
+
+  /// mov [base + disp], src
+  void store(bool w, Reg base, int32_t disp, Reg src) {
+    rex(w, src, base);
+    byte(0x89);
+    mem(src, base, disp);
+  }
+
+  /// mov dst64, [base + disp]
+  void load(Reg dst, Reg base, int32_t disp) {
+    rex(true, dst, base);
+    byte(0x8B);
+    mem(dst, base, disp);
+  }
+
+  /// cmp r64, [base + disp]
+  void cmpMem(Reg r, Reg base, int32_t disp) {
+    rex(true, r, base);
+    byte(0x3B);
+    mem(r, base, disp);
+  }
+
+  /// sub qword [base + disp], 1
+  void decMem(Reg base, int32_t disp) {
+    rex(true, 0, base);
+    byte(0x83);
+    mem(5, base, disp);
+    byte(1);
+  }
+
+  void ret() {
+    byte(0xC3);
+  }
+
+ private:
+  void byte(uint8_t b) {
+    code_.push_back(b);
+  }
+
+  void imm32(uint32_t imm) {
+    for (unsigned i = 0; i < 4; ++i)
+      byte(imm >> (8 * i));
+  }
+
+  void rel32(Label label) {
+    fixups_.emplace_back(code_.size(), label);
+    imm32(0);
+  }
+
+  /// Emit a REX prefix if one is needed for a 64 bit operation (\p w), or for
+  /// the extended registers \p reg and \p rm.
+  void rex(bool w, unsigned reg, unsigned rm) {
+    uint8_t prefix = 0x40 | (w << 3) | ((reg >> 3) << 2) | (rm >> 3);
+    if (prefix != 0x40)
+      byte(prefix);
+  }
+
+  void modrm(unsigned mod, unsigned reg, unsigned rm) {
+    byte((mod << 6) | ((reg & 7) << 3) | (rm & 7));
+  }
+
+  /// Emit the ModRM byte, and the SIB byte if required, for the memory operand
+  /// [base + disp32].
+  void mem(unsigned reg, Reg base, int32_t disp) {
+    modrm(2, reg, base);
+    if ((base & 7) == RSP)
+      byte(0x24);
+    imm32(disp);
+  }
+
+  void aluImm(bool w, unsigned ext, Reg r, int32_t imm) {
+    rex(w, 0, r);
+    byte(0x81);
+    modrm(3, ext, r);
+    imm32(imm);
+  }
+
+  void aluReg(bool w, uint8_t opcode, Reg rm, Reg reg) {
+    rex(w, reg, rm);
+    byte(opcode);
+    modrm(3, reg, rm);
+  }
+
+  std::vector<uint8_t> code_;
+
+  /// The offset of each label, or -1 if it is not yet bound.
+  std::vector<int32_t> labelOffsets_;
+
+  /// The offset of each rel32 field, and the label it refers to.
+  std::vector<std::pair<uint32_t, Label>> fixups_;
+};
+
+using Label = Assembler::Label;
+
+/// An inclusive range of code units.
+struct CharRange {
+  uint32_t first;
+  uint32_t last;
+};
+
+static const CharRange kDigitRanges[] = {{'0', '9'}};
+static const CharRange kWordRanges[] =
+    {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+/// The spaces of ASCIIRegexTraits and UTF16RegexTraits respectively.
+static const CharRange kASCIISpaceRanges[] = {{0x09, 0x0D}, {0x20, 0x20}};
+static const CharRange kUTF16SpaceRanges[] = {
+    {0x09, 0x0D},
+    {0x20, 0x20},
+    {0xA0, 0xA0},
+    {0x1680, 0x1680},
+    {0x2000, 0x200A},
+    {0x2028, 0x2029},
+    {0x202F, 0x202F},
+    {0x205F, 0x205F},
+    {0x3000, 0x3000},
+    {0xFEFF, 0xFEFF}};
+static const CharRange kLineTerminatorRanges[] =
+    {{0x0A, 0x0A}, {0x0D, 0x0D}, {0x2028, 0x2029}};
+
+/// Compiles the instructions of a regex for input of one code unit size.
+///
+/// Registers hold the following values in the generated code:
+///   rdi: the first code unit of the string
+///   rsi: the current position
+///   rdx: the end of the string
+///   rcx: the CapturedRange array
+///   r8:  the position at which the current match attempt began
+///   r9:  whether to attempt a match only at the start position
+///   rax, r10, r11: scratch
+/// The stack frame holds the remaining backtrack budget, followed by two
+/// slots per width 1 loop: the position after the loop, and the limit on how
+/// far it may backtrack (greedy) or advance (non-greedy).
+class Compiler {
+ public:
+  Compiler(
+      Assembler &as,
+      const RegexBytecodeHeader *header,
+      llvh::ArrayRef<uint8_t> insns,
+      unsigned charSize)
+      : as_(as),
+        header_(header),
+        insns_(insns),
+        charSize_(charSize),
+        maxCodeUnit_(charSize == 1 ? 0xFF : 0xFFFF) {}
+
+  /// \return whether the instructions can be compiled, and if so, set
+  /// loopCount_.
+  bool validate();
+
+  /// Emit the entry point. validate() must have succeeded.
+  void emit();
+
+ private:
+  static constexpr Reg kFirst = RDI;
+  static constexpr Reg kCur = RSI;
+  static constexpr Reg kEnd = RDX;
+  static constexpr Reg kCaptures = RCX;
+  static constexpr Reg kAttempt = R8;
+  static constexpr Reg kOnlyAtStart = R9;
+  static constexpr Reg kChar = RAX;
+  static constexpr Reg kTmp1 = R10;
+  static constexpr Reg kTmp2 = R11;
+
+  /// Stack offset of the backtrack budget.
+  static constexpr int32_t kBudgetSlot = 0;
+
+  /// A width 1 loop which may be backtracked into.
+  struct LoopBacktrack {
+    const Width1LoopInsn *insn;
+    /// Where to resume after backtracking.
+    Label resume;
+    /// Where backtracking into the loop is emitted.
+    Label backtrack;
+    /// Where to go if the loop cannot backtrack any further.
+    Label fail;
+    int32_t slot;
+  };
+
+  const Insn *insnAt(uint32_t offset) const {
+    return reinterpret_cast<const Insn *>(&insns_[offset]);
+  }
+
+  /// \return whether \p insn matches exactly one code unit, in a way that
+  /// emitWidth1() supports.
+  static bool isSupportedWidth1(const Insn *insn);
+
+  /// \return the width of the instruction at \p offset, or 0 if it is not
+  /// supported.
+  uint32_t supportedWidth(uint32_t offset) const;
+
+  /// Load the code unit at kCur + \p disp into kChar.
+  void loadChar(int32_t disp) {
+    as_.movzx(kChar, charSize_ == 2, kCur, disp);
+  }
+
+  /// Jump to \p target if kChar is in any of \p ranges.
+  void emitRangeTest(llvh::ArrayRef<CharRange> ranges, Label target);
+
+  /// Jump to \p target if kChar is in the character class \p type.
+  void emitClassTest(CharacterClass::Type type, Label target);
+
+  /// Jump to \p fail unless kChar matches the width 1 instruction \p insn.
+  void emitWidth1(const Insn *insn, Label fail);
+
+  /// Store the offset of \p pos from the start of the string, in code units,
+  /// to kCaptures + \p disp.
+  void emitStoreOffset(Reg pos, int32_t disp);
+
+  /// Jump to \p fail unless kCur is at a word boundary, or if \p invert is
+  /// set, unless it is not.
+  void emitWordBoundary(bool invert, Label fail);
+
+  /// Leave the generated code returning \p result.
+  void emitReturn(uint32_t result);
+
+  void emitLoop(const Width1LoopInsn *insn, int32_t slot, Label &fail);
+  void emitLoopBacktrack(const LoopBacktrack &loop, Label exhausted);
+
+  Assembler &as_;
+  const RegexBytecodeHeader *header_;
+  llvh::ArrayRef<uint8_t> insns_;
+  const unsigned charSize_;
+  const uint32_t maxCodeUnit_;
+  uint32_t loopCount_ = 0;
+  int32_t frameSize_ = 0;
+  llvh::SmallVector<LoopBacktrack, 4> backtracks_;
+};
+
+bool Compiler::isSupportedWidth1(const Insn *insn) {
+  switch (insn->opcode) {
+    case Opcode::MatchChar8:
+    case Opcode::MatchChar16:
+    case Opcode::MatchAny:
+    case Opcode::MatchAnyButNewline:
+    case Opcode::Bracket:
+      return true;
+    default:
+      return false;
+  }
+}
+
+uint32_t Compiler::supportedWidth(uint32_t offset) const {
+  if (offset >= insns_.size())
+    return 0;
+  const Insn *insn = insnAt(offset);
+  switch (insn->opcode) {
+    case Opcode::Goal:
+      return sizeof(GoalInsn);
+    case Opcode::LeftAnchor:
+      return sizeof(LeftAnchorInsn);
+    case Opcode::RightAnchor:
+      return sizeof(RightAnchorInsn);
+    case Opcode::MatchAny:
+      return sizeof(MatchAnyInsn);
+    case Opcode::MatchAnyButNewline:
+      return sizeof(MatchAnyButNewlineInsn);
+    case Opcode::MatchChar8:
+      return sizeof(MatchChar8Insn);
+    case Opcode::MatchChar16:
+      return sizeof(MatchChar16Insn);
+    case Opcode::MatchNChar8:
+      return llvh::cast<MatchNChar8Insn>(insn)->totalWidth();
+    case Opcode::Bracket:
+      return llvh::cast<BracketInsn>(insn)->totalWidth();
+    case Opcode::WordBoundary:
+      return sizeof(WordBoundaryInsn);
+    case Opcode::BeginMarkedSubexpression:
+      return llvh::cast<BeginMarkedSubexpressionInsn>(insn)->mexp <
+              header_->markedCount
+          ? sizeof(BeginMarkedSubexpressionInsn)
+          : 0;
+    case Opcode::EndMarkedSubexpression:
+      return llvh::cast<EndMarkedSubexpressionInsn>(insn)->mexp <
+              header_->markedCount
+          ? sizeof(EndMarkedSubexpressionInsn)
+          : 0;
+    case Opcode::Width1Loop: {
+      // The body must be a single supported instruction, immediately followed
+      // by the loop exit, and the iteration count must fit in a displacement
+      // for either code unit size.
+      const auto *loop = llvh::cast<Width1LoopInsn>(insn);
+      uint32_t bodyOffset = offset + sizeof(Width1LoopInsn);
+      uint32_t bodyWidth = supportedWidth(bodyOffset);
+      if (!bodyWidth || !isSupportedWidth1(insnAt(bodyOffset)) ||
+          loop->notTakenTarget != bodyOffset + bodyWidth ||
+          loop->min > loop->max ||
+          uint64_t(loop->min) * sizeof(char16_t) > uint64_t(INT32_MAX))
+        return 0;
+      return sizeof(Width1LoopInsn) + bodyWidth;
+    }
+    default:
+      return 0;
+  }
+}
+
+bool Compiler::validate() {
+  auto flags = SyntaxFlags::fromByte(header_->syntaxFlags);
+  if (flags.ignoreCase || flags.unicode)
+    return false;
+  uint32_t offset = 0;
+  for (;;) {
+    uint32_t width = supportedWidth(offset);
+    if (!width)
+      return false;
+    const Insn *insn = insnAt(offset);
+    if (insn->opcode == Opcode::Goal)
+      break;
+    if (insn->opcode == Opcode::Width1Loop)
+      ++loopCount_;
+    offset += width;
+  }
+  // Keep the frame a multiple of 16 bytes, less the return address.
+  frameSize_ = 8 + 16 * loopCount_;
+  return frameSize_ < INT32_MAX / 2;
+}
+
+void Compiler::emitRangeTest(llvh::ArrayRef<CharRange> ranges, Label target) {
+  for (const CharRange &range : ranges) {
+    if (range.first > maxCodeUnit_)
+      continue;
+    uint32_t last = std::min(range.last, maxCodeUnit_);
+    if (range.first == last) {
+      as_.cmpImm(false, kChar, range.first);
+      as_.jcc(Cond::E, target);
+    } else {
+      as_.lea(false, kTmp1, kChar, -int32_t(range.first));
+      as_.cmpImm(false, kTmp1, last - range.first);
+      as_.jcc(Cond::BE, target);
+    }
+  }
+}
+
+void Compiler::emitClassTest(CharacterClass::Type type, Label target) {
+  switch (type) {
+    case CharacterClass::Digits:
+      return emitRangeTest(kDigitRanges, target);
+    case CharacterClass::Words:
+      return emitRangeTest(kWordRanges, target);
+    case CharacterClass::Spaces:
+      if (charSize_ == 1)
+        return emitRangeTest(kASCIISpaceRanges, target);
+      return emitRangeTest(kUTF16SpaceRanges, target);
+  }
+}
+
+void Compiler::emitWidth1(const Insn *base, Label fail) {
+  switch (base->opcode) {
+    case Opcode::MatchChar8: {
+      // The interpreter compares the instruction's char with the code unit, so
+      // a negative char never matches 16 bit input.
+      char c = llvh::cast<MatchChar8Insn>(base)->c;
+      if (charSize_ == 2 && c < 0) {
+        as_.jmp(fail);
+        return;
+      }
+      as_.cmpImm(false, kChar, uint8_t(c));
+      as_.jcc(Cond::NE, fail);
+      return;
+    }
+    case Opcode::MatchChar16: {
+      // Likewise, 8 bit input is signed in the interpreter, so code units
+      // above 0x7F never match.
+      char16_t c = llvh::cast<MatchChar16Insn>(base)->c;
+      if (charSize_ == 1 && c > 0x7F) {
+        as_.jmp(fail);
+        return;
+      }
+      as_.cmpImm(false, kChar, c);
+      as_.jcc(Cond::NE, fail);
+      return;
+    }
+    case Opcode::MatchAny:
+      return;
+    case Opcode::MatchAnyButNewline:
+      emitRangeTest(kLineTerminatorRanges, fail);
+      return;
+    case Opcode::Bracket: {
+      const auto *insn = llvh::cast<BracketInsn>(base);
+      const auto *bracketRanges =
+          reinterpret_cast<const BracketRange32 *>(insn + 1);
+      llvh::SmallVector<CharRange, 8> ranges;
+      for (uint32_t i = 0; i < insn->rangeCount; ++i)
+        ranges.push_back({bracketRanges[i].start, bracketRanges[i].end});
+
+      // Jump to inSet if the code unit is in the bracket before negation. For
+      // a negated bracket, that is a failure.
+      Label matched = as_.newLabel();
+      Label inSet = insn->negate ? fail : matched;
+      for (auto type :
+           {CharacterClass::Digits,
+            CharacterClass::Spaces,
+            CharacterClass::Words}) {
+        if (insn->positiveCharClasses & type)
+          emitClassTest(type, inSet);
+        if (insn->negativeCharClasses & type) {
+          Label inClass = as_.newLabel();
+          emitClassTest(type, inClass);
+          as_.jmp(inSet);
+          as_.bind(inClass);
+        }
+      }
+      emitRangeTest(ranges, inSet);
+      if (!insn->negate)
+        as_.jmp(fail);
+      as_.bind(matched);
+      return;
+    }
+    default:
+      llvm_unreachable("Unsupported width 1 instruction");
+  }
+}
+
+void Compiler::emitStoreOffset(Reg pos, int32_t disp) {
+  as_.mov(true, kChar, pos);
+  as_.sub(kChar, kFirst);
+  if (charSize_ == 2)
+    as_.shr1(kChar);
+  as_.store(false, kCaptures, disp, kChar);
+}
+
+void Compiler::emitWordBoundary(bool invert, Label fail) {
+  // Set kTmp2 to whether the previous code unit is a word character.
+  Label prevIsWord = as_.newLabel();
+  Label prevDone = as_.newLabel();
+  as_.xor32(kTmp2, kTmp2);
+  as_.cmp(true, kCur, kFirst);
+  as_.jcc(Cond::E, prevDone);
+  loadChar(-int32_t(charSize_));
+  emitClassTest(CharacterClass::Words, prevIsWord);
+  as_.jmp(prevDone);
+  as_.bind(prevIsWord);
+  as_.movImm(kTmp2, 1);
+  as_.bind(prevDone);
+
+  // There is a boundary if the current code unit differs.
+  Label curIsWord = as_.newLabel();
+  Label curIsNotWord = as_.newLabel();
+  Label done = as_.newLabel();
+  as_.cmp(true, kCur, kEnd);
+  as_.jcc(Cond::E, curIsNotWord);
+  loadChar(0);
+  emitClassTest(CharacterClass::Words, curIsWord);
+  as_.bind(curIsNotWord);
+  as_.test32(kTmp2, kTmp2);
+  as_.jcc(invert ? Cond::NE : Cond::E, fail);
+  as_.jmp(done);
+  as_.bind(curIsWord);
+  as_.test32(kTmp2, kTmp2);
+  as_.jcc(invert ? Cond::E : Cond::NE, fail);
+  as_.bind(done);
+}
+
+void Compiler::emitReturn(uint32_t result) {
+  as_.movImm(RAX, result);
+  as_.addImm(RSP, frameSize_);
+  as_.ret();
+}
+
+void Compiler::emitLoop(const Width1LoopInsn *insn, int32_t slot, Label &fail) {
+  const Insn *body = reinterpret_cast<const Insn *>(insn + 1);
+  const int32_t w = charSize_;
+  // The position and limit of the loop while backtracking.
+  const int32_t posSlot = slot;
+  const int32_t limitSlot = slot + 8;
+  // A maximum beyond any string length is treated as unbounded.
+  const bool bounded = insn->max != std::numeric_limits<uint32_t>::max() &&
+      uint64_t(insn->max) * w <= uint64_t(INT32_MAX);
+  const bool canBacktrack = insn->min != insn->max;
+
+  Label top = as_.newLabel();
+  Label done = as_.newLabel();
+  if (insn->greedy) {
+    // Match as many iterations as possible, up to the limit in kTmp2.
+    as_.lea(true, kTmp1, kCur, insn->min * w);
+    as_.store(true, RSP, limitSlot, kTmp1);
+    if (bounded) {
+      as_.lea(true, kTmp2, kCur, insn->max * w);
+      as_.cmp(true, kTmp2, kEnd);
+      as_.cmov(Cond::A, kTmp2, kEnd);
+    } else {
+      as_.mov(true, kTmp2, kEnd);
+    }
+    as_.bind(top);
+    as_.cmp(true, kCur, kTmp2);
+    as_.jcc(Cond::AE, done);
+    loadChar(0);
+    emitWidth1(body, done);
+    as_.addImm(kCur, w);
+    as_.jmp(top);
+    as_.bind(done);
+    // Fewer iterations than the minimum is a failure. Backtracking gives back
+    // one iteration at a time, down to the minimum.
+    as_.cmpMem(kCur, RSP, limitSlot);
+    as_.jcc(Cond::B, fail);
+  } else {
+    // Match the minimum number of iterations.
+    as_.lea(true, kTmp2, kCur, insn->min * w);
+    as_.cmp(true, kTmp2, kEnd);
+    as_.jcc(Cond::A, fail);
+    as_.bind(top);
+    as_.cmp(true, kCur, kTmp2);
+    as_.jcc(Cond::AE, done);
+    loadChar(0);
+    emitWidth1(body, fail);
+    as_.addImm(kCur, w);
+    as_.jmp(top);
+    as_.bind(done);
+    if (canBacktrack) {
+      // Backtracking takes one more iteration at a time, up to the maximum.
+      if (bounded) {
+        as_.lea(true, kTmp2, kCur, (insn->max - insn->min) * w);
+        as_.cmp(true, kTmp2, kEnd);
+        as_.cmov(Cond::A, kTmp2, kEnd);
+      } else {
+        as_.mov(true, kTmp2, kEnd);
+      }
+      as_.store(true, RSP, limitSlot, kTmp2);
+    }
+  }
+  if (!canBacktrack)
+    return;
+
+  LoopBacktrack loop{insn, as_.newLabel(), as_.newLabel(), fail, posSlot};
+  as_.bind(loop.resume);
+  as_.store(true, RSP, posSlot, kCur);
+  backtracks_.push_back(loop);
+  fail = loop.backtrack;
+}
+
+void Compiler::emitLoopBacktrack(const LoopBacktrack &loop, Label exhausted) {
+  const int32_t w = charSize_;
+  const int32_t limitSlot = loop.slot + 8;
+  as_.bind(loop.backtrack);
+  as_.decMem(RSP, kBudgetSlot);
+  as_.jcc(Cond::E, exhausted);
+  as_.load(kCur, RSP, loop.slot);
+  as_.cmpMem(kCur, RSP, limitSlot);
+  if (loop.insn->greedy) {
+    as_.jcc(Cond::BE, loop.fail);
+    as_.subImm(kCur, w);
+  } else {
+    as_.jcc(Cond::AE, loop.fail);
+    loadChar(0);
+    emitWidth1(reinterpret_cast<const Insn *>(loop.insn + 1), loop.fail);
+    as_.addImm(kCur, w);
+  }
+  as_.jmp(loop.resume);
+}
+
+void Compiler::emit() {
+  const int32_t w = charSize_;
+  const bool multiline = SyntaxFlags::fromByte(header_->syntaxFlags).multiline;
+
+  // Prologue: budget is the sixth argument, in r9. onlyAtStart arrives in r8,
+  // and the start position in rsi.
+  as_.subImm(RSP, frameSize_);
+  as_.store(true, RSP, kBudgetSlot, R9);
+  as_.mov(false, kOnlyAtStart, R8);
+  as_.mov(true, kAttempt, RSI);
+
+  Label attempt = as_.newLabel();
+  Label nextAttempt = as_.newLabel();
+  Label exhausted = as_.newLabel();
+  as_.bind(attempt);
+  as_.mov(true, kCur, kAttempt);
+
+  // The innermost place to go on failure.
+  Label fail = nextAttempt;
+  int32_t nextSlot = 8;
+  for (uint32_t offset = 0;;) {
+    const Insn *base = insnAt(offset);
+    offset += supportedWidth(offset);
+    switch (base->opcode) {
+      case Opcode::Goal:
+        emitStoreOffset(kAttempt, 0);
+        emitStoreOffset(kCur, 4);
+        emitReturn(1);
+        break;
+
+      case Opcode::LeftAnchor: {
+        Label ok = as_.newLabel();
+        as_.cmp(true, kCur, kFirst);
+        as_.jcc(Cond::E, ok);
+        if (multiline) {
+          loadChar(-w);
+          emitRangeTest(kLineTerminatorRanges, ok);
+        }
+        as_.jmp(fail);
+        as_.bind(ok);
+        continue;
+      }
+
+      case Opcode::RightAnchor: {
+        Label ok = as_.newLabel();
+        as_.cmp(true, kCur, kEnd);
+        as_.jcc(Cond::E, ok);
+        if (multiline) {
+          loadChar(0);
+          emitRangeTest(kLineTerminatorRanges, ok);
+        }
+        as_.jmp(fail);
+        as_.bind(ok);
+        continue;
+      }
+
+      case Opcode::WordBoundary:
+        emitWordBoundary(llvh::cast<WordBoundaryInsn>(base)->invert, fail);
+        continue;
+
+      case Opcode::MatchNChar8: {
+        const auto *insn = llvh::cast<MatchNChar8Insn>(base);
+        const char *chars = reinterpret_cast<const char *>(insn + 1);
+        as_.mov(true, kTmp1, kEnd);
+        as_.sub(kTmp1, kCur);
+        as_.cmpImm(true, kTmp1, insn->charCount * w);
+        as_.jcc(Cond::B, fail);
+        for (uint32_t i = 0; i < insn->charCount; ++i) {
+          if (charSize_ == 2 && chars[i] < 0) {
+            as_.jmp(fail);
+            break;
+          }
+          loadChar(i * w);
+          as_.cmpImm(false, kChar, uint8_t(chars[i]));
+          as_.jcc(Cond::NE, fail);
+        }
+        as_.addImm(kCur, insn->charCount * w);
+        continue;
+      }
+
+      case Opcode::BeginMarkedSubexpression: {
+        const auto *insn = llvh::cast<BeginMarkedSubexpressionInsn>(base);
+        emitStoreOffset(kCur, (insn->mexp + 1) * sizeof(CapturedRange));
+        continue;
+      }
+
+      case Opcode::EndMarkedSubexpression: {
+        const auto *insn = llvh::cast<EndMarkedSubexpressionInsn>(base);
+        emitStoreOffset(kCur, (insn->mexp + 1) * sizeof(CapturedRange) + 4);
+        continue;
+      }
+
+      case Opcode::Width1Loop:
+        emitLoop(llvh::cast<Width1LoopInsn>(base), nextSlot, fail);
+        nextSlot += 16;
+        continue;
+
+      default:
+        assert(isSupportedWidth1(base) && "Instruction was not validated");
+        as_.cmp(true, kCur, kEnd);
+        as_.jcc(Cond::AE, fail);
+        loadChar(0);
+        emitWidth1(base, fail);
+        as_.addImm(kCur, w);
+        continue;
+    }
+    break;
+  }
+
+  // Try the next start position, including the empty range at the end.
+  as_.bind(nextAttempt);
+  Label noMatch = as_.newLabel();
+  as_.test32(kOnlyAtStart, kOnlyAtStart);
+  as_.jcc(Cond::NE, noMatch);
+  as_.cmp(true, kAttempt, kEnd);
+  as_.jcc(Cond::AE, noMatch);
+  as_.addImm(kAttempt, w);
+  as_.jmp(attempt);
+  as_.bind(noMatch);
+  emitReturn(0);
+
+  for (const LoopBacktrack &loop : backtracks_)
+    emitLoopBacktrack(loop, exhausted);
+
+  as_.bind(exhausted);
+  emitReturn(2);
+}
+
+} // namespace
+
+std::unique_ptr<JITCompiledRegex> JITCompiledRegex::compile(
+    llvh::ArrayRef<uint8_t> bytecode) {
+  assert(
+      bytecode.size() >= sizeof(RegexBytecodeHeader) && "Bytecode too small");
+  const auto *header =
+      reinterpret_cast<const RegexBytecodeHeader *>(bytecode.data());
+  auto insns = bytecode.slice(sizeof(RegexBytecodeHeader));
+
+  Assembler as;
+  Compiler ascii(as, header, insns, 1);
+  if (!ascii.validate())
+    return nullptr;
+  ascii.emit();
+  size_t utf16EntryOffset = as.offset();
+  Compiler utf16(as, header, insns, 2);
+  bool valid = utf16.validate();
+  (void)valid;
+  assert(valid && "Validation should not depend on the code unit size");
+  utf16.emit();
+  const std::vector<uint8_t> &code = as.finish();
+
+  using llvh::sys::Memory;
+  std::error_code ec;
+  llvh::sys::OwningMemoryBlock memory{Memory::allocateMappedMemory(
+      code.size(), nullptr, Memory::MF_READ | Memory::MF_WRITE, ec)};
+  if (ec)
+    return nullptr;
+  memcpy(memory.base(), code.data(), code.size());
+  if (Memory::protectMappedMemory(
+          memory.getMemoryBlock(), Memory::MF_READ | Memory::MF_EXEC))
+    return nullptr;
+  Memory::InvalidateInstructionCache(memory.base(), code.size());
+
+  return std::unique_ptr<JITCompiledRegex>(new JITCompiledRegex(
+      std::move(memory), code.size(), utf16EntryOffset, header->markedCount));
+}
+
+JITCompiledRegex::JITCompiledRegex(
+    llvh::sys::OwningMemoryBlock memory,
+    size_t codeSize,
+    size_t utf16EntryOffset,
+    uint16_t markedCount)
+    : memory_(std::move(memory)),
+      codeSize_(codeSize),
+      asciiEntry_(reinterpret_cast<EntryPoint>(memory_.base())),
+      utf16Entry_(reinterpret_cast<EntryPoint>(
+          static_cast<uint8_t *>(memory_.base()) + utf16EntryOffset)),
+      markedCount_(markedCount) {}
+
+template <typename CharT>
+auto JITCompiledRegex::searchImpl(
+    EntryPoint entry,
+    const CharT *first,
+    uint32_t start,
+    uint32_t length,
+    bool onlyAtStart,
+    constants::MatchFlagType matchFlags,
+    std::vector<CapturedRange> *captures) const -> Result {
+  assert(start <= length && "Start is past the end");
+  // Right anchors are compiled without regard to this flag.
+  if (matchFlags & constants::matchNotEndOfLine)
+    return Result::Fallback;
+
+  std::vector<CapturedRange> scratch;
+  if (!captures)
+    captures = &scratch;
+  captures->assign(markedCount_ + 1, CapturedRange{kNotMatched, kNotMatched});
+
+  // Give the compiled code the budget the interpreter would have before
+  // switching to the non-backtracking executor. If it runs out, let the
+  // interpreter decide how to proceed.
+  uint64_t budget = std::min<uint64_t>(
+      kBacktrackLimit,
+      std::max<uint64_t>(
+          kMinFallbackBacktracks,
+          uint64_t(length) * kFallbackBacktracksPerCodeUnit));
+  switch (entry(
+      first,
+      first + start,
+      first + length,
+      captures->data(),
+      onlyAtStart,
+      budget)) {
+    case 0:
+      return Result::NoMatch;
+    case 1:
+      return Result::Match;
+    default:
+      return Result::Fallback;
+  }
+}
+
+auto JITCompiledRegex::search(
+    const char *first,
+    uint32_t start,
+    uint32_t length,
+    bool onlyAtStart,
+    constants::MatchFlagType matchFlags,
+    std::vector<CapturedRange> *captures) const -> Result {
+  return searchImpl(
+      asciiEntry_, first, start, length, onlyAtStart, matchFlags, captures);
+}
+
+auto JITCompiledRegex::search(
+    const char16_t *first,
+    uint32_t start,
+    uint32_t length,
+    bool onlyAtStart,
+    constants::MatchFlagType matchFlags,
+    std::vector<CapturedRange> *captures) const -> Result {
+  return searchImpl(
+      utf16Entry_, first, start, length, onlyAtStart, matchFlags, captures);
+}
+
+#else // HERMES_REGEX_JIT
+
+std::unique_ptr<JITCompiledRegex> JITCompiledRegex::compile(
+    llvh::ArrayRef<uint8_t> bytecode) {
+  return nullptr;
+}
+
+auto JITCompiledRegex::search(
+    const char *,
+    uint32_t,
+    uint32_t,
+    bool,
+    constants::MatchFlagType,
+    std::vector<CapturedRange> *) const -> Result {
+  return Result::Fallback;
+}
+
+auto JITCompiledRegex::search(
+    const char16_t *,
+    uint32_t,
+    uint32_t,
+    bool,
+    constants::MatchFlagType,
+    std::vector<CapturedRange> *) const -> Result {
+  return Result::Fallback;
+}
+
+#endif // HERMES_REGEX_JIT
+
+} // namespace regex
+} // namespace hermes
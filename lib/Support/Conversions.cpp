@@ -9,7 +9,9 @@
 
 #include "dtoa/dtoa.h"
 
+#include <cfloat>
 #include <cmath>
+#include <cstring>
 
 namespace hermes {
 
@@ -55,10 +57,43 @@ int32_t truncateToInt32SlowPath(double d) {
   }
 }
 
+/// Format an integral double with magnitude below 2**53 directly, without
+/// going through dtoa. Every such value is exactly representable as an int64_t
+/// and ES5.1 9.8.1 prints it as its plain decimal digits.
+static size_t integralNumberToString(double m, char *dest) {
+  int64_t n = static_cast<int64_t>(m);
+  uint64_t u = n < 0 ? 0 - static_cast<uint64_t>(n) : n;
+
+  // Write the digits in reverse into a temporary buffer.
+  char tmp[NUMBER_TO_STRING_BUF_SIZE];
+  char *p = tmp + sizeof(tmp);
+  do {
+    *--p = '0' + (u % 10);
+    u /= 10;
+  } while (u);
+
+  char *destPtr = dest;
+  if (n < 0)
+    *destPtr++ = '-';
+  size_t numDigits = tmp + sizeof(tmp) - p;
+  memcpy(destPtr, p, numDigits);
+  destPtr += numDigits;
+  *destPtr = '\0';
+  return destPtr - dest;
+}
+
 /// ES5.1 9.8.1
 size_t numberToString(double m, char *dest, size_t destSize) {
   assert(destSize >= NUMBER_TO_STRING_BUF_SIZE);
   (void)destSize;
+
+  // Fast path for integers which can be represented exactly: they don't need
+  // the shortest-roundtrip search performed by dtoa.
+  // The largest value that fits in the 53-bit mantissa (2**53).
+  const double MAX_MANTISSA = 9007199254740992.0;
+  if (m > -MAX_MANTISSA && m < MAX_MANTISSA && m != 0 && m == std::trunc(m))
+    return integralNumberToString(m, dest);
+
   DtoaAllocator<> dalloc{};
 
   if (std::isnan(m)) {
@@ -166,4 +201,106 @@ size_t numberToString(double m, char *dest, size_t destSize) {
   g_freedtoa(dalloc, s);
   return destPtr - dest - 1;
 }
+
+OptValue<double> parseDecimalFastPath(const char *first, const char *last) {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  // Powers of ten which are exactly representable as doubles.
+  static constexpr double kPowersOf10[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr int kMaxExactPow10 = 22;
+  // Only this many significant digits are accumulated into the mantissa.
+  // Anything longer may not fit in 64 bits and is left to the slow path.
+  constexpr unsigned kMaxSignificantDigits = 19;
+  // The largest integer such that it and all smaller integers are exactly
+  // representable as doubles (2**53).
+  constexpr uint64_t kMaxExactMantissa = (uint64_t)1 << 53;
+
+  const char *it = first;
+  bool negative = false;
+  if (it != last && (*it == '-' || *it == '+')) {
+    negative = *it == '-';
+    ++it;
+  }
+
+  uint64_t mantissa = 0;
+  unsigned numSignificant = 0;
+  unsigned numDigits = 0;
+  // Decimal exponent adjustment from digits after the decimal point.
+  int exp10 = 0;
+
+  // Integer part. Leading zeros are not significant.
+  for (; it != last && *it >= '0' && *it <= '9'; ++it, ++numDigits) {
+    if (mantissa == 0 && *it == '0')
+      continue;
+    if (++numSignificant > kMaxSignificantDigits)
+      return llvh::None;
+    mantissa = mantissa * 10 + (*it - '0');
+  }
+
+  // Fraction part.
+  if (it != last && *it == '.') {
+    ++it;
+    for (; it != last && *it >= '0' && *it <= '9'; ++it, ++numDigits) {
+      --exp10;
+      if (mantissa == 0 && *it == '0')
+        continue;
+      if (++numSignificant > kMaxSignificantDigits)
+        return llvh::None;
+      mantissa = mantissa * 10 + (*it - '0');
+    }
+  }
+
+  if (numDigits == 0)
+    return llvh::None;
+
+  // Exponent part.
+  if (it != last && (*it == 'e' || *it == 'E')) {
+    ++it;
+    bool negativeExp = false;
+    if (it != last && (*it == '-' || *it == '+')) {
+      negativeExp = *it == '-';
+      ++it;
+    }
+    if (it == last)
+      return llvh::None;
+    int explicitExp = 0;
+    for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+      // Exponents this large are never handled by the fast path anyway.
+      if (explicitExp > 1000)
+        return llvh::None;
+      explicitExp = explicitExp * 10 + (*it - '0');
+    }
+    exp10 += negativeExp ? -explicitExp : explicitExp;
+  }
+
+  // Trailing garbage must be diagnosed by the slow path.
+  if (it != last)
+    return llvh::None;
+
+  double result;
+  if (mantissa == 0) {
+    result = 0;
+  } else {
+    // Clinger's fast path: when both the mantissa and the power of ten are
+    // exact doubles, a single correctly rounded IEEE multiplication or
+    // division yields the correctly rounded result.
+    if (mantissa > kMaxExactMantissa || exp10 < -kMaxExactPow10 ||
+        exp10 > kMaxExactPow10) {
+      return llvh::None;
+    }
+    result = (double)mantissa;
+    if (exp10 < 0)
+      result /= kPowersOf10[-exp10];
+    else
+      result *= kPowersOf10[exp10];
+  }
+  return negative ? -result : result;
+#else
+  // Excess intermediate precision would cause double rounding.
+  (void)first;
+  (void)last;
+  return llvh::None;
+#endif
+}
 } // namespace hermes
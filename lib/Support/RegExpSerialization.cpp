@@ -73,6 +73,14 @@ uint32_t instructionWidth<regex::MatchNCharICase8Insn>(
   return insn->totalWidth();
 }
 
+/// Print a space followed by the code unit \p c, quoted if it is printable.
+void dumpCodeUnit(char16_t c, llvh::raw_ostream &OS) {
+  if (c < 128 && std::isprint(c))
+    OS << llvh::format(" '%c'", static_cast<char>(c));
+  else
+    OS << ' ' << llvh::format_hex(c, 4);
+}
+
 void dumpInstruction(const regex::MatchChar8Insn *insn, llvh::raw_ostream &OS) {
   OS << "MatchChar8: ";
   char c = insn->c;
@@ -284,11 +292,21 @@ void dumpRegexBytecode(llvh::ArrayRef<uint8_t> bytes, llvh::raw_ostream &OS) {
   auto *header =
       reinterpret_cast<const regex::RegexBytecodeHeader *>(bytes.data());
   OS << llvh::format(
-      "  Header: marked: %u loops: %u flags: %u constraints: %u\n",
+      "  Header: marked: %u loops: %u flags: %u constraints: %u",
       aligner(header->markedCount),
       aligner(header->loopCount),
       aligner(header->syntaxFlags),
       header->constraints);
+  if (header->prefixLength) {
+    OS << " prefix:";
+    for (uint8_t i = 0; i < header->prefixLength; ++i)
+      dumpCodeUnit(header->prefilterChars[i], OS);
+  } else if (header->firstCharCount) {
+    OS << " firstChars:";
+    for (uint8_t i = 0; i < header->firstCharCount; ++i)
+      dumpCodeUnit(header->prefilterChars[i], OS);
+  }
+  OS << '\n';
   bytes = bytes.slice(sizeof *header);
   uint32_t cursor = 0;
   while (cursor < bytes.size()) {
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/Support/StringKernels.h"
+
+#include "llvh/Support/MathExtras.h"
+
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace hermes {
+
+namespace {
+
+/// \return true if the \p len characters at \p a and \p b are equal.
+template <typename T>
+inline bool charsEqual(const T *a, const T *b, size_t len) {
+  return memcmp(a, b, len * sizeof(T)) == 0;
+}
+
+/// Portable first/last character filter, used for the tail of the SIMD loop
+/// and on targets without SIMD. Starts scanning at index \p from.
+template <typename T>
+size_t findSubstringScalar(
+    llvh::ArrayRef<T> haystack,
+    llvh::ArrayRef<T> needle,
+    size_t from) {
+  const size_t n = needle.size();
+  const T first = needle[0];
+  const T last = needle[n - 1];
+  const T *hay = haystack.data();
+  for (size_t i = from, e = haystack.size() - n; i <= e; ++i) {
+    if (hay[i] == first && hay[i + n - 1] == last &&
+        charsEqual(hay + i + 1, needle.data() + 1, n < 2 ? 0 : n - 2)) {
+      return i;
+    }
+  }
+  return kStringNotFound;
+}
+
+#ifdef __SSE2__
+/// Match 16-byte blocks of candidate start positions in parallel by comparing
+/// the first and the last character of the needle at every position, and only
+/// compare the remaining characters when both match.
+size_t findSubstringSSE2(
+    llvh::ArrayRef<char> haystack,
+    llvh::ArrayRef<char> needle) {
+  const size_t n = needle.size();
+  const char *hay = haystack.data();
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i last = _mm_set1_epi8(needle[n - 1]);
+  size_t i = 0;
+  // Each iteration reads 16 bytes starting at hay + i + n - 1.
+  for (; i + n + 15 <= haystack.size(); i += 16) {
+    __m128i blockFirst = _mm_loadu_si128((const __m128i *)(hay + i));
+    __m128i blockLast = _mm_loadu_si128((const __m128i *)(hay + i + n - 1));
+    unsigned mask = _mm_movemask_epi8(_mm_and_si128(
+        _mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+    while (mask) {
+      unsigned bit = llvh::countTrailingZeros(mask);
+      if (charsEqual(hay + i + bit + 1, needle.data() + 1, n < 2 ? 0 : n - 2))
+        return i + bit;
+      mask &= mask - 1;
+    }
+  }
+  return findSubstringScalar(haystack, needle, i);
+}
+
+/// Same as the 8-bit version, but with 8 candidate positions per block. The
+/// byte mask has two bits per matching character, so only even bits are used.
+size_t findSubstringSSE2(
+    llvh::ArrayRef<char16_t> haystack,
+    llvh::ArrayRef<char16_t> needle) {
+  const size_t n = needle.size();
+  const char16_t *hay = haystack.data();
+  const __m128i first = _mm_set1_epi16(needle[0]);
+  const __m128i last = _mm_set1_epi16(needle[n - 1]);
+  size_t i = 0;
+  for (; i + n + 7 <= haystack.size(); i += 8) {
+    __m128i blockFirst = _mm_loadu_si128((const __m128i *)(hay + i));
+    __m128i blockLast = _mm_loadu_si128((const __m128i *)(hay + i + n - 1));
+    unsigned mask = _mm_movemask_epi8(_mm_and_si128(
+                        _mm_cmpeq_epi16(first, blockFirst),
+                        _mm_cmpeq_epi16(last, blockLast))) &
+        0x5555u;
+    while (mask) {
+      unsigned pos = llvh::countTrailingZeros(mask) / 2;
+      if (charsEqual(hay + i + pos + 1, needle.data() + 1, n < 2 ? 0 : n - 2))
+        return i + pos;
+      mask &= mask - 1;
+    }
+  }
+  return findSubstringScalar(haystack, needle, i);
+}
+#endif
+
+} // namespace
+
+size_t findSubstring(
+    llvh::ArrayRef<char> haystack,
+    llvh::ArrayRef<char> needle) {
+  if (needle.empty())
+    return 0;
+  if (needle.size() > haystack.size())
+    return kStringNotFound;
+  if (needle.size() == 1) {
+    const void *found = memchr(haystack.data(), needle[0], haystack.size());
+    return found ? (const char *)found - haystack.data() : kStringNotFound;
+  }
+#ifdef __SSE2__
+  return findSubstringSSE2(haystack, needle);
+#else
+  return findSubstringScalar(haystack, needle, 0);
+#endif
+}
+
+size_t findSubstring(
+    llvh::ArrayRef<char16_t> haystack,
+    llvh::ArrayRef<char16_t> needle) {
+  if (needle.empty())
+    return 0;
+  if (needle.size() > haystack.size())
+    return kStringNotFound;
+#ifdef __SSE2__
+  return findSubstringSSE2(haystack, needle);
+#else
+  return findSubstringScalar(haystack, needle, 0);
+#endif
+}
+
+bool convertASCIICase(llvh::ArrayRef<char> src, char *dest, bool upperCase) {
+  // Characters in [lo, hi] have their case bit (0x20) flipped.
+  const char lo = upperCase ? 'a' : 'A';
+  const char hi = upperCase ? 'z' : 'Z';
+  const char *ptr = src.data();
+  const size_t len = src.size();
+  size_t i = 0;
+  bool changed = false;
+
+#ifdef __SSE2__
+  // The input is ASCII, so signed byte comparisons are sufficient.
+  const __m128i vLo = _mm_set1_epi8(lo - 1);
+  const __m128i vHi = _mm_set1_epi8(hi + 1);
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+  __m128i anyChanged = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)(ptr + i));
+    __m128i inRange = _mm_and_si128(
+        _mm_cmpgt_epi8(block, vLo), _mm_cmplt_epi8(block, vHi));
+    anyChanged = _mm_or_si128(anyChanged, inRange);
+    block = _mm_xor_si128(block, _mm_and_si128(inRange, caseBit));
+    _mm_storeu_si128((__m128i *)(dest + i), block);
+  }
+  changed = _mm_movemask_epi8(anyChanged) != 0;
+#endif
+
+  for (; i < len; ++i) {
+    char c = ptr[i];
+    bool flip = lo <= c && c <= hi;
+    changed |= flip;
+    dest[i] = c ^ (flip << 5);
+  }
+  return changed;
+}
+
+void widenASCII(llvh::ArrayRef<char> src, char16_t *dest) {
+  const char *ptr = src.data();
+  const size_t len = src.size();
+  size_t i = 0;
+#ifdef __SSE2__
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)(ptr + i));
+    _mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi8(block, zero));
+    _mm_storeu_si128(
+        (__m128i *)(dest + i + 8), _mm_unpackhi_epi8(block, zero));
+  }
+#endif
+  for (; i < len; ++i)
+    dest[i] = (unsigned char)ptr[i];
+}
+
+} // namespace hermes
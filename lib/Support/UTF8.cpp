@@ -7,6 +7,10 @@
 
 #include "hermes/Support/UTF8.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace hermes {
 
 void encodeUTF8(char *&dst, uint32_t cp) {
@@ -134,14 +138,38 @@ void convertUTF16ToUTF8WithSingleSurrogates(
 bool isAllASCII(const uint8_t *start, const uint8_t *end) {
   const uint8_t *cursor = start;
   size_t len = end - start;
+
+#ifdef __SSE2__
+  // Or together 16 bytes at a time, and check the high bits at the end of
+  // every 64 byte chunk so that long non-ASCII strings fail early.
+  while (len >= 64) {
+    __m128i acc = _mm_or_si128(
+        _mm_or_si128(
+            _mm_loadu_si128((const __m128i *)cursor),
+            _mm_loadu_si128((const __m128i *)(cursor + 16))),
+        _mm_or_si128(
+            _mm_loadu_si128((const __m128i *)(cursor + 32)),
+            _mm_loadu_si128((const __m128i *)(cursor + 48))));
+    if (_mm_movemask_epi8(acc))
+      return false;
+    cursor += 64;
+    len -= 64;
+  }
+  while (len >= 16) {
+    if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)cursor)))
+      return false;
+    cursor += 16;
+    len -= 16;
+  }
+#else
   static_assert(
-      sizeof(uint32_t) == 4 && alignof(uint32_t) <= 4,
-      "uint32_t must be 4 bytes and cannot be more than 4 byte aligned");
+      sizeof(uint64_t) == 8 && alignof(uint64_t) <= 8,
+      "uint64_t must be 8 bytes and cannot be more than 8 byte aligned");
 
-  if (len >= 4) {
-    // Step by 1s until aligned for uint32_t.
+  if (len >= 8) {
+    // Step by 1s until aligned for uint64_t.
     uint8_t mask = 0;
-    while ((uintptr_t)cursor % alignof(uint32_t)) {
+    while ((uintptr_t)cursor % alignof(uint64_t)) {
       mask |= *cursor++;
       len -= 1;
     }
@@ -149,17 +177,18 @@ bool isAllASCII(const uint8_t *start, const uint8_t *end) {
       return false;
     }
 
-    // Now that we are aligned, step by 4s.
-    while (len >= 4) {
-      uint32_t val = *(const uint32_t *)cursor;
-      if (val & 0x80808080u) {
+    // Now that we are aligned, step by 8s.
+    while (len >= 8) {
+      uint64_t val = *(const uint64_t *)cursor;
+      if (val & 0x8080808080808080u) {
         return false;
       }
-      cursor += 4;
-      len -= 4;
+      cursor += 8;
+      len -= 8;
     }
   }
-  assert(len < 4 && "Length should now be less than 4");
+#endif
+
   uint8_t mask = 0;
   while (len--) {
     mask |= *cursor++;
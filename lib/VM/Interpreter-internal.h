@@ -30,7 +30,7 @@
 /// Map from a string ID encoded in the operand to a SymbolID.
 /// This string ID must be used explicitly as identifier.
 #define ID(stringID) \
-  (curCodeBlock->getRuntimeModule()->getSymbolIDMustExist(stringID))
+  (curCodeBlock->getRuntimeModule()->getSymbolIDForIdentifier(stringID))
 
 // Add an arbitrary byte offset to ip.
 #define IPADD(val) ((const Inst *)((const uint8_t *)ip + (val)))
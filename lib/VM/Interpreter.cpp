@@ -24,6 +24,7 @@
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/Profiler.h"
 #include "hermes/VM/Profiler/CodeCoverageProfiler.h"
+#include "hermes/VM/Profiler/ExecutionProfiler.h"
 #include "hermes/VM/PropertyAccessor.h"
 #include "hermes/VM/RuntimeModule-inline.h"
 #include "hermes/VM/StackFrame-inline.h"
@@ -1011,6 +1012,8 @@ tailCall:
 #endif
 
   runtime->getCodeCoverageProfiler().markExecuted(curCodeBlock);
+  if (LLVM_UNLIKELY(runtime->executionProfiler))
+    runtime->executionProfiler->onFunctionEntry(curCodeBlock);
 
   if (!SingleStep) {
     auto newFrame = runtime->setCurrentFrameToTopOfStack();
@@ -1958,6 +1961,10 @@ tailCall:
         CAPTURE_IP(runtime->getBasicBlockExecutionInfo().executeBlock(
             curCodeBlock, pointIndex));
 #endif
+        if (runtime->executionProfiler) {
+          runtime->executionProfiler->onProfilePoint(
+              curCodeBlock, ip->iProfilePoint.op1);
+        }
         ip = NEXTINST(ProfilePoint);
         DISPATCH;
       }
@@ -2581,6 +2588,36 @@ tailCall:
         DISPATCH;
       }
 
+      CASE(GetByValN) {
+        // The base is known to be an object and the index a number, so array
+        // elements can be read straight out of the indexed storage.
+        if (auto *arr = dyn_vmcast<JSArray>(O2REG(GetByValN))) {
+          if (LLVM_LIKELY(arr->hasFastIndexProperties())) {
+            if (auto index =
+                    doubleToArrayIndex(O3REG(GetByValN).getNumber())) {
+              HermesValue elem = arr->at(runtime, *index);
+              if (LLVM_LIKELY(!elem.isEmpty())) {
+                O1REG(GetByValN) = elem;
+                ip = NEXTINST(GetByValN);
+                DISPATCH;
+              }
+            }
+          }
+        }
+        CAPTURE_IP(
+            resPH = JSObject::getComputed_RJS(
+                Handle<JSObject>::vmcast(&O2REG(GetByValN)),
+                runtime,
+                Handle<>(&O3REG(GetByValN))));
+        if (LLVM_UNLIKELY(resPH == ExecutionStatus::EXCEPTION)) {
+          goto exception;
+        }
+        gcScope.flushToSmallCount(KEEP_HANDLES);
+        O1REG(GetByValN) = resPH->get();
+        ip = NEXTINST(GetByValN);
+        DISPATCH;
+      }
+
       CASE(PutByVal) {
         if (LLVM_LIKELY(O1REG(PutByVal).isObject())) {
           CAPTURE_IP_ASSIGN(
@@ -2775,6 +2812,34 @@ tailCall:
           ip = NEXTINST(JmpFalseLong);
         DISPATCH;
       }
+      CASE(JmpTrueB) {
+        if (O2REG(JmpTrueB).getBool())
+          ip = IPADD(ip->iJmpTrueB.op1);
+        else
+          ip = NEXTINST(JmpTrueB);
+        DISPATCH;
+      }
+      CASE(JmpTrueBLong) {
+        if (O2REG(JmpTrueBLong).getBool())
+          ip = IPADD(ip->iJmpTrueBLong.op1);
+        else
+          ip = NEXTINST(JmpTrueBLong);
+        DISPATCH;
+      }
+      CASE(JmpFalseB) {
+        if (!O2REG(JmpFalseB).getBool())
+          ip = IPADD(ip->iJmpFalseB.op1);
+        else
+          ip = NEXTINST(JmpFalseB);
+        DISPATCH;
+      }
+      CASE(JmpFalseBLong) {
+        if (!O2REG(JmpFalseBLong).getBool())
+          ip = IPADD(ip->iJmpFalseBLong.op1);
+        else
+          ip = NEXTINST(JmpFalseBLong);
+        DISPATCH;
+      }
       CASE(JmpUndefined) {
         if (O2REG(JmpUndefined).isUndefined())
           ip = IPADD(ip->iJmpUndefined.op1);
@@ -2812,6 +2877,21 @@ tailCall:
         DISPATCH;
       }
 
+      CASE(AddS) {
+        CAPTURE_IP(
+            res = StringPrimitive::concat(
+                runtime,
+                Handle<StringPrimitive>::vmcast(&O2REG(AddS)),
+                Handle<StringPrimitive>::vmcast(&O3REG(AddS))));
+        if (res == ExecutionStatus::EXCEPTION) {
+          goto exception;
+        }
+        gcScope.flushToSmallCount(KEEP_HANDLES);
+        O1REG(AddS) = res.getValue();
+        ip = NEXTINST(AddS);
+        DISPATCH;
+      }
+
       CASE(BitNot) {
         if (LLVM_LIKELY(O2REG(BitNot).isNumber())) { /* Fast-path. */
           O1REG(BitNot) = HermesValue::encodeDoubleValue(
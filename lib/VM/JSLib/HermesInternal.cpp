@@ -257,6 +257,10 @@ hermesInternalGetInstrumentedStats(void *, Runtime *runtime, NativeArgs args) {
     SET_PROP_NEW("js_markStackOverflows", info.numMarkStackOverflows);
   }
 
+  SET_PROP_NEW("js_regExpCacheHits", stats.regExpCache.hits);
+  SET_PROP_NEW("js_regExpCacheMisses", stats.regExpCache.misses);
+  SET_PROP_NEW("js_regExpCacheEvictions", stats.regExpCache.evictions);
+
   if (stats.shouldSample) {
     SET_PROP_NEW(
         "js_hermesVolCtxSwitches",
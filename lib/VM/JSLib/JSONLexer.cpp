@@ -7,6 +7,7 @@
 
 #include "JSONLexer.h"
 
+#include "hermes/Support/Conversions.h"
 #include "hermes/VM/StringPrimitive.h"
 
 #include "dtoa/dtoa.h"
@@ -113,6 +114,11 @@ ExecutionStatus JSONLexer::scanNumber() {
     return errorWithChar(u"Unexpected token in number: ", str8[1]);
   }
 
+  if (auto fast = parseDecimalFastPath(str8.data(), str8.data() + len)) {
+    token_.setNumber(*fast);
+    return ExecutionStatus::RETURNED;
+  }
+
   str8.push_back('\0');
 
   char *endPtr;
@@ -140,7 +146,8 @@ ExecutionStatus JSONLexer::scanString() {
         token_.setString(runtime_->makeHandle<StringPrimitive>(existing));
         return ExecutionStatus::RETURNED;
       }
-      auto strRes = StringPrimitive::create(runtime_, tmpStorage.arrayRef());
+      auto strRes =
+          StringPrimitive::createEfficient(runtime_, tmpStorage.arrayRef());
       if (LLVM_UNLIKELY(strRes == ExecutionStatus::EXCEPTION)) {
         return ExecutionStatus::EXCEPTION;
       }
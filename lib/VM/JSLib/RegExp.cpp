@@ -14,7 +14,9 @@
 
 #include "hermes/VM/JSRegExpStringIterator.h"
 #include "hermes/VM/Operations.h"
+#include "hermes/VM/PropertyAccessor.h"
 #include "hermes/VM/SmallXString.h"
+#include "hermes/VM/StringBuilder.h"
 #include "hermes/VM/StringPrimitive.h"
 #include "hermes/VM/StringView.h"
 
@@ -413,6 +415,30 @@ static CallResult<Handle<JSRegExp>> regExpConstructorFastCopy(
   return Handle<JSRegExp>::vmcast(*newRegexpRes);
 }
 
+/// \return the value RegExpBuiltinExec stores in lastIndex after finding
+/// \p match in \p S, when the RegExp is global or sticky.
+static uint32_t lastIndexAfterMatch(
+    const StringPrimitive *S,
+    RegExpMatchRange match,
+    bool fullUnicode) {
+  uint32_t e = match.location + match.length;
+
+  // If fullUnicode is true, then:
+  // a. e is an index into the Input character list, derived from S, matched
+  // by matcher. Let eUTF be the smallest index into S that corresponds to the
+  // character at element e of Input. If e is greater than or equal to the
+  // number of elements in Input, then eUTF is the number of code units in S.
+  // b. set e to eUTF.
+  // This is a longwinded way of saying that we don't set lastIndex to match
+  // the trailing member of a surrogate pair.
+  if (fullUnicode && e > 0 && e < S->getStringLength()) {
+    if (isHighSurrogate(S->at(e - 1)) && isLowSurrogate(S->at(e))) {
+      e -= 1;
+    }
+  }
+  return e;
+}
+
 // ES6 21.2.5.2.2
 CallResult<Handle<JSArray>> directRegExpExec(
     Handle<JSRegExp> regexp,
@@ -496,23 +522,7 @@ CallResult<Handle<JSArray>> directRegExpExec(
   // Here 'e' is the end of the total match.
   assert(!match.empty() && "Match should not be empty");
   if (global || sticky) {
-    auto totalMatch = *match.front();
-    uint32_t e = totalMatch.location + totalMatch.length;
-
-    // If fullUnicode is true, then:
-    // a. e is an index into the Input character list, derived from S, matched
-    // by matcher. Let eUTF be the smallest index into S that corresponds to the
-    // character at element e of Input. If e is greater than or equal to the
-    // number of elements in Input, then eUTF is the number of code units in S.
-    // b. set e to eUTF.
-    // This is a longwinded way of saying that we don't set lastIndex to match
-    // the trailing member of a surrogate pair.
-    if (fullUnicode && e > 0 && e < S->getStringLength()) {
-      if (isHighSurrogate(S->at(e - 1)) && isLowSurrogate(S->at(e))) {
-        e -= 1;
-      }
-    }
-
+    uint32_t e = lastIndexAfterMatch(S.get(), *match.front(), fullUnicode);
     if (LLVM_UNLIKELY(
             setLastIndex(regexp, runtime, e) == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
@@ -1329,6 +1339,216 @@ regExpPrototypeSymbolSearch(void *, Runtime *runtime, NativeArgs args) {
       .toCallResultHermesValue();
 }
 
+/// \return true if looking up \p name on \p obj finds the native function
+/// \p fn with context \p ctx, either as the value of a data property or as the
+/// getter of an accessor. Calling such a property, or skipping the call, has
+/// no effect beyond what the builtin itself does.
+static bool isBuiltinProperty(
+    Runtime *runtime,
+    Handle<JSObject> obj,
+    Predefined::Str name,
+    NativeFunctionPtr fn,
+    void *ctx = nullptr) {
+  NamedPropertyDescriptor desc;
+  JSObject *owner =
+      JSObject::getNamedDescriptorPredefined(obj, runtime, name, desc);
+  if (!owner || desc.flags.proxyObject || desc.flags.hostObject)
+    return false;
+  HermesValue value = JSObject::getNamedSlotValueUnsafe(owner, runtime, desc)
+                          .unboxToHV(runtime);
+  Callable *callable = desc.flags.accessor
+      ? vmcast<PropertyAccessor>(value)->getter.get(runtime)
+      : dyn_vmcast<Callable>(value);
+  auto *nativeFn = dyn_vmcast_or_null<NativeFunction>(callable);
+  return nativeFn && nativeFn->getFunctionPtr() == fn &&
+      nativeFn->getContext() == ctx;
+}
+
+/// \return true if the "flags" property of \p R, and all the flag properties
+/// it reads, are the builtin accessors, so that Get(R, "flags") is not
+/// observable and yields the flags \p R was created with.
+static bool hasBuiltinFlagGetters(Runtime *runtime, Handle<JSRegExp> R) {
+  static const struct {
+    Predefined::Str name;
+    intptr_t ctx;
+  } flagProps[] = {
+      {Predefined::global, 'g'},
+      {Predefined::ignoreCase, 'i'},
+      {Predefined::multiline, 'm'},
+      {Predefined::dotAll, 's'},
+      {Predefined::unicode, 'u'},
+      {Predefined::sticky, 'y'},
+  };
+  if (!isBuiltinProperty(runtime, R, Predefined::flags, regExpFlagsGetter))
+    return false;
+  for (const auto &f : flagProps) {
+    if (!isBuiltinProperty(
+            runtime,
+            R,
+            f.name,
+            regExpFlagPropertyGetter,
+            reinterpret_cast<void *>(f.ctx)))
+      return false;
+  }
+  return true;
+}
+
+/// Expand the replacement template \p replacement for the match \p groups in
+/// \p S, as GetSubstitution does. \p groups holds the whole match followed by
+/// the captures. Rather than building a string, call
+/// \p appendRange(str, start, length) for each piece of the result in order,
+/// where str is either \p S or \p replacement.
+template <typename AppendRange>
+static void forEachSubstitutionPiece(
+    Handle<StringPrimitive> S,
+    Handle<StringPrimitive> replacement,
+    llvh::ArrayRef<OptValue<RegExpMatchRange>> groups,
+    AppendRange appendRange) {
+  const RegExpMatchRange match = *groups[0];
+  const uint32_t tailPos = match.location + match.length;
+  const uint32_t lengthS = S->getStringLength();
+  const uint32_t m = groups.size() - 1;
+  auto appendGroup = [&](uint32_t n) {
+    if (groups[n])
+      appendRange(S, groups[n]->location, groups[n]->length);
+  };
+
+  // Start of the run of template code units that are copied as they are.
+  uint32_t literalStart = 0;
+  const uint32_t e = replacement->getStringLength();
+  for (uint32_t i = 0; i < e;) {
+    if (replacement->at(i) != u'$' || i + 1 == e) {
+      ++i;
+      continue;
+    }
+    char16_t c1 = replacement->at(i + 1);
+    // Number of template code units replaced by the substitution.
+    uint32_t consumed = 2;
+    if (c1 == u'$') {
+      appendRange(replacement, literalStart, i - literalStart);
+      appendRange(replacement, i, 1);
+    } else if (c1 == u'&') {
+      appendRange(replacement, literalStart, i - literalStart);
+      appendRange(S, match.location, match.length);
+    } else if (c1 == u'`') {
+      appendRange(replacement, literalStart, i - literalStart);
+      appendRange(S, 0, match.location);
+    } else if (c1 == u'\'') {
+      appendRange(replacement, literalStart, i - literalStart);
+      if (tailPos < lengthS)
+        appendRange(S, tailPos, lengthS - tailPos);
+    } else if (u'0' <= c1 && c1 <= u'9') {
+      uint32_t n = c1 - u'0';
+      char16_t c2 = i + 2 < e ? replacement->at(i + 2) : 0;
+      uint32_t nn = n * 10 + (c2 - u'0');
+      if (u'0' <= c2 && c2 <= u'9' && 1 <= nn && nn <= m) {
+        appendRange(replacement, literalStart, i - literalStart);
+        appendGroup(nn);
+        consumed = 3;
+      } else if (1 <= n && n <= m) {
+        appendRange(replacement, literalStart, i - literalStart);
+        appendGroup(n);
+      } else {
+        // Not a valid $n, so both characters are copied.
+        i += 2;
+        continue;
+      }
+    } else {
+      // Not a substitution, so both characters are copied.
+      i += 2;
+      continue;
+    }
+    i += consumed;
+    literalStart = i;
+  }
+  appendRange(replacement, literalStart, e - literalStart);
+}
+
+/// Fast path of RegExp.prototype[@@replace] with a replacement string, for a
+/// RegExp \p R whose exec is the builtin. Calling the builtin exec through
+/// RegExpExec is then not observable, so this runs the matcher directly over
+/// \p S and assembles the result in a single StringBuilder, without creating
+/// the result arrays that exec would return.
+/// \param global and \p fullUnicode are the values the caller read from \p R.
+///   They must agree with the flags of \p R.
+/// \param searchStart where the first match is searched for, which is
+///   ToLength(lastIndex) if \p R is sticky and not global, and 0 otherwise.
+static CallResult<HermesValue> regExpReplaceWithString(
+    Runtime *runtime,
+    Handle<JSRegExp> R,
+    Handle<StringPrimitive> S,
+    Handle<StringPrimitive> replacement,
+    bool global,
+    bool fullUnicode,
+    uint64_t searchStart) {
+  const uint32_t lengthS = S->getStringLength();
+  const bool sticky = JSRegExp::getSyntaxFlags(R.get()).sticky;
+
+  // The ranges of all matches and their captures. Every match has the same
+  // number of groups, so match i occupies groups [i * groupCount, (i + 1) *
+  // groupCount).
+  llvh::SmallVector<OptValue<RegExpMatchRange>, 8> allGroups;
+  size_t groupCount = 0;
+  while (searchStart <= lengthS) {
+    auto matchRes = JSRegExp::search(R, runtime, S, searchStart);
+    if (LLVM_UNLIKELY(matchRes == ExecutionStatus::EXCEPTION))
+      return ExecutionStatus::EXCEPTION;
+    const RegExpMatch &match = *matchRes;
+    if (match.empty())
+      break;
+    groupCount = match.size();
+    allGroups.append(match.begin(), match.end());
+    uint32_t e = lastIndexAfterMatch(S.get(), *match[0], fullUnicode);
+    if (!global) {
+      // A sticky exec stores the end of the match in lastIndex.
+      if (sticky && setLastIndex(R, runtime, e) == ExecutionStatus::EXCEPTION)
+        return ExecutionStatus::EXCEPTION;
+      break;
+    }
+    // An empty match advances lastIndex by one code point, so that the next
+    // search makes progress.
+    searchStart =
+        match[0]->length ? e : advanceStringIndex(S.get(), e, fullUnicode);
+  }
+  // A failed exec resets lastIndex if the RegExp is global or sticky. The
+  // caller has already reset it in the global case.
+  if (allGroups.empty() && !global && sticky &&
+      setLastIndex(R, runtime, 0) == ExecutionStatus::EXCEPTION) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  if (allGroups.empty())
+    return S.getHermesValue();
+
+  // Visit the pieces of the result in order: the text before each match,
+  // its substitution, and finally the text after the last match.
+  auto forEachPiece = [&](const auto &appendRange) {
+    uint32_t nextSourcePosition = 0;
+    for (size_t i = 0; i < allGroups.size(); i += groupCount) {
+      auto groups = llvh::makeArrayRef(allGroups).slice(i, groupCount);
+      appendRange(
+          S, nextSourcePosition, groups[0]->location - nextSourcePosition);
+      forEachSubstitutionPiece(S, replacement, groups, appendRange);
+      nextSourcePosition = groups[0]->location + groups[0]->length;
+    }
+    appendRange(S, nextSourcePosition, lengthS - nextSourcePosition);
+  };
+
+  SafeUInt32 resultLength;
+  forEachPiece([&resultLength](
+                   Handle<StringPrimitive>, uint32_t, uint32_t length) {
+    resultLength.add(length);
+  });
+  auto builder = StringBuilder::createStringBuilder(
+      runtime, resultLength, S->isASCII() && replacement->isASCII());
+  if (LLVM_UNLIKELY(builder == ExecutionStatus::EXCEPTION))
+    return ExecutionStatus::EXCEPTION;
+  forEachPiece(
+      [&builder](Handle<StringPrimitive> str, uint32_t start, uint32_t length) {
+        builder->appendStringPrim(str, start, length);
+      });
+  return builder->getStringPrimitive().getHermesValue();
+}
+
 /// ES6.0 21.2.5.8
 CallResult<HermesValue>
 regExpPrototypeSymbolReplace(void *, Runtime *runtime, NativeArgs args) {
@@ -1395,6 +1615,42 @@ regExpPrototypeSymbolReplace(void *, Runtime *runtime, NativeArgs args) {
       return ExecutionStatus::EXCEPTION;
     }
   }
+  // When exec is the builtin, the matcher can run directly, without creating
+  // the results List below. The flags read above must agree with the ones
+  // the matcher uses, and lastIndex must be read without side effects.
+  if (auto regexp = Handle<JSRegExp>::dyn_vmcast(rx)) {
+    const regex::SyntaxFlags flags = JSRegExp::getSyntaxFlags(regexp.get());
+    if (!replaceFn && flags.global == global &&
+        (!global || flags.unicode == fullUnicode) &&
+        isBuiltinProperty(
+            runtime, rx, Predefined::exec, regExpPrototypeExec)) {
+      if (global) {
+        return regExpReplaceWithString(
+            runtime, regexp, S, replaceValueStr, global, fullUnicode, 0);
+      }
+      // Without the global flag, exec calls ToLength(lastIndex) once.
+      propRes = runtime->getNamed(rx, PropCacheID::RegExpLastIndex);
+      if (LLVM_UNLIKELY(propRes == ExecutionStatus::EXCEPTION)) {
+        return ExecutionStatus::EXCEPTION;
+      }
+      if (propRes->get().isNumber()) {
+        auto lastIndexRes =
+            toLengthU64(runtime, runtime->makeHandle(std::move(*propRes)));
+        assert(
+            lastIndexRes != ExecutionStatus::EXCEPTION &&
+            "ToLength of a number cannot fail");
+        return regExpReplaceWithString(
+            runtime,
+            regexp,
+            S,
+            replaceValueStr,
+            global,
+            fullUnicode,
+            flags.sticky ? *lastIndexRes : 0);
+      }
+    }
+  }
+
   // 11. Let results be a new empty List.
   auto arrRes = ArrayStorageSmall::create(runtime, 16 /* capacity */);
   if (LLVM_UNLIKELY(arrRes == ExecutionStatus::EXCEPTION)) {
@@ -1691,37 +1947,49 @@ regExpPrototypeSymbolSplit(void *, Runtime *runtime, NativeArgs args) {
 
   // 5. Let flags be ? ToString(? Get(rx, "flags")).
   auto regexp = Handle<JSObject>::vmcast(args.getThisHandle());
-  CallResult<PseudoHandle<>> flagsRes = JSObject::getNamed_RJS(
-      regexp, runtime, Predefined::getSymbolID(Predefined::flags));
-  if (LLVM_UNLIKELY(flagsRes == ExecutionStatus::EXCEPTION)) {
-    return ExecutionStatus::EXCEPTION;
-  }
-  CallResult<PseudoHandle<StringPrimitive>> flagsStrRes = toString_RJS(
-      runtime, runtime->makeHandle(std::move(flagsRes.getValue())));
-  if (LLVM_UNLIKELY(flagsStrRes == ExecutionStatus::EXCEPTION)) {
-    return ExecutionStatus::EXCEPTION;
-  }
-  Handle<StringPrimitive> flags =
-      runtime->makeHandle(std::move(flagsStrRes.getValue()));
-
-  // 8. If flags contains "y", let newFlags be flags.
-  // 9. Else, let newFlags be the string that is the concatenation of flags and
-  // "y".
-  // NOTE: We do not follow this part of the spec, instead, we just use flags as
-  // newFlags and actually strip the sticky flag. See below.
-  // 10. Let splitter be Construct(C, «rx, newFlags»).
-  auto splitterRes = regExpConstructorFastCopy(runtime, regexp, flags);
-  if (LLVM_UNLIKELY(splitterRes == ExecutionStatus::EXCEPTION)) {
-    return ExecutionStatus::EXCEPTION;
+  MutableHandle<JSRegExp> splitter{runtime};
+  regex::SyntaxFlags newFlags;
+  auto thisRegExp = Handle<JSRegExp>::dyn_vmcast(regexp);
+  if (thisRegExp && !JSRegExp::getSyntaxFlags(thisRegExp.get()).sticky &&
+      hasBuiltinFlagGetters(runtime, thisRegExp)) {
+    // Reading the flags is not observable, and the splitter constructed below
+    // would be an exact copy of rx. Matching never reads or writes lastIndex,
+    // so rx can serve as the splitter itself.
+    splitter = thisRegExp.get();
+    newFlags = JSRegExp::getSyntaxFlags(thisRegExp.get());
+  } else {
+    CallResult<PseudoHandle<>> flagsRes = JSObject::getNamed_RJS(
+        regexp, runtime, Predefined::getSymbolID(Predefined::flags));
+    if (LLVM_UNLIKELY(flagsRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    CallResult<PseudoHandle<StringPrimitive>> flagsStrRes = toString_RJS(
+        runtime, runtime->makeHandle(std::move(flagsRes.getValue())));
+    if (LLVM_UNLIKELY(flagsStrRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    Handle<StringPrimitive> flags =
+        runtime->makeHandle(std::move(flagsStrRes.getValue()));
+
+    // 8. If flags contains "y", let newFlags be flags.
+    // 9. Else, let newFlags be the string that is the concatenation of flags
+    // and "y".
+    // NOTE: We do not follow this part of the spec, instead, we just use flags
+    // as newFlags and actually strip the sticky flag. See below.
+    // 10. Let splitter be Construct(C, «rx, newFlags»).
+    auto splitterRes = regExpConstructorFastCopy(runtime, regexp, flags);
+    if (LLVM_UNLIKELY(splitterRes == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    splitter = splitterRes->get();
+    // The spec actually tells us to always set the sticky flag to true, but
+    // since it is much faster to perform a global search, we set sticky to
+    // false and then check the returned index.
+    auto stickyFlags = JSRegExp::getSyntaxFlags(splitter.get());
+    newFlags = stickyFlags;
+    newFlags.sticky = 0;
+    JSRegExp::setSyntaxFlags(splitter.get(), newFlags);
   }
-  auto splitter = *splitterRes;
-  // The spec actually tells us to always set the sticky flag to true, but
-  // since it is much faster to perform a global search, we set sticky to
-  // false and then check the returned index.
-  auto stickyFlags = JSRegExp::getSyntaxFlags(splitter.get());
-  auto newFlags = stickyFlags;
-  newFlags.sticky = 0;
-  JSRegExp::setSyntaxFlags(splitter.get(), newFlags);
 
   // 6. If flags contains "u", let unicodeMatching be true.
   // 7. Else, let unicodeMatching be false.
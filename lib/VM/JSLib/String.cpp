@@ -12,6 +12,7 @@
 #include "JSLibInternal.h"
 
 #include "hermes/Platform/Unicode/PlatformUnicode.h"
+#include "hermes/Support/StringKernels.h"
 #include "hermes/VM/JSLib/RuntimeCommonStorage.h"
 #include "hermes/VM/Operations.h"
 #include "hermes/VM/PrimitiveBox.h"
@@ -776,6 +777,22 @@ static CallResult<HermesValue> convertCase(
     Handle<StringPrimitive> S,
     const bool upperCase,
     const bool useCurrentLocale) {
+  if (!useCurrentLocale && S->isASCII()) {
+    // Fast path for ASCII strings: convert the characters in bulk without
+    // widening them to UTF16 first.
+    uint32_t len = S->getStringLength();
+    llvh::SmallVector<char, 32> buff(len);
+    if (!convertASCIICase(S->getStringRef<char>(), buff.data(), upperCase)) {
+      // We don't have to allocate anything.
+      return S.getHermesValue();
+    }
+    if (len == 1) {
+      // Use the Runtime stored representations of single-character strings.
+      return runtime->getCharacterString(buff[0]).getHermesValue();
+    }
+    return StringPrimitive::create(runtime, ASCIIRef(buff.data(), len));
+  }
+
   // Copying is unavoidable in this function, do it early on.
   SmallU16String<32> buff;
   // Must copy instead of just getting the reference, because later operations
@@ -1352,6 +1369,41 @@ stringPrototypeMatchAll(void *, Runtime *runtime, NativeArgs args) {
 }
 
 /// This provides a shared implementation of three operations in ES2021:
+/// Find the first occurrence of \p needle in \p haystack at or after index
+/// \p start. When both strings use the same character width the search is done
+/// by the vectorized kernels in StringKernels.h, otherwise it falls back to a
+/// character by character comparison.
+/// \pre start <= haystack.length().
+/// \return the index of the match, or None if there is no match.
+static OptValue<uint32_t> stringViewIndexOf(
+    const StringView &haystack,
+    const StringView &needle,
+    uint32_t start) {
+  assert(start <= haystack.length() && "start is out of bounds");
+  if (haystack.isASCII() == needle.isASCII()) {
+    size_t found;
+    if (haystack.isASCII()) {
+      found = findSubstring(
+          ASCIIRef(haystack.castToCharPtr() + start, haystack.length() - start),
+          ASCIIRef(needle.castToCharPtr(), needle.length()));
+    } else {
+      found = findSubstring(
+          UTF16Ref(
+              haystack.castToChar16Ptr() + start, haystack.length() - start),
+          UTF16Ref(needle.castToChar16Ptr(), needle.length()));
+    }
+    if (found == kStringNotFound)
+      return llvh::None;
+    return start + found;
+  }
+
+  auto foundIter = std::search(
+      haystack.begin() + start, haystack.end(), needle.begin(), needle.end());
+  if (foundIter == haystack.end() && !needle.empty())
+    return llvh::None;
+  return foundIter - haystack.begin();
+}
+
 /// 6.1.4.1 Runtime Semantics: StringIndexOf ( string, searchValue, fromIndex )
 ///   when clampPostion=false,
 /// 21.1.3.8 String.prototype.indexOf ( searchString [ , position ] )
@@ -1451,8 +1503,6 @@ static CallResult<HermesValue> stringDirectedIndexOf(
   // Let start be min(max(pos, 0), len).
   uint32_t start = static_cast<uint32_t>(std::min(std::max(pos, 0.), len));
 
-  // TODO: good candidate for Boyer-Moore on large needles/haystacks
-  // TODO: good candidate for memchr on length-1 needles
   auto SView = StringPrimitive::createStringView(runtime, S);
   auto searchStrView = StringPrimitive::createStringView(runtime, searchStr);
   double ret = -1;
@@ -1470,13 +1520,8 @@ static CallResult<HermesValue> stringDirectedIndexOf(
     }
   } else {
     // indexOf
-    auto foundIter = std::search(
-        SView.begin() + start,
-        SView.end(),
-        searchStrView.begin(),
-        searchStrView.end());
-    if (foundIter != SView.end() || searchStrView.empty()) {
-      ret = foundIter - SView.begin();
+    if (auto found = stringViewIndexOf(SView, searchStrView, start)) {
+      ret = *found;
     }
   }
   return HermesValue::encodeDoubleValue(ret);
@@ -1881,6 +1926,17 @@ stringPrototypePad(void *ctx, Runtime *runtime, NativeArgs args) {
   return builderRes->getStringPrimitive().getHermesValue();
 }
 
+/// \return true if \p str contains a '$', which may start a substitution in a
+/// replacement template.
+static bool containsDollar(const StringPrimitive *str) {
+  if (str->isASCII()) {
+    auto ref = str->getStringRef<char>();
+    return std::find(ref.begin(), ref.end(), '$') != ref.end();
+  }
+  auto ref = str->getStringRef<char16_t>();
+  return std::find(ref.begin(), ref.end(), u'$') != ref.end();
+}
+
 CallResult<HermesValue>
 stringPrototypeReplace(void *, Runtime *runtime, NativeArgs args) {
   // 1. Let O be RequireObjectCoercible(this value).
@@ -1956,11 +2012,8 @@ stringPrototypeReplace(void *, Runtime *runtime, NativeArgs args) {
   auto strView = StringPrimitive::createStringView(runtime, string);
   if (!strView.empty()) {
     auto searchView = StringPrimitive::createStringView(runtime, searchString);
-    auto searchResult = std::search(
-        strView.begin(), strView.end(), searchView.begin(), searchView.end());
-
-    if (searchResult != strView.end()) {
-      pos = searchResult - strView.begin();
+    if (auto found = stringViewIndexOf(strView, searchView, 0)) {
+      pos = *found;
     } else {
       return string.getHermesValue();
     }
@@ -1991,6 +2044,10 @@ stringPrototypeReplace(void *, Runtime *runtime, NativeArgs args) {
       return ExecutionStatus::EXCEPTION;
     }
     replStr = replStrRes->get();
+  } else if (!containsDollar(replaceValueStr.get())) {
+    // Without '$' there is nothing to substitute, so GetSubstitution would
+    // return replaceValue itself.
+    replStr = replaceValueStr.get();
   } else {
     // 12. Else,
     // a. Let captures be an empty List.
@@ -2010,13 +2067,20 @@ stringPrototypeReplace(void *, Runtime *runtime, NativeArgs args) {
   // units of string, replStr, and the trailing substring of string starting at
   // index tailPos. If pos is 0, the first element of the concatenation will be
   // the empty String.
-  SmallU16String<32> newString{};
-  strView.slice(0, pos).appendUTF16String(newString);
-  StringPrimitive::createStringView(runtime, replStr)
-      .appendUTF16String(newString);
-  strView.slice(tailPos).appendUTF16String(newString);
+  uint32_t tailLength = string->getStringLength() - tailPos;
+  SafeUInt32 newLength{pos};
+  newLength.add(replStr->getStringLength());
+  newLength.add(tailLength);
+  auto builder = StringBuilder::createStringBuilder(
+      runtime, newLength, string->isASCII() && replStr->isASCII());
+  if (LLVM_UNLIKELY(builder == ExecutionStatus::EXCEPTION)) {
+    return ExecutionStatus::EXCEPTION;
+  }
+  builder->appendStringPrim(string, 0, pos);
+  builder->appendStringPrim(replStr);
+  builder->appendStringPrim(string, tailPos, tailLength);
   // 15. Return newString.
-  return StringPrimitive::create(runtime, newString);
+  return builder->getStringPrimitive().getHermesValue();
 }
 
 CallResult<HermesValue>
@@ -2257,12 +2321,8 @@ static OptValue<uint32_t> splitMatch(
   auto SStr = StringPrimitive::createStringView(runtime, S);
   auto RStr = StringPrimitive::createStringView(runtime, R);
 
-  auto sliced = SStr.slice(q);
-  auto searchResult =
-      std::search(sliced.begin(), sliced.end(), RStr.begin(), RStr.end());
-
-  if (searchResult != sliced.end()) {
-    return q + (searchResult - sliced.begin()) + r;
+  if (auto found = stringViewIndexOf(SStr, RStr, q)) {
+    return *found + r;
   }
   return llvh::None;
 }
@@ -2568,15 +2628,9 @@ CallResult<HermesValue> stringPrototypeIncludesOrStartsWith(
   // k, return false.
   auto SView = StringPrimitive::createStringView(runtime, S);
   auto searchStrView = StringPrimitive::createStringView(runtime, searchStr);
-  auto foundIter = std::search(
-      SView.begin() + start,
-      SView.end(),
-      searchStrView.begin(),
-      searchStrView.end());
-  // Note: searchStrView.empty check is needed in the special case that S is
-  // empty, searchStr is empty, and start = 0
   return HermesValue::encodeBoolValue(
-      foundIter != SView.end() || searchStrView.empty());
+      stringViewIndexOf(SView, searchStrView, static_cast<uint32_t>(start))
+          .hasValue());
 }
 
 CallResult<HermesValue>
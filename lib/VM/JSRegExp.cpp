@@ -176,6 +176,17 @@ ExecutionStatus JSRegExp::initialize(
   llvh::SmallVector<char16_t, 16> patternText16;
   pattern->appendUTF16String(patternText16);
 
+  // Reuse the bytecode of an earlier RegExp with the same pattern and flags.
+  // Invalid flags are not cached; they are reported by the regex below.
+  RegExpCache &cache = runtime->getRegExpCache();
+  auto sflags = regex::SyntaxFlags::fromString(flagsText16);
+  if (sflags) {
+    if (const auto *bytecode = cache.lookup(patternText16, sflags->toByte())) {
+      initialize(selfHandle, runtime, pattern, flags, *bytecode);
+      return ExecutionStatus::RETURNED;
+    }
+  }
+
   // Build the regex.
   regex::Regex<regex::UTF16RegexTraits> regex(patternText16, flagsText16);
 
@@ -187,6 +198,8 @@ ExecutionStatus JSRegExp::initialize(
   // The regex is valid. Compile and store its bytecode.
   auto bytecode = regex.compile();
   initialize(selfHandle, runtime, pattern, flags, bytecode);
+  assert(sflags && "Valid regex with invalid flags");
+  cache.insert(patternText16, sflags->toByte(), std::move(bytecode));
   return ExecutionStatus::RETURNED;
 }
 
@@ -201,6 +214,8 @@ void JSRegExp::initializeBytecode(llvh::ArrayRef<uint8_t> bytecode) {
   bytecodeSize_ = sz;
   bytecode_ = (uint8_t *)checkedMalloc(sz);
   memcpy(bytecode_, bytecode.data(), sz);
+  jitLookedUp_ = false;
+  jitIndex_ = RegExpJITCache::kNoCode;
 }
 
 PseudoHandle<StringPrimitive> JSRegExp::getPattern(
@@ -216,7 +231,8 @@ CallResult<RegExpMatch> performSearch(
     const CharT *start,
     uint32_t stringLength,
     uint32_t searchStartOffset,
-    regex::constants::MatchFlagType matchFlags) {
+    regex::constants::MatchFlagType matchFlags,
+    const regex::JITCompiledRegex *jitCode) {
   std::vector<regex::CapturedRange> nativeMatchRanges;
   auto matchResult = regex::searchWithBytecode(
       bytecode,
@@ -224,7 +240,8 @@ CallResult<RegExpMatch> performSearch(
       searchStartOffset,
       stringLength,
       &nativeMatchRanges,
-      matchFlags);
+      matchFlags,
+      jitCode);
   if (matchResult == regex::MatchRuntimeResult::StackOverflow) {
     return runtime->raiseRangeError("Maximum regex stack depth reached");
   } else if (matchResult == regex::MatchRuntimeResult::NoMatch) {
@@ -271,6 +288,16 @@ CallResult<RegExpMatch> JSRegExp::search(
     matchFlags |= regex::constants::matchOnlyAtStart;
   }
 
+  // Compile the RegExp to native code on its first search, if enabled.
+  RegExpJITCache &jitCache = runtime->getRegExpJITCache();
+  if (LLVM_UNLIKELY(jitCache.isEnabled() && !selfHandle->jitLookedUp_)) {
+    selfHandle->jitIndex_ = jitCache.getOrCompile(
+        llvh::makeArrayRef(selfHandle->bytecode_, selfHandle->bytecodeSize_));
+    selfHandle->jitLookedUp_ = true;
+  }
+  const regex::JITCompiledRegex *jitCode =
+      jitCache.get(selfHandle->jitIndex_);
+
   CallResult<RegExpMatch> matchResult = RegExpMatch{};
   if (input.isASCII()) {
     matchFlags |= regex::constants::matchInputAllAscii;
@@ -280,7 +307,8 @@ CallResult<RegExpMatch> JSRegExp::search(
         input.castToCharPtr(),
         input.length(),
         searchStartOffset,
-        matchFlags);
+        matchFlags,
+        jitCode);
   } else {
     matchResult = performSearch<char16_t, regex::UTF16RegexTraits>(
         runtime,
@@ -288,7 +316,8 @@ CallResult<RegExpMatch> JSRegExp::search(
         input.castToChar16Ptr(),
         input.length(),
         searchStartOffset,
-        matchFlags);
+        matchFlags,
+        jitCode);
   }
 
   // Only update on successful match.
@@ -287,7 +287,7 @@ static CallResult<PseudoHandle<StringPrimitive>> numberToString(
     } while (n);
     size_t len = buf8 + sizeof(buf8) - p;
     // Temporarily stop the propagation of removing.
-    auto result = StringPrimitive::create(runtime, ASCIIRef(p, len));
+    auto result = StringPrimitive::createEfficient(runtime, ASCIIRef(p, len));
     if (LLVM_UNLIKELY(result == ExecutionStatus::EXCEPTION)) {
       return ExecutionStatus::EXCEPTION;
     }
@@ -310,7 +310,7 @@ static CallResult<PseudoHandle<StringPrimitive>> numberToString(
   // After special cases, run the generic routine to convert.
   size_t len = hermes::numberToString(m, buf8, sizeof(buf8));
 
-  auto result = StringPrimitive::create(runtime, ASCIIRef(buf8, len));
+  auto result = StringPrimitive::createEfficient(runtime, ASCIIRef(buf8, len));
   if (LLVM_UNLIKELY(result == ExecutionStatus::EXCEPTION)) {
     return ExecutionStatus::EXCEPTION;
   }
@@ -457,6 +457,8 @@ static inline double stringToNumber(
     ++i;
   }
   str8[len] = '\0';
+  if (auto fast = hermes::parseDecimalFastPath(str8.data(), str8.data() + len))
+    return *fast;
   char *endPtr;
   double result = ::hermes_g_strtod(str8.data(), &endPtr);
   if (endPtr == str8.data() + len) {
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/Profiler/ExecutionProfiler.h"
+
+#include "hermes/Support/JSONEmitter.h"
+#include "hermes/VM/CodeBlock.h"
+#include "hermes/VM/RuntimeModule.h"
+
+namespace hermes {
+namespace vm {
+
+/// Version of the JSON profile format.
+static constexpr int32_t kExecutionProfileVersion = 1;
+
+ExecutionProfiler::FunctionCounts &ExecutionProfiler::getCounts(
+    CodeBlock *codeBlock) {
+  RuntimeModule *module = codeBlock->getRuntimeModule();
+  auto it = modules_.find(module);
+  if (LLVM_UNLIKELY(it == modules_.end())) {
+    it = modules_
+             .insert(std::make_pair(
+                 module,
+                 std::vector<FunctionCounts>(
+                     module->getBytecode()->getFunctionCount())))
+             .first;
+  }
+  assert(
+      codeBlock->getFunctionID() < it->second.size() &&
+      "function ID out of range");
+  return it->second[codeBlock->getFunctionID()];
+}
+
+void ExecutionProfiler::removeRuntimeModule(RuntimeModule *module) {
+  auto it = modules_.find(module);
+  if (it == modules_.end())
+    return;
+  addModuleProfile(module, it->second, removedModules_);
+  modules_.erase(it);
+}
+
+void ExecutionProfiler::addModuleProfile(
+    RuntimeModule *module,
+    const std::vector<FunctionCounts> &moduleCounts,
+    ProfileMap &profile) {
+  auto *bcProvider = module->getBytecode();
+  const auto *debugInfo = bcProvider->getDebugInfo();
+  if (!debugInfo)
+    return;
+
+  for (uint32_t i = 0, e = moduleCounts.size(); i < e; ++i) {
+    const auto *offsets = bcProvider->getDebugOffsets(i);
+    if (!offsets || offsets->sourceLocations == hbc::DebugOffsets::NO_OFFSET)
+      continue;
+    auto pos = debugInfo->getFunctionLocation(offsets->sourceLocations);
+    if (!pos)
+      continue;
+
+    // The global function starts where the first function may start too.
+    const FunctionCounts &counts = moduleCounts[i];
+    FunctionProfile &entry =
+        profile[i == bcProvider->getGlobalFunctionIndex()
+                    ? std::string("global")
+                    : std::to_string(pos->line) + ":" +
+                        std::to_string(pos->column)];
+    if (entry.name.empty()) {
+      entry.name = module->getStringFromStringID(
+          bcProvider->getFunctionHeader(i).functionName());
+    }
+    entry.calls += counts.calls;
+    if (counts.firstExecution &&
+        (!entry.firstExecution || counts.firstExecution < entry.firstExecution))
+      entry.firstExecution = counts.firstExecution;
+
+    // Blocks past 2^16 share index 0, so their counts are unusable. Otherwise
+    // the entry block has the largest index, and the other blocks are numbered
+    // down from it in the order of the function's block list.
+    if (counts.blocks.size() < 2 || counts.blocks[0])
+      continue;
+    size_t numBlocks = counts.blocks.size() - 1;
+    if (entry.blocks.empty())
+      entry.blocks.resize(numBlocks);
+    if (entry.blocks.size() != numBlocks)
+      continue;
+    for (size_t index = 1; index <= numBlocks; ++index)
+      entry.blocks[numBlocks - index] += counts.blocks[index];
+  }
+}
+
+void ExecutionProfiler::dump(llvh::raw_ostream &OS) {
+  ProfileMap profile = removedModules_;
+  for (const auto &module : modules_)
+    addModuleProfile(module.first, module.second, profile);
+
+  JSONEmitter json(OS);
+  json.openDict();
+  json.emitKeyValue("version", kExecutionProfileVersion);
+  json.emitKey("functions");
+  json.openArray();
+  for (const auto &entry : profile) {
+    json.openDict();
+    json.emitKeyValue("name", entry.second.name);
+    json.emitKeyValue("location", entry.first);
+    json.emitKeyValue("calls", entry.second.calls);
+    json.emitKeyValue("first_execution", entry.second.firstExecution);
+    json.emitKey("blocks");
+    json.openArray();
+    json.emitValues(llvh::makeArrayRef(entry.second.blocks));
+    json.closeArray();
+    json.closeDict();
+  }
+  json.closeArray();
+  json.closeDict();
+  OS << "\n";
+}
+
+} // namespace vm
+} // namespace hermes
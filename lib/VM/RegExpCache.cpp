@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/RegExpCache.h"
+
+#include <cassert>
+
+namespace hermes {
+namespace vm {
+
+constexpr size_t RegExpCache::kMaxPatternLength;
+constexpr size_t RegExpCache::kMaxBytes;
+
+const std::vector<uint8_t> *RegExpCache::lookup(
+    llvh::ArrayRef<char16_t> pattern,
+    uint8_t flags) {
+  if (maxEntries_ == 0 || pattern.size() > kMaxPatternLength)
+    return nullptr;
+  auto it = map_.find(Key{pattern, flags});
+  if (it == map_.end()) {
+    ++stats_.regExpCache.misses;
+    return nullptr;
+  }
+  ++stats_.regExpCache.hits;
+  // Move the entry to the front of the list.
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return &it->second->bytecode;
+}
+
+void RegExpCache::insert(
+    llvh::ArrayRef<char16_t> pattern,
+    uint8_t flags,
+    std::vector<uint8_t> bytecode) {
+  if (maxEntries_ == 0 || pattern.size() > kMaxPatternLength)
+    return;
+  size_t entryBytes = pattern.size() * sizeof(char16_t) + bytecode.size();
+  if (entryBytes > kMaxBytes)
+    return;
+  assert(
+      map_.find(Key{pattern, flags}) == map_.end() &&
+      "pattern is already cached");
+
+  while (entries_.size() >= maxEntries_ || bytes_ + entryBytes > kMaxBytes)
+    evictOne();
+
+  entries_.push_front(Entry{
+      std::u16string(pattern.begin(), pattern.end()),
+      flags,
+      std::move(bytecode)});
+  Entry &entry = entries_.front();
+  map_.emplace(
+      Key{{entry.pattern.data(), entry.pattern.size()}, entry.flags},
+      entries_.begin());
+  bytes_ += entryBytes;
+}
+
+void RegExpCache::clear() {
+  map_.clear();
+  entries_.clear();
+  bytes_ = 0;
+}
+
+void RegExpCache::evictOne() {
+  assert(!entries_.empty() && "nothing to evict");
+  Entry &entry = entries_.back();
+  map_.erase(Key{{entry.pattern.data(), entry.pattern.size()}, entry.flags});
+  bytes_ -= entry.bytes();
+  entries_.pop_back();
+  ++stats_.regExpCache.evictions;
+}
+
+constexpr size_t RegExpJITCache::kMaxEntries;
+constexpr RegExpJITCache::Index RegExpJITCache::kNoCode;
+
+RegExpJITCache::Index RegExpJITCache::getOrCompile(
+    llvh::ArrayRef<uint8_t> bytecode) {
+  assert(enabled_ && "RegExp JIT is disabled");
+  std::string key(bytecode.begin(), bytecode.end());
+  auto it = map_.find(key);
+  if (it != map_.end())
+    return it->second;
+  if (map_.size() >= kMaxEntries)
+    return kNoCode;
+  auto compiled = regex::JITCompiledRegex::compile(bytecode);
+  Index index = compiled ? entries_.size() : kNoCode;
+  if (compiled)
+    entries_.push_back(std::move(compiled));
+  map_.emplace(std::move(key), index);
+  return index;
+}
+
+} // namespace vm
+} // namespace hermes
@@ -33,10 +33,12 @@
 #include "hermes/VM/PointerBase.h"
 #include "hermes/VM/PredefinedStringIDs.h"
 #include "hermes/VM/Profiler/CodeCoverageProfiler.h"
+#include "hermes/VM/Profiler/ExecutionProfiler.h"
 #include "hermes/VM/Profiler/SamplingProfiler.h"
 #include "hermes/VM/RuntimeModule-inline.h"
 #include "hermes/VM/StackFrame-inline.h"
 #include "hermes/VM/StackTracesTree.h"
+#include "hermes/VM/StringRefUtils.h"
 #include "hermes/VM/StringView.h"
 
 #ifndef HERMESVM_LEAN
@@ -169,6 +171,8 @@ Runtime::Runtime(
       trackIO_(runtimeConfig.getTrackIO()),
       vmExperimentFlags_(runtimeConfig.getVMExperimentFlags()),
       runtimeStats_(runtimeConfig.getEnableSampledStats()),
+      regExpCache_(runtimeConfig.getRegExpCacheSize(), runtimeStats_),
+      regExpJITCache_(runtimeConfig.getEnableRegExpJIT()),
       commonStorage_(
           createRuntimeCommonStorage(runtimeConfig.getTraceEnabled())),
       stackPointer_(),
@@ -354,6 +358,7 @@ Runtime::Runtime(
 
 Runtime::~Runtime() {
   samplingProfiler.reset();
+  executionProfiler.reset();
   getHeap().finalizeAll();
   // Now that all objects are finalized, there shouldn't be any native memory
   // keys left in the ID tracker for memory profiling. Assert that the only IDs
@@ -569,6 +574,12 @@ void Runtime::markWeakRoots(WeakRootAcceptor &acceptor, bool markLongLived) {
     for (auto &rm : runtimeModuleList_)
       rm.markWeakRoots(acceptor);
   }
+  // Cached strings are usually allocated in the young generation, so they have
+  // to be updated in every collection.
+  for (auto &entry : shortStringCache_) {
+    if (entry)
+      acceptor.acceptWeak(entry);
+  }
   for (auto &fn : customMarkWeakRootFuncs_)
     fn(&getHeap(), acceptor);
   acceptor.endRootSection();
@@ -645,6 +656,8 @@ void Runtime::removeRuntimeModule(RuntimeModule *rm) {
 #ifdef HERMES_ENABLE_DEBUGGER
   debugger_.willUnloadModule(rm);
 #endif
+  if (executionProfiler)
+    executionProfiler->removeRuntimeModule(rm);
   runtimeModuleList_.remove(*rm);
 }
 
@@ -1471,6 +1484,40 @@ Handle<StringPrimitive> Runtime::getCharacterString(char16_t ch) {
       ignoreAllocationFailure(StringPrimitive::create(this, UTF16Ref(ch))));
 }
 
+/// Shared implementation of Runtime::lookupShortString().
+template <typename T>
+static StringPrimitive *lookupShortStringImpl(
+    Runtime *runtime,
+    WeakRoot<StringPrimitive> &entry,
+    llvh::ArrayRef<T> str) {
+  if (!entry)
+    return nullptr;
+  StringPrimitive *cached = entry.get(runtime, &runtime->getHeap());
+  if (!cached || cached->getStringLength() != str.size())
+    return nullptr;
+  bool equal = cached->isASCII()
+      ? stringRefEquals(cached->getStringRef<char>(), str)
+      : stringRefEquals(cached->getStringRef<char16_t>(), str);
+  return equal ? cached : nullptr;
+}
+
+StringPrimitive *Runtime::lookupShortString(ASCIIRef str, uint32_t hash) {
+  return lookupShortStringImpl(
+      this, shortStringCache_[hash % kShortStringCacheSize], str);
+}
+
+StringPrimitive *Runtime::lookupShortString(UTF16Ref str, uint32_t hash) {
+  return lookupShortStringImpl(
+      this, shortStringCache_[hash % kShortStringCacheSize], str);
+}
+
+void Runtime::insertShortString(StringPrimitive *str, uint32_t hash) {
+  assert(
+      str->getStringLength() <= kShortStringCacheMaxLength &&
+      "string is too long for the short string cache");
+  shortStringCache_[hash % kShortStringCacheSize].set(this, str);
+}
+
 // Store all object and symbol ids in a static table to conserve code size.
 static const struct {
   uint16_t object, method;
@@ -239,6 +239,28 @@ void RuntimeModule::importStringIDMapMayAllocate() {
   // Populate the string ID map with empty identifiers.
   stringIDMap_.resize(strTableSize, RootSymbolID(SymbolID::empty()));
 
+  if (strTableSize == 0) {
+    // If the string table turns out to be empty,
+    // we always add one empty string to it.
+    // Note that this can only happen when we are creating the RuntimeModule
+    // in a non-standard way, either in unit tests or the special
+    // emptyCodeBlockRuntimeModule_ in Runtime where the creation happens
+    // manually instead of going through bytecode module generation.
+    // In those cases, functions will be created with a default nameID=0
+    // without adding the name string into the string table. Hence here
+    // we need to add it manually and it will have index 0.
+    ASCIIRef s;
+    stringIDMap_.push_back({});
+    mapStringMayAllocate(s, 0, hashString(s));
+    return;
+  }
+
+  // Registering a lazy identifier of a persistent module does not allocate,
+  // so it is deferred until the identifier is first used. This keeps the cost
+  // of loading a module independent of the number of identifiers it contains.
+  if (flags_.persistent)
+    return;
+
   if (runtime_->getVMExperimentFlags() &
       experiments::MAdviseStringsSequential) {
     bcProvider_->adviseStringTableSequential();
@@ -286,21 +308,6 @@ void RuntimeModule::importStringIDMapMayAllocate() {
   if (runtime_->getVMExperimentFlags() & experiments::MAdviseStringsRandom) {
     bcProvider_->adviseStringTableRandom();
   }
-
-  if (strTableSize == 0) {
-    // If the string table turns out to be empty,
-    // we always add one empty string to it.
-    // Note that this can only happen when we are creating the RuntimeModule
-    // in a non-standard way, either in unit tests or the special
-    // emptyCodeBlockRuntimeModule_ in Runtime where the creation happens
-    // manually instead of going through bytecode module generation.
-    // In those cases, functions will be created with a default nameID=0
-    // without adding the name string into the string table. Hence here
-    // we need to add it manually and it will have index 0.
-    ASCIIRef s;
-    stringIDMap_.push_back({});
-    mapStringMayAllocate(s, 0, hashString(s));
-  }
 }
 
 void RuntimeModule::initializeFunctionMap() {
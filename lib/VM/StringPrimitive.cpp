@@ -8,6 +8,8 @@
 #include "hermes/VM/StringPrimitive.h"
 
 #include "hermes/Support/Algorithms.h"
+#include "hermes/Support/HashString.h"
+#include "hermes/Support/StringKernels.h"
 #include "hermes/Support/UTF8.h"
 #include "hermes/VM/BuildMetadata.h"
 #include "hermes/VM/FillerCell.h"
@@ -158,9 +160,9 @@ void serializeExternalStringImpl(Serializer &s, const GCCell *cell) {
           .unsafeGetRaw());
   // Writes the actual string.
   s.writeData(self->getRawPointer(), self->getStringLength() * sizeof(T));
-  // contents_.data() is tracked by IDTracker for heapsnapshot. We should do
+  // getRawPointer() is tracked by IDTracker for heapsnapshot. We should do
   // relocation for it.
-  s.endObject((void *)self->contents_.data());
+  s.endObject((void *)self->getRawPointer());
 
   s.endObject(cell);
 }
@@ -249,6 +251,20 @@ CallResult<HermesValue> StringPrimitive::createEfficientImpl(
   if (str.size() == 1) {
     return runtime->getCharacterString(str[0]).getHermesValue();
   }
+  if (str.size() <= Runtime::kShortStringCacheMaxLength) {
+    // Short strings are frequently recreated with the same contents (property
+    // names from JSON, number keys, small slices), so share a cached copy.
+    uint32_t hash = hashString(str);
+    if (StringPrimitive *cached = runtime->lookupShortString(str, hash)) {
+      return HermesValue::encodeStringValue(cached);
+    }
+    auto result = createEfficientUncached(runtime, str);
+    if (LLVM_UNLIKELY(result == ExecutionStatus::EXCEPTION)) {
+      return ExecutionStatus::EXCEPTION;
+    }
+    runtime->insertShortString(result->getString(), hash);
+    return result;
+  }
 
   // Check if we should acquire ownership of storage.
   if (optStorage != nullptr &&
@@ -256,6 +272,15 @@ CallResult<HermesValue> StringPrimitive::createEfficientImpl(
     return ExternalStringPrimitive<T>::create(runtime, std::move(*optStorage));
   }
 
+  return createEfficientUncached(runtime, str);
+}
+
+template <typename T>
+CallResult<HermesValue> StringPrimitive::createEfficientUncached(
+    Runtime *runtime,
+    llvh::ArrayRef<T> str) {
+  constexpr bool charIs8Bit = std::is_same<T, char>::value;
+
   // Check if we fit in ASCII.
   // We are ASCII if we are 8 bit, or we are 16 bit and all of our text is
   // ASCII.
@@ -300,6 +325,34 @@ CallResult<HermesValue> StringPrimitive::createEfficient(
       runtime, llvh::makeArrayRef(str.data(), str.size()), &str);
 }
 
+template <typename T>
+CallResult<HermesValue> StringPrimitive::createExternalImpl(
+    Runtime *runtime,
+    llvh::ArrayRef<T> str,
+    std::unique_ptr<ExternalStringOwner> owner) {
+  if (str.size() < EXTERNAL_STRING_MIN_SIZE) {
+    // Not worth the finalizer; copy the characters and release them now.
+    return createEfficientImpl(runtime, str);
+  }
+  return ExternalStringPrimitive<T>::createWithOwner(
+      runtime, str, std::move(owner));
+}
+
+CallResult<HermesValue> StringPrimitive::createExternal(
+    Runtime *runtime,
+    ASCIIRef str,
+    std::unique_ptr<ExternalStringOwner> owner) {
+  assert(isAllASCII(str.begin(), str.end()) && "8 bit strings must be ASCII");
+  return createExternalImpl(runtime, str, std::move(owner));
+}
+
+CallResult<HermesValue> StringPrimitive::createExternal(
+    Runtime *runtime,
+    UTF16Ref str,
+    std::unique_ptr<ExternalStringOwner> owner) {
+  return createExternalImpl(runtime, str, std::move(owner));
+}
+
 CallResult<HermesValue> StringPrimitive::createDynamic(
     Runtime *runtime,
     UTF16Ref str) {
@@ -418,6 +471,19 @@ CallResult<HermesValue> StringPrimitive::slice(
   assert(
       start + length <= str->getStringLength() && "Invalid length for slice");
 
+  if (length <= Runtime::kShortStringCacheMaxLength) {
+    // Copy the characters out of the heap first, since creating the result may
+    // trigger a GC.
+    if (str->isASCII()) {
+      char buf[Runtime::kShortStringCacheMaxLength];
+      std::copy_n(str->castToASCIIPointer() + start, length, buf);
+      return createEfficient(runtime, ASCIIRef(buf, length));
+    }
+    char16_t buf[Runtime::kShortStringCacheMaxLength];
+    std::copy_n(str->castToUTF16Pointer() + start, length, buf);
+    return createEfficient(runtime, UTF16Ref(buf, length));
+  }
+
   SafeUInt32 safeLen(length);
 
   auto builder =
@@ -445,8 +511,9 @@ StringView StringPrimitive::createStringView(
 void StringPrimitive::appendUTF16String(
     llvh::SmallVectorImpl<char16_t> &str) const {
   if (isASCII()) {
-    const char *ptr = castToASCIIPointer();
-    str.append(ptr, ptr + getStringLength());
+    size_t existingLen = str.size();
+    str.resize(existingLen + getStringLength());
+    widenASCII(castToASCIIRef(), str.data() + existingLen);
   } else {
     const char16_t *ptr = castToUTF16Pointer();
     str.append(ptr, ptr + getStringLength());
@@ -455,8 +522,7 @@ void StringPrimitive::appendUTF16String(
 
 void StringPrimitive::appendUTF16String(char16_t *ptr) const {
   if (isASCII()) {
-    const char *src = castToASCIIPointer();
-    std::copy(src, src + getStringLength(), ptr);
+    widenASCII(castToASCIIRef(), ptr);
   } else {
     const char16_t *src = castToUTF16Pointer();
     std::copy(src, src + getStringLength(), ptr);
@@ -559,6 +625,23 @@ ExternalStringPrimitive<T>::ExternalStringPrimitive(
       "ExternalStringPrimitive length must be at least EXTERNAL_STRING_MIN_SIZE");
 }
 
+template <typename T>
+ExternalStringPrimitive<T>::ExternalStringPrimitive(
+    Runtime *runtime,
+    Ref hostChars,
+    ExternalStringOwner *owner)
+    : SymbolStringPrimitive(
+          runtime,
+          &vt,
+          sizeof(ExternalStringPrimitive<T>),
+          hostChars.size()),
+      hostChars_(hostChars.data()),
+      hostOwner_(owner) {
+  assert(
+      getStringLength() >= EXTERNAL_STRING_MIN_SIZE &&
+      "ExternalStringPrimitive length must be at least EXTERNAL_STRING_MIN_SIZE");
+}
+
 // NOTE: this is a template method in a template class, thus the two separate
 // template<> lines.
 template <typename T>
@@ -623,13 +706,37 @@ CallResult<HermesValue> ExternalStringPrimitive<T>::create(
   return create(runtime, StdString(length, T(0)));
 }
 
+template <typename T>
+CallResult<HermesValue> ExternalStringPrimitive<T>::createWithOwner(
+    Runtime *runtime,
+    Ref str,
+    std::unique_ptr<ExternalStringOwner> owner) {
+  if (LLVM_UNLIKELY(str.size() > MAX_STRING_LENGTH))
+    return runtime->raiseRangeError("String length exceeds limit");
+  if (LLVM_UNLIKELY(
+          !runtime->getHeap().canAllocExternalMemory(str.size() * sizeof(T)))) {
+    return runtime->raiseRangeError(
+        "Cannot allocate an external string primitive.");
+  }
+  // Use variable size alloc since ExternalStringPrimitive is derived from
+  // VariableSizeRuntimeCell.
+  auto *extStr =
+      runtime->makeAVariable<ExternalStringPrimitive<T>, HasFinalizer::Yes>(
+          sizeof(ExternalStringPrimitive<T>), runtime, str, owner.release());
+  runtime->getHeap().creditExternalMemory(
+      extStr, extStr->calcExternalMemorySize());
+  return HermesValue::encodeStringValue(extStr);
+}
+
 template <typename T>
 void ExternalStringPrimitive<T>::_finalizeImpl(GCCell *cell, GC *gc) {
   ExternalStringPrimitive<T> *self = vmcast<ExternalStringPrimitive<T>>(cell);
   // Remove the external string from the snapshot tracking system if it's being
   // tracked.
-  gc->getIDTracker().untrackNative(self->contents_.data());
+  gc->getIDTracker().untrackNative(self->getRawPointer());
   gc->debitExternalMemory(self, self->calcExternalMemorySize());
+  if (self->hostChars_)
+    delete self->hostOwner_;
   self->~ExternalStringPrimitive<T>();
 }
 
@@ -655,7 +762,7 @@ void ExternalStringPrimitive<T>::_snapshotAddEdgesImpl(
   snap.addNamedEdge(
       HeapSnapshot::EdgeType::Internal,
       "externalString",
-      gc->getNativeID(self->contents_.data()));
+      gc->getNativeID(self->getRawPointer()));
 }
 
 template <typename T>
@@ -668,8 +775,8 @@ void ExternalStringPrimitive<T>::_snapshotAddNodesImpl(
   snap.endNode(
       HeapSnapshot::NodeType::Native,
       "ExternalStringPrimitive",
-      gc->getNativeID(self->contents_.data()),
-      self->contents_.size(),
+      gc->getNativeID(self->getRawPointer()),
+      self->getStringLength(),
       0);
 }
 
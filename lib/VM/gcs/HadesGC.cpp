@@ -12,10 +12,12 @@
 #include "hermes/Support/ErrorHandling.h"
 #include "hermes/VM/AllocResult.h"
 #include "hermes/VM/CheckHeapWellFormedAcceptor.h"
+#include "hermes/VM/Deserializer.h"
 #include "hermes/VM/FillerCell.h"
 #include "hermes/VM/GCBase-inline.h"
 #include "hermes/VM/GCPointer.h"
 #include "hermes/VM/RootAndSlotAcceptorDefault.h"
+#include "hermes/VM/Serializer.h"
 #include "hermes/VM/SmallHermesValue-inline.h"
 
 #include <array>
@@ -1463,6 +1465,106 @@ std::string HadesGC::getKindAsStr() const {
   return kGCName;
 }
 
+#ifdef HERMESVM_SERIALIZE
+void HadesGC::serializeWeakRefs(Serializer &s) {
+  std::lock_guard<Mutex> lk{gcMutex_};
+  // Slots may only be marked during an OG collection.
+  waitForCollectionToFinish("serialize");
+  s.writeInt<uint32_t>(weakSlots_.size());
+  for (auto &slot : weakSlots_) {
+    auto state = slot.state();
+    s.writeInt<uint32_t>(state);
+    assert(state != WeakSlotState::Marked && "marked state would be lost");
+    if (state != WeakSlotState::Free) {
+      if (WeakRefSlot::kRelocKind == RelocationKind::HermesValue) {
+        s.writeHermesValue(
+            slot.hasValue() ? slot.value() : HermesValue::encodeEmptyValue());
+      } else {
+        s.writeRelocation(slot.getPointer());
+      }
+    }
+    // Call endObject() for slot because another free WeakSlot may have a
+    // pointer to &slot.
+    s.endObject(&slot);
+  }
+}
+
+void HadesGC::deserializeWeakRefs(Deserializer &d) {
+  if (weakSlots_.size() != 0) {
+    hermes_fatal(
+        "must deserialize WeakRefs before there are weak refs in heap");
+  }
+
+  uint32_t numWeakRefSlots = d.readInt<uint32_t>();
+  weakSlots_.resize(numWeakRefSlots);
+  for (auto &slot : weakSlots_) {
+    auto state = d.readInt<uint32_t>();
+    if (state == WeakSlotState::Free) {
+      freeWeakSlot(&slot);
+    } else {
+      assert(state == WeakSlotState::Unmarked);
+      if (WeakRefSlot::kRelocKind == RelocationKind::HermesValue) {
+        d.readHermesValue(
+            reinterpret_cast<HermesValue *>(slot.deserializeAddr()));
+      } else {
+        d.readRelocation(slot.deserializeAddr(), WeakRefSlot::kRelocKind);
+      }
+    }
+    d.endObject(&slot);
+  }
+}
+
+void HadesGC::serializeHeap(Serializer &s) {
+  std::lock_guard<Mutex> lk{gcMutex_};
+  // No allocations are allowed while the heap is written out.
+  NoAllocScope scope{this};
+  waitForCollectionToFinish("serialize");
+  GCCycle cycle{this, gcCallbacks_, "Serialize"};
+
+  const auto serializeObject = [&s](GCCell *cell) {
+    // ArrayStorage is serialized with its owner, since only the owner knows
+    // whether it contains native pointers. Free space is not serialized.
+    const CellKind kind = cell->getKind();
+    if (kind == CellKind::ArrayStorageKind || kind == CellKind::FreelistKind)
+      return;
+    s.writeInt<uint8_t>(static_cast<uint8_t>(kind));
+    s.serializeCell(cell);
+  };
+  youngGen().forAllObjs(serializeObject);
+  for (HeapSegment &seg : oldGen_)
+    seg.forAllObjs(serializeObject);
+  if (compactee_.segment)
+    compactee_.segment->forAllObjs(serializeObject);
+
+  // Write a 255 at the end to signal that we finish serializing heap objects.
+  s.writeInt<uint8_t>(255);
+}
+
+void HadesGC::deserializeHeap(Deserializer &d) {
+  uint8_t kind;
+  while ((kind = d.readInt<uint8_t>()) != 255) {
+    assert(
+        (CellKind)kind != CellKind::ArrayStorageKind &&
+        "ArrayStorage should be deserialized with owner.");
+    d.deserializeCell(kind);
+  }
+}
+
+void HadesGC::deserializeStart() {
+  GCBase::deserializeStart();
+  std::lock_guard<Mutex> lk{gcMutex_};
+  waitForCollectionToFinish("deserialize");
+  promoteYGToOGBeforeDeserialize_ = promoteYGToOG_;
+  promoteYGToOG_ = true;
+}
+
+void HadesGC::deserializeEnd() {
+  youngGenCollection("deserialize", /*forceOldGenCollection*/ false);
+  promoteYGToOG_ = promoteYGToOGBeforeDeserialize_;
+  GCBase::deserializeEnd();
+}
+#endif
+
 void HadesGC::collect(std::string cause, bool /*canEffectiveOOM*/) {
   {
     // Wait for any existing collections to finish before starting a new one.
@@ -2487,7 +2589,13 @@ void HadesGC::youngGenCollection(
   const bool doCompaction = compactee_.evacActive();
   // Attempt to promote the YG segment to OG if the flag is set. If this call
   // fails for any reason, proceed with a GC.
-  if (promoteYoungGenToOldGen()) {
+  const bool promoted = promoteYoungGenToOldGen();
+#ifdef HERMESVM_SERIALIZE
+  // Deserialization can't let objects move.
+  if (LLVM_UNLIKELY(deserializeInProgress_ && !promoted))
+    oom(make_error_code(OOMError::MaxHeapReached));
+#endif
+  if (promoted) {
     // Leave sweptBytes and sweptExternalBytes as defaults (which are 0).
     // Don't update the average YG survival ratio since no liveness was
     // calculated for the promotion case.
@@ -2612,7 +2720,12 @@ void HadesGC::youngGenCollection(
   // waiting for something that is both unlikely, and will increase the pause
   // time if it does happen.
   yieldToOldGen();
-  if (concurrentPhase_ == Phase::None) {
+  if (concurrentPhase_ == Phase::None
+#ifdef HERMESVM_SERIALIZE
+      // Objects being deserialized may be incomplete, don't mark them.
+      && !deserializeInProgress_
+#endif
+  ) {
     // There is no OG collection running, check the tripwire in case this is the
     // first YG after an OG completed.
     checkTripwireAndResetStats();
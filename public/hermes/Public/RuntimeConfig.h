@@ -134,6 +134,13 @@ class Deserializer;
                                                                                \
   /* The flags passed from a VM experiment */                                  \
   F(constexpr, uint32_t, VMExperimentFlags, 0)                                 \
+                                                                               \
+  /* Number of compiled RegExps to cache, keyed by pattern and flags. */       \
+  /* Zero disables the cache. */                                               \
+  F(constexpr, unsigned, RegExpCacheSize, 64)                                  \
+                                                                               \
+  /* Whether to compile RegExps to native code, where supported. */            \
+  F(constexpr, bool, EnableRegExpJIT, false)                                   \
   /* RUNTIME_FIELDS END */
 
 #ifdef HERMESVM_SERIALIZE
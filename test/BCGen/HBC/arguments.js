@@ -54,7 +54,7 @@ function build() {
 //CHECK-LABEL:function buffalobuffalo() : string|number
 //CHECK-NEXT:frame = []
 //CHECK-NEXT:%BB0:
-//CHECK-NEXT:  $Reg0 @0 [1...5)  %0 = AllocStackInst $arguments
+//CHECK-NEXT:  $Reg0 @0 [1...6)  %0 = AllocStackInst $arguments
 //CHECK-NEXT:  $Reg1 @1 [2...3)  %1 = HBCLoadConstInst undefined : undefined
 //CHECK-NEXT:  $Reg1 @2 [empty]  %2 = StoreStackInst %1 : undefined, %0
 //CHECK-NEXT:  $Reg1 @3 [empty]  %3 = HBCReifyArgumentsInst %0
@@ -35,19 +35,19 @@ var z = [{}];
 //CHECK-NEXT:    DeclareGlobalVar  "x"
 //CHECK-NEXT:    DeclareGlobalVar  "y"
 //CHECK-NEXT:    DeclareGlobalVar  "z"
-//CHECK-NEXT:    NewArrayWithBuffer r1, 6, 4, 0
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    PutOwnByIndex     r1, r0, 4
+//CHECK-NEXT:    NewArrayWithBuffer r0, 6, 4, 0
+//CHECK-NEXT:    LoadConstUndefined r1
+//CHECK-NEXT:    PutOwnByIndex     r0, r1, 4
 //CHECK-NEXT:    LoadConstNull     r2
-//CHECK-NEXT:    PutOwnByIndex     r1, r2, 5
+//CHECK-NEXT:    PutOwnByIndex     r0, r2, 5
 //CHECK-NEXT:    GetGlobalObject   r2
-//CHECK-NEXT:    PutById           r2, r1, 1, "x"
-//CHECK-NEXT:    NewArrayWithBuffer r1, 5, 3, 11
+//CHECK-NEXT:    PutById           r2, r0, 1, "x"
+//CHECK-NEXT:    NewArrayWithBuffer r0, 5, 3, 11
 //CHECK-NEXT:    LoadConstUInt8    r3, 5
-//CHECK-NEXT:    PutById           r1, r3, 2, "length"
-//CHECK-NEXT:    PutById           r2, r1, 3, "y"
-//CHECK-NEXT:    NewArray          r1, 1
+//CHECK-NEXT:    PutById           r0, r3, 2, "length"
+//CHECK-NEXT:    PutById           r2, r0, 3, "y"
+//CHECK-NEXT:    NewArray          r0, 1
 //CHECK-NEXT:    NewObject         r3
-//CHECK-NEXT:    PutOwnByIndex     r1, r3, 0
-//CHECK-NEXT:    PutById           r2, r1, 4, "z"
-//CHECK-NEXT:    Ret               r0
+//CHECK-NEXT:    PutOwnByIndex     r0, r3, 0
+//CHECK-NEXT:    PutById           r2, r0, 4, "z"
+//CHECK-NEXT:    Ret               r1
@@ -12,14 +12,14 @@
 //CHECK-NEXT:Offset in debug table: source 0x0000, lexical 0x0000
 //CHECK-NEXT:    DeclareGlobalVar  "foo"
 //CHECK-NEXT:    CreateEnvironment r0
-//CHECK-NEXT:    CreateClosure     r1, r0, 1
-//CHECK-NEXT:    GetGlobalObject   r0
-//CHECK-NEXT:    PutById           r0, r1, 1, "foo"
-//CHECK-NEXT:    GetByIdShort      r3, r0, 1, "foo"
-//CHECK-NEXT:    LoadConstUndefined r2
-//CHECK-NEXT:    LoadConstZero     r1
-//CHECK-NEXT:    LoadConstUInt8    r0, 1
-//CHECK-NEXT:    Call4             r0, r3, r2, r1, r1, r0
+//CHECK-NEXT:    CreateClosure     r0, r0, 1
+//CHECK-NEXT:    GetGlobalObject   r1
+//CHECK-NEXT:    PutById           r1, r0, 1, "foo"
+//CHECK-NEXT:    GetByIdShort      r0, r1, 1, "foo"
+//CHECK-NEXT:    LoadConstUndefined r1
+//CHECK-NEXT:    LoadConstZero     r2
+//CHECK-NEXT:    LoadConstUInt8    r3, 1
+//CHECK-NEXT:    Call4             r0, r0, r1, r2, r2, r3
 //CHECK-NEXT:    Ret               r0
 
 function foo(x, y, z) { }
@@ -38,24 +38,23 @@ foo();
 
 //CHECK:Function<cjs_module>(4 params, 13 registers, 1 symbols):
 //CHECK-NEXT:Offset in debug table: source 0x0000, lexical 0x0000
-//CHECK-NEXT:    CreateEnvironment r3
-//CHECK-NEXT:    CreateClosure     r1, r3, 2
-//CHECK-NEXT:    GetGlobalObject   r0
-//CHECK-NEXT:    TryGetById        r4, r0, 1, "encodeURIComponen"...
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    LoadConstString   r2, "asdf"
-//CHECK-NEXT:    Call2             r2, r4, r0, r2
-//CHECK-NEXT:    StoreToEnvironment r3, 0, r2
+//CHECK-NEXT:    CreateEnvironment r0
+//CHECK-NEXT:    CreateClosure     r1, r0, 2
+//CHECK-NEXT:    GetGlobalObject   r2
+//CHECK-NEXT:    TryGetById        r2, r2, 1, "encodeURIComponen"...
+//CHECK-NEXT:    LoadConstUndefined r3
+//CHECK-NEXT:    LoadConstString   r4, "asdf"
+//CHECK-NEXT:    Call2             r2, r2, r3, r4
+//CHECK-NEXT:    StoreToEnvironment r0, 0, r2
 //CHECK-NEXT:L4:
-//CHECK-NEXT:    Mov               r2, r1
-//CHECK-NEXT:    Call1             r2, r2, r0
+//CHECK-NEXT:    Call1             r0, r1, r3
 //CHECK-NEXT:L5:
 //CHECK-NEXT:    Jmp               L2
 //CHECK-NEXT:L1:
-//CHECK-NEXT:    Catch             r2
+//CHECK-NEXT:    Catch             r0
 //CHECK-NEXT:L2:
-//CHECK-NEXT:    Call1             r1, r1, r0
-//CHECK-NEXT:    Ret               r0
+//CHECK-NEXT:    Call1             r0, r1, r3
+//CHECK-NEXT:    Ret               r3
 
 //CHECK:Exception Handlers:
 //CHECK-NEXT:0: start = L4, end = L5, target = L1
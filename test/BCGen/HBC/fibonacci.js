@@ -9,21 +9,21 @@
 
 //CHECK-LABEL:Function<fibonacci>(2 params, {{[0-9]+}} registers, 0 symbols):
 //CHECK-NEXT:Offset in debug table: {{.*}}
-//CHECK-NEXT:[@ {{.*}}] LoadParam 5<Reg8>, 1<UInt8>
-//CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 0<Reg8>, 1<UInt8>
-//CHECK-NEXT:[@ {{.*}}] JLessEqual 45<Addr8>, 5<Reg8>, 0<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetGlobalObject 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetByIdShort 3<Reg8>, 1<Reg8>, 1<UInt8>, 1<UInt8>
-//CHECK-NEXT:[@ {{.*}}] Sub 2<Reg8>, 5<Reg8>, 0<Reg8>
-//CHECK-NEXT:[@ {{.*}}] LoadConstUndefined 4<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Call2 2<Reg8>, 3<Reg8>, 4<Reg8>, 2<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetByIdShort 3<Reg8>, 1<Reg8>, 1<UInt8>, 1<UInt8>
-//CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 1<Reg8>, 2<UInt8>
-//CHECK-NEXT:[@ {{.*}}] Sub 1<Reg8>, 5<Reg8>, 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Call2 1<Reg8>, 3<Reg8>, 4<Reg8>, 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Add 1<Reg8>, 2<Reg8>, 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Ret 1<Reg8>
+//CHECK-NEXT:[@ {{.*}}] LoadParam 0<Reg8>, 1<UInt8>
+//CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 1<Reg8>, 1<UInt8>
+//CHECK-NEXT:[@ {{.*}}] JLessEqual 45<Addr8>, 0<Reg8>, 1<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetGlobalObject 2<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetByIdShort 3<Reg8>, 2<Reg8>, 1<UInt8>, 1<UInt8>
+//CHECK-NEXT:[@ {{.*}}] Sub 4<Reg8>, 0<Reg8>, 1<Reg8>
+//CHECK-NEXT:[@ {{.*}}] LoadConstUndefined 5<Reg8>
+//CHECK-NEXT:[@ {{.*}}] Call2 3<Reg8>, 3<Reg8>, 5<Reg8>, 4<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetByIdShort 2<Reg8>, 2<Reg8>, 1<UInt8>, 1<UInt8>
+//CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 4<Reg8>, 2<UInt8>
+//CHECK-NEXT:[@ {{.*}}] Sub 0<Reg8>, 0<Reg8>, 4<Reg8>
+//CHECK-NEXT:[@ {{.*}}] Call2 0<Reg8>, 2<Reg8>, 5<Reg8>, 0<Reg8>
+//CHECK-NEXT:[@ {{.*}}] Add 0<Reg8>, 3<Reg8>, 0<Reg8>
 //CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
+//CHECK-NEXT:[@ {{.*}}] Ret 1<Reg8>
 
 function fibonacci(num) {
   if (num <= 1) return 1;
@@ -13,15 +13,14 @@
 
 //CHECK-LABEL:Function<test_one>(3 params, 7 registers, 0 symbols):
 //CHECK-NEXT:Offset in debug table: {{.*}}
-//CHECK-NEXT:[@ {{.*}}] LoadParam 5<Reg8>, 1<UInt8>
-//CHECK-NEXT:[@ {{.*}}] Mov 3<Reg8>, 5<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetPNameList 4<Reg8>, 3<Reg8>, 2<Reg8>, 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] JmpUndefined 21<Addr8>, 4<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetNextPName 0<Reg8>, 4<Reg8>, 3<Reg8>, 2<Reg8>, 1<Reg8>
-//CHECK-NEXT:[@ {{.*}}] JmpUndefined 12<Addr8>, 0<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Mov 6<Reg8>, 0<Reg8>
-//CHECK-NEXT:[@ {{.*}}] GetByVal 6<Reg8>, 5<Reg8>, 6<Reg8>
-//CHECK-NEXT:[@ {{.*}}] Jmp -16<Addr8>
+//CHECK-NEXT:[@ {{.*}}] LoadParam 0<Reg8>, 1<UInt8>
+//CHECK-NEXT:[@ {{.*}}] Mov 2<Reg8>, 0<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetPNameList 1<Reg8>, 2<Reg8>, 3<Reg8>, 4<Reg8>
+//CHECK-NEXT:[@ {{.*}}] JmpUndefined 18<Addr8>, 1<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetNextPName 5<Reg8>, 1<Reg8>, 2<Reg8>, 3<Reg8>, 4<Reg8>
+//CHECK-NEXT:[@ {{.*}}] JmpUndefined 9<Addr8>, 5<Reg8>
+//CHECK-NEXT:[@ {{.*}}] GetByVal 6<Reg8>, 0<Reg8>, 5<Reg8>
+//CHECK-NEXT:[@ {{.*}}] Jmp -13<Addr8>
 //CHECK-NEXT:[@ {{.*}}] LoadConstUndefined 0<Reg8>
 //CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
 function test_one(x, f) {
@@ -17,19 +17,19 @@ var obj = {
 //CHECK-LABEL:Function<global>{{.*}}:
 //CHECK-NEXT:Offset in debug table: {{.*}}
 //CHECK-NEXT:    DeclareGlobalVar  "obj"
-//CHECK-NEXT:    CreateEnvironment r1
-//CHECK-NEXT:    NewObject         r2
-//CHECK-NEXT:    CreateClosure     r4, r1, 1
-//CHECK-NEXT:    CreateClosure     r3, r1, 2
-//CHECK-NEXT:    LoadConstString   r0, "b"
-//CHECK-NEXT:    PutOwnGetterSetterByVal r2, r0, r4, r3, 1
-//CHECK-NEXT:    CreateClosure     r4, r1, 3
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    LoadConstString   r3, "c"
-//CHECK-NEXT:    PutOwnGetterSetterByVal r2, r3, r4, r0, 1
-//CHECK-NEXT:    CreateClosure     r3, r1, 4
-//CHECK-NEXT:    LoadConstString   r1, "d"
-//CHECK-NEXT:    PutOwnGetterSetterByVal r2, r1, r0, r3, 1
-//CHECK-NEXT:    GetGlobalObject   r1
-//CHECK-NEXT:    PutById           r1, r2, 1, "obj"
-//CHECK-NEXT:    Ret               r0
+//CHECK-NEXT:    CreateEnvironment r0
+//CHECK-NEXT:    NewObject         r1
+//CHECK-NEXT:    CreateClosure     r2, r0, 1
+//CHECK-NEXT:    CreateClosure     r3, r0, 2
+//CHECK-NEXT:    LoadConstString   r4, "b"
+//CHECK-NEXT:    PutOwnGetterSetterByVal r1, r4, r2, r3, 1
+//CHECK-NEXT:    CreateClosure     r2, r0, 3
+//CHECK-NEXT:    LoadConstUndefined r3
+//CHECK-NEXT:    LoadConstString   r4, "c"
+//CHECK-NEXT:    PutOwnGetterSetterByVal r1, r4, r2, r3, 1
+//CHECK-NEXT:    CreateClosure     r0, r0, 4
+//CHECK-NEXT:    LoadConstString   r2, "d"
+//CHECK-NEXT:    PutOwnGetterSetterByVal r1, r2, r3, r0, 1
+//CHECK-NEXT:    GetGlobalObject   r0
+//CHECK-NEXT:    PutById           r0, r1, 1, "obj"
+//CHECK-NEXT:    Ret               r3
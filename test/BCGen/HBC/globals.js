@@ -18,10 +18,10 @@ y = x;
 //CHECK-NEXT:    LoadConstUInt8    r0, 5
 //CHECK-NEXT:    GetGlobalObject   r1
 //CHECK-NEXT:    PutById           r1, r0, 1, "x"
-//CHECK-NEXT:    TryGetById        r3, r1, 1, "foo"
+//CHECK-NEXT:    TryGetById        r0, r1, 1, "foo"
 //CHECK-NEXT:    GetByIdShort      r2, r1, 2, "x"
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    Call2             r0, r3, r0, r2
+//CHECK-NEXT:    LoadConstUndefined r3
+//CHECK-NEXT:    Call2             r0, r0, r3, r2
 //CHECK-NEXT:    GetByIdShort      r0, r1, 2, "x"
 //CHECK-NEXT:    TryPutById        r1, r0, 2, "y"
 //CHECK-NEXT:    Ret               r0
@@ -32,10 +32,10 @@ y = x;
 //CHKNONSTRICT-NEXT:    LoadConstUInt8    r0, 5
 //CHKNONSTRICT-NEXT:    GetGlobalObject   r1
 //CHKNONSTRICT-NEXT:    PutById           r1, r0, 1, "x"
-//CHKNONSTRICT-NEXT:    TryGetById        r3, r1, 1, "foo"
+//CHKNONSTRICT-NEXT:    TryGetById        r0, r1, 1, "foo"
 //CHKNONSTRICT-NEXT:    GetByIdShort      r2, r1, 2, "x"
-//CHKNONSTRICT-NEXT:    LoadConstUndefined r0
-//CHKNONSTRICT-NEXT:    Call2             r0, r3, r0, r2
+//CHKNONSTRICT-NEXT:    LoadConstUndefined r3
+//CHKNONSTRICT-NEXT:    Call2             r0, r0, r3, r2
 //CHKNONSTRICT-NEXT:    GetByIdShort      r0, r1, 2, "x"
 //CHKNONSTRICT-NEXT:    PutById           r1, r0, 2, "y"
 //CHKNONSTRICT-NEXT:    Ret               r0
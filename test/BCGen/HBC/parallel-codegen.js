@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -O -emit-binary -out %t.1.hbc %s
+// RUN: %hermesc -O -emit-binary -threads=4 -out %t.4.hbc %s
+// RUN: cmp %t.1.hbc %t.4.hbc
+// RUN: %hermesc -O0 -emit-binary -out %t.O0.1.hbc %s
+// RUN: %hermesc -O0 -emit-binary -j 3 -out %t.O0.3.hbc %s
+// RUN: cmp %t.O0.1.hbc %t.O0.3.hbc
+// RUN: %hermes %t.4.hbc | %FileCheck --match-full-lines %s
+
+// Bytecode generated on several threads must be identical to bytecode
+// generated on one.
+
+function makePoint(x, y) {
+  return {x: x, y: y, tag: 'point', coords: [x, y]};
+}
+
+function norm(p) {
+  return Math.sqrt(p.x * p.x + p.y * p.y);
+}
+
+function classify(s) {
+  if (/^\d+$/.test(s)) return 'number';
+  if (/^[a-z]+$/i.test(s)) return 'word';
+  return 'other';
+}
+
+function counter() {
+  var n = 0;
+  return function () {
+    return ++n;
+  };
+}
+
+function safeParse(s) {
+  try {
+    return JSON.parse(s);
+  } catch (e) {
+    return 'invalid';
+  }
+}
+
+function sumSwitch(arr) {
+  var total = 0;
+  for (var i = 0; i < arr.length; i++) {
+    switch (arr[i] % 3) {
+      case 0:
+        total += arr[i];
+        break;
+      case 1:
+        total -= 1;
+        break;
+      default:
+        total *= 2;
+    }
+  }
+  return total;
+}
+
+var c = counter();
+c();
+print(norm(makePoint(3, 4)), classify('123'), classify('abc'), classify('!'));
+// CHECK: 5 number word other
+print(c(), safeParse('{"a": [1]}').a[0], safeParse('{'));
+// CHECK-NEXT: 2 1 invalid
+print(sumSwitch([1, 2, 3, 4, 5, 6]));
+// CHECK-NEXT: 6
@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -profile-generate=%t.json %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+// RUN: %hermesc -O -dump-bytecode %s | %FileCheck --match-full-lines --check-prefix=NOPROFILE %s
+// RUN: %hermesc -O -profile-use=%t.json -dump-bytecode %s | %FileCheck --match-full-lines %s
+
+// Functions are laid out in the order in which they first ran, followed by the
+// functions that never ran.
+
+function first() {
+  return "first";
+}
+function second() {
+  return "second";
+}
+function third() {
+  return "third";
+}
+print(third(), first());
+
+// EXEC: third first
+
+// NOPROFILE: Function<global>({{.*}}
+// NOPROFILE: Function<first>({{.*}}
+// NOPROFILE: Function<second>({{.*}}
+// NOPROFILE: Function<third>({{.*}}
+
+// CHECK: Function<global>({{.*}}
+// CHECK: Function<third>({{.*}}
+// CHECK: Function<first>({{.*}}
+// CHECK: Function<second>({{.*}}
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -profile-generate=%t.json %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+// RUN: cat %t.json | %FileCheck --match-full-lines --check-prefix=PROFILE %s
+// RUN: %hermesc -O -dump-bytecode %s | %FileCheck --match-full-lines --check-prefix=NOPROFILE %s
+// RUN: %hermesc -O -profile-use=%t.json -dump-bytecode %s | %FileCheck --match-full-lines %s
+
+// Blocks that never ran are moved to the end of their function, and the most
+// executed successor of each block follows it.
+
+function check(x) {
+  var r;
+  if (x < 0) {
+    r = "negative " + x;
+  } else {
+    r = "ok";
+  }
+  return r;
+}
+for (var i = 0; i < 10; ++i) check(i);
+print(check(5));
+
+// EXEC: ok
+
+// PROFILE: {"version":1,"functions":[{"name":"check","location":"16:1","calls":11,"first_execution":2,"blocks":[11,0,11]},{"name":"global","location":"global","calls":1,"first_execution":1,"blocks":[1,10,1]}]}
+
+// NOPROFILE-LABEL: Function<check>(2 params, 3 registers, 0 symbols):
+// NOPROFILE-NEXT: Offset in debug table: source 0x{{.*}}, lexical 0x0000
+// NOPROFILE-NEXT:     LoadParam         r0, 1
+// NOPROFILE-NEXT:     LoadConstString   r1, "ok"
+// NOPROFILE-NEXT:     LoadConstZero     r2
+// NOPROFILE-NEXT:     JNotLess          L1, r0, r2
+// NOPROFILE-NEXT:     LoadConstString   r2, "negative "
+// NOPROFILE-NEXT:     Add               r1, r2, r0
+// NOPROFILE-NEXT: L1:
+// NOPROFILE-NEXT:     Ret               r1
+
+// CHECK-LABEL: Function<check>(2 params, 3 registers, 0 symbols):
+// CHECK-NEXT: Offset in debug table: source 0x{{.*}}, lexical 0x0000
+// CHECK-NEXT:     LoadParam         r0, 1
+// CHECK-NEXT:     LoadConstString   r1, "ok"
+// CHECK-NEXT:     LoadConstZero     r2
+// CHECK-NEXT:     JLess             L1, r0, r2
+// CHECK-NEXT: L3:
+// CHECK-NEXT:     Ret               r1
+// CHECK-NEXT: L1:
+// CHECK-NEXT:     LoadConstString   r2, "negative "
+// CHECK-NEXT:     Add               r1, r2, r0
+// CHECK-NEXT:     Jmp               L3
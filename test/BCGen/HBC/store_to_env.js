@@ -51,23 +51,23 @@ function foo() {
 
 // CHECK: Function<bar>(1 params, 13 registers, 0 symbols):
 // CHECK-NEXT: Offset in debug table: {{.*}}
-// CHECK-NEXT:     GetEnvironment    r1, 0
-// CHECK-NEXT:     LoadFromEnvironment r2, r1, 0
-// CHECK-NEXT:     LoadConstUInt8    r0, 1
-// CHECK-NEXT:     Add               r0, r2, r0
-// CHECK-NEXT:     StoreNPToEnvironment r1, 0, r0
-// CHECK-NEXT:     LoadConstFalse    r0
-// CHECK-NEXT:     StoreNPToEnvironment r1, 1, r0
-// CHECK-NEXT:     LoadConstString   r0, "new string"
-// CHECK-NEXT:     StoreToEnvironment r1, 2, r0
-// CHECK-NEXT:     GetGlobalObject   r2
-// CHECK-NEXT:     TryGetById        r4, r2, 1, "print"
-// CHECK-NEXT:     LoadFromEnvironment r3, r1, 3
-// CHECK-NEXT:     LoadConstUndefined r0
-// CHECK-NEXT:     Call2             r3, r4, r0, r3
-// CHECK-NEXT:     TryGetById        r3, r2, 1, "print"
-// CHECK-NEXT:     LoadFromEnvironment r2, r1, 4
-// CHECK-NEXT:     Call2             r2, r3, r0, r2
-// CHECK-NEXT:     StoreNPToEnvironment r1, 5, r0
-// CHECK-NEXT:     Ret               r0
+// CHECK-NEXT:     GetEnvironment    r0, 0
+// CHECK-NEXT:     LoadFromEnvironment r1, r0, 0
+// CHECK-NEXT:     LoadConstUInt8    r2, 1
+// CHECK-NEXT:     Add               r1, r1, r2
+// CHECK-NEXT:     StoreNPToEnvironment r0, 0, r1
+// CHECK-NEXT:     LoadConstFalse    r1
+// CHECK-NEXT:     StoreNPToEnvironment r0, 1, r1
+// CHECK-NEXT:     LoadConstString   r1, "new string"
+// CHECK-NEXT:     StoreToEnvironment r0, 2, r1
+// CHECK-NEXT:     GetGlobalObject   r1
+// CHECK-NEXT:     TryGetById        r2, r1, 1, "print"
+// CHECK-NEXT:     LoadFromEnvironment r3, r0, 3
+// CHECK-NEXT:     LoadConstUndefined r4
+// CHECK-NEXT:     Call2             r2, r2, r4, r3
+// CHECK-NEXT:     TryGetById        r1, r1, 1, "print"
+// CHECK-NEXT:     LoadFromEnvironment r2, r0, 4
+// CHECK-NEXT:     Call2             r1, r1, r4, r2
+// CHECK-NEXT:     StoreNPToEnvironment r0, 5, r4
+// CHECK-NEXT:     Ret               r4
 
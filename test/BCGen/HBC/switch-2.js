@@ -106,9 +106,9 @@ function f(x) {
 //CHECK-NEXT:[@ 109] LoadConstInt 1<Reg8>, 362<Imm32>
 //CHECK-NEXT:[@ 115] Ret 1<Reg8>
 //CHECK-NEXT:[@ 117] GetGlobalObject 1<Reg8>
-//CHECK-NEXT:[@ 119] GetByIdShort 2<Reg8>, 1<Reg8>, 1<UInt8>, 1<UInt8>
-//CHECK-NEXT:[@ 124] LoadConstUndefined 1<Reg8>
-//CHECK-NEXT:[@ 126] Call1 1<Reg8>, 2<Reg8>, 1<Reg8>
+//CHECK-NEXT:[@ 119] GetByIdShort 1<Reg8>, 1<Reg8>, 1<UInt8>, 1<UInt8>
+//CHECK-NEXT:[@ 124] LoadConstUndefined 2<Reg8>
+//CHECK-NEXT:[@ 126] Call1 1<Reg8>, 1<Reg8>, 2<Reg8>
 //CHECK-NEXT:[@ 130] LoadConstInt 1<Reg8>, 342<Imm32>
 //CHECK-NEXT:[@ 136] Ret 1<Reg8>
 //CHECK-NEXT:[@ 138] LoadConstUInt8 1<Reg8>, 132<UInt8>
@@ -135,9 +135,9 @@ function f(x) {
 //CHECK-NEXT:[@ 230] LoadConstInt 0<Reg8>, 2332<Imm32>
 //CHECK-NEXT:[@ 236] Ret 0<Reg8>
 //CHECK-NEXT:[@ 238] GetGlobalObject 0<Reg8>
-//CHECK-NEXT:[@ 240] GetByIdShort 1<Reg8>, 0<Reg8>, 1<UInt8>, 1<UInt8>
-//CHECK-NEXT:[@ 245] LoadConstUndefined 0<Reg8>
-//CHECK-NEXT:[@ 247] Call1 0<Reg8>, 1<Reg8>, 0<Reg8>
+//CHECK-NEXT:[@ 240] GetByIdShort 0<Reg8>, 0<Reg8>, 1<UInt8>, 1<UInt8>
+//CHECK-NEXT:[@ 245] LoadConstUndefined 1<Reg8>
+//CHECK-NEXT:[@ 247] Call1 0<Reg8>, 0<Reg8>, 1<Reg8>
 //CHECK-NEXT:[@ 251] LoadConstInt 0<Reg8>, 342<Imm32>
 //CHECK-NEXT:[@ 257] Ret 0<Reg8>
 //CHECK-NEXT:[@ 259] LoadConstUInt8 0<Reg8>, 132<UInt8>
@@ -147,10 +147,10 @@ function f(x) {
 //CHECK-NEXT:[@ 272] LoadConstInt 0<Reg8>, 342<Imm32>
 //CHECK-NEXT:[@ 278] Ret 0<Reg8>
 //CHECK-NEXT:[@ 280] GetGlobalObject 0<Reg8>
-//CHECK-NEXT:[@ 282] GetByIdShort 1<Reg8>, 0<Reg8>, 1<UInt8>, 1<UInt8>
-//CHECK-NEXT:[@ 287] LoadConstUndefined 0<Reg8>
-//CHECK-NEXT:[@ 289] Call1 1<Reg8>, 1<Reg8>, 0<Reg8>
-//CHECK-NEXT:[@ 293] Ret 0<Reg8>
+//CHECK-NEXT:[@ 282] GetByIdShort 0<Reg8>, 0<Reg8>, 1<UInt8>, 1<UInt8>
+//CHECK-NEXT:[@ 287] LoadConstUndefined 1<Reg8>
+//CHECK-NEXT:[@ 289] Call1 0<Reg8>, 0<Reg8>, 1<Reg8>
+//CHECK-NEXT:[@ 293] Ret 1<Reg8>
 
 //CHECK-LABEL: Jump Tables:
 //CHECK-NEXT:  offset 292
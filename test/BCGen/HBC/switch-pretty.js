@@ -119,9 +119,9 @@ function f(x) {
 //CHECK-NEXT:    Ret               r1
 //CHECK-NEXT:L5:
 //CHECK-NEXT:    GetGlobalObject   r1
-//CHECK-NEXT:    GetByIdShort      r2, r1, 1, "g"
-//CHECK-NEXT:    LoadConstUndefined r1
-//CHECK-NEXT:    Call1             r1, r2, r1
+//CHECK-NEXT:    GetByIdShort      r1, r1, 1, "g"
+//CHECK-NEXT:    LoadConstUndefined r2
+//CHECK-NEXT:    Call1             r1, r1, r2
 //CHECK-NEXT:    LoadConstInt      r1, 342
 //CHECK-NEXT:    Ret               r1
 //CHECK-NEXT:L4:
@@ -161,9 +161,9 @@ function f(x) {
 //CHECK-NEXT:    Ret               r0
 //CHECK-NEXT:L22:
 //CHECK-NEXT:    GetGlobalObject   r0
-//CHECK-NEXT:    GetByIdShort      r1, r0, 1, "g"
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    Call1             r0, r1, r0
+//CHECK-NEXT:    GetByIdShort      r0, r0, 1, "g"
+//CHECK-NEXT:    LoadConstUndefined r1
+//CHECK-NEXT:    Call1             r0, r0, r1
 //CHECK-NEXT:    LoadConstInt      r0, 342
 //CHECK-NEXT:    Ret               r0
 //CHECK-NEXT:L21:
@@ -177,10 +177,10 @@ function f(x) {
 //CHECK-NEXT:    Ret               r0
 //CHECK-NEXT:L23:
 //CHECK-NEXT:    GetGlobalObject   r0
-//CHECK-NEXT:    GetByIdShort      r1, r0, 1, "g"
-//CHECK-NEXT:    LoadConstUndefined r0
-//CHECK-NEXT:    Call1             r1, r1, r0
-//CHECK-NEXT:    Ret               r0
+//CHECK-NEXT:    GetByIdShort      r0, r0, 1, "g"
+//CHECK-NEXT:    LoadConstUndefined r1
+//CHECK-NEXT:    Call1             r0, r0, r1
+//CHECK-NEXT:    Ret               r1
 
 //CHECK-LABEL: Jump Tables:
 //CHECK-NEXT:  offset 292
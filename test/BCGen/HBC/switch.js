@@ -13,7 +13,7 @@
 //CHECK-NEXT:   {{.*}} 	%0 = HBCLoadParamInst 1 : number
 //CHECK-NEXT:   {{.*}} 	%1 = HBCLoadConstInst "fall" : string
 //CHECK-NEXT:   {{.*}} 	%2 = HBCLoadConstInst "" : string
-//CHECK-NEXT:   $Reg2 @3 [empty]	%3 = BranchInst %BB1
+//CHECK-NEXT:   $Reg3 @3 [empty]	%3 = BranchInst %BB1
 //CHECK-NEXT: %BB2:
 //CHECK-NEXT:   {{.*}} 	%4 = HBCLoadConstInst "regular" : string
 //CHECK-NEXT:   $Reg0 @26 [empty]	%5 = ReturnInst %4 : string
@@ -30,23 +30,23 @@
 //CHECK-NEXT:   $Reg0 @22 [empty]	%13 = ReturnInst %12 : string
 //CHECK-NEXT: %BB7:
 //CHECK-NEXT:   {{.*}} 	%14 = HBCLoadConstInst "default" : string
-//CHECK-NEXT:   $Reg2 @16 [empty]	%15 = ReturnInst %14 : string
+//CHECK-NEXT:   $Reg0 @16 [empty]	%15 = ReturnInst %14 : string
 //CHECK-NEXT: %BB6:
 //CHECK-NEXT:   {{.*}} 	%16 = HBCLoadConstInst 4 : number
 //CHECK-NEXT:   {{.*}} 	%17 = MovInst %2 : string
-//CHECK-NEXT:   $Reg2 @14 [empty]	%18 = CompareBranchInst '===', %16 : number, %0, %BB5, %BB7
+//CHECK-NEXT:   $Reg0 @14 [empty]	%18 = CompareBranchInst '===', %16 : number, %0, %BB5, %BB7
 //CHECK-NEXT: %BB8:
 //CHECK-NEXT:   {{.*}} 	%19 = HBCLoadConstInst 3 : number
-//CHECK-NEXT:   $Reg2 @11 [empty]	%20 = CompareBranchInst '===', %19 : number, %0, %BB4, %BB6
+//CHECK-NEXT:   $Reg3 @11 [empty]	%20 = CompareBranchInst '===', %19 : number, %0, %BB4, %BB6
 //CHECK-NEXT: %BB9:
 //CHECK-NEXT:   {{.*}} 	%21 = HBCLoadConstInst 2 : number
-//CHECK-NEXT:   $Reg2 @9 [empty]	%22 = CompareBranchInst '===', %21 : number, %0, %BB3, %BB8
+//CHECK-NEXT:   $Reg3 @9 [empty]	%22 = CompareBranchInst '===', %21 : number, %0, %BB3, %BB8
 //CHECK-NEXT: %BB10:
 //CHECK-NEXT:   {{.*}} 	%23 = HBCLoadConstInst 1 : number
-//CHECK-NEXT:   $Reg2 @7 [empty]	%24 = CompareBranchInst '===', %23 : number, %0, %BB3, %BB9
+//CHECK-NEXT:   $Reg3 @7 [empty]	%24 = CompareBranchInst '===', %23 : number, %0, %BB3, %BB9
 //CHECK-NEXT: %BB1:
 //CHECK-NEXT:   {{.*}} 	%25 = HBCLoadConstInst 0 : number
-//CHECK-NEXT:   $Reg2 @5 [empty]	%26 = CompareBranchInst '===', %25 : number, %0, %BB2, %BB10
+//CHECK-NEXT:   $Reg3 @5 [empty]	%26 = CompareBranchInst '===', %25 : number, %0, %BB2, %BB10
 //CHECK-NEXT: function_end
 
 function f(x) {
@@ -88,7 +88,7 @@ function f(x) {
 //CHECK-NEXT:  $Reg0 @16 [empty]	%13 = BranchInst %BB1
 //CHECK-NEXT:%BB3:
 //CHECK-NEXT:  {{.*}} 	%14 = MovInst %8 : number
-//CHECK-NEXT:  $Reg7 @14 [empty]	%15 = CompareBranchInst '===', %1 : number, %0, %BB2, %BB1
+//CHECK-NEXT:  $Reg6 @14 [empty]	%15 = CompareBranchInst '===', %1 : number, %0, %BB2, %BB1
 //CHECK-NEXT:%BB4:
 //CHECK-NEXT:  $Reg7 @12 [empty]	%16 = CompareBranchInst '===', %5 : number, %0, %BB2, %BB3
 
@@ -176,7 +176,7 @@ function jump_table(x) {
 //CHECK-NEXT: frame = []
 //CHECK-NEXT: %BB0:
 //CHECK-NEXT:   {{.*}} 	%0 = HBCLoadParamInst 1 : number
-//CHECK-NEXT:   $Reg0 @1 [empty]	%1 = BranchInst %BB1
+//CHECK-NEXT:   $Reg1 @1 [empty]	%1 = BranchInst %BB1
 //CHECK-NEXT: %BB2:
 //CHECK-NEXT:   {{.*}} 	%2 = HBCLoadConstInst undefined : undefined
 //CHECK-NEXT:   $Reg0 @9 [empty]	%3 = ReturnInst %2 : undefined
@@ -194,10 +194,10 @@ function jump_table(x) {
 //CHECK-NEXT:   $Reg0 @7 [empty]	%11 = CompareBranchInst '===', %10 : string, %0, %BB5, %BB2
 //CHECK-NEXT: %BB7:
 //CHECK-NEXT:   {{.*}} 	%12 = HBCLoadConstInst "b" : string
-//CHECK-NEXT:   $Reg0 @5 [empty]	%13 = CompareBranchInst '===', %12 : string, %0, %BB4, %BB6
+//CHECK-NEXT:   $Reg1 @5 [empty]	%13 = CompareBranchInst '===', %12 : string, %0, %BB4, %BB6
 //CHECK-NEXT: %BB1:
 //CHECK-NEXT:   {{.*}} 	%14 = HBCLoadConstInst "a" : string
-//CHECK-NEXT:   $Reg0 @3 [empty]	%15 = CompareBranchInst '===', %14 : string, %0, %BB3, %BB7
+//CHECK-NEXT:   $Reg1 @3 [empty]	%15 = CompareBranchInst '===', %14 : string, %0, %BB3, %BB7
 //CHECK-NEXT: function_end
 
 function string_switch(x) {
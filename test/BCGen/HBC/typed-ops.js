@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -target=HBC -dump-bytecode -pretty-disassemble=false -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+
+// Operands whose types are proven select the type-specialized opcodes.
+
+function concat(a) {
+  var s = "<" + a;
+  return s + ">";
+}
+
+function elem(n) {
+  var arr = [1, 2, 3];
+  arr[5] = 5;
+  return arr[n & 7];
+}
+
+function accessor(n) {
+  var arr = [1, 2];
+  Object.defineProperty(arr, 0, {get: function () { return "getter"; }});
+  return arr[n & 1];
+}
+
+function defined(a, b) {
+  var eq = a === b;
+  if (eq)
+    print("equal");
+  return eq;
+}
+
+print(concat(1));
+for (var i = 0; i < 7; ++i)
+  print(elem(i));
+Array.prototype[4] = "proto";
+print(elem(4));
+print(accessor(0), accessor(1));
+print(defined(1, 1), defined(1, 2));
+
+// CHECK-LABEL:Function<concat>(2 params, 2 registers, 0 symbols):
+// CHECK-NEXT:Offset in debug table: {{.*}}
+// CHECK-NEXT:[@ {{.*}}] LoadConstString 0<Reg8>, 0<UInt16>
+// CHECK-NEXT:[@ {{.*}}] LoadParam 1<Reg8>, 1<UInt8>
+// CHECK-NEXT:[@ {{.*}}] Add 0<Reg8>, 0<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] LoadConstString 1<Reg8>, 1<UInt16>
+// CHECK-NEXT:[@ {{.*}}] AddS 0<Reg8>, 0<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
+
+// CHECK-LABEL:Function<elem>(2 params, 3 registers, 0 symbols):
+// CHECK-NEXT:Offset in debug table: {{.*}}
+// CHECK-NEXT:[@ {{.*}}] NewArrayWithBuffer 0<Reg8>, 3<UInt16>, 3<UInt16>, 0<UInt16>
+// CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 1<Reg8>, 5<UInt8>
+// CHECK-NEXT:[@ {{.*}}] PutByVal 0<Reg8>, 1<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] LoadParam 1<Reg8>, 1<UInt8>
+// CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 2<Reg8>, 7<UInt8>
+// CHECK-NEXT:[@ {{.*}}] BitAnd 1<Reg8>, 1<Reg8>, 2<Reg8>
+// CHECK-NEXT:[@ {{.*}}] GetByValN 0<Reg8>, 0<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
+
+// CHECK-LABEL:Function<accessor>(2 params, 15 registers, 0 symbols):
+// CHECK-NEXT:Offset in debug table: {{.*}}
+// CHECK-NEXT:[@ {{.*}}] NewArrayWithBuffer 0<Reg8>, 2<UInt16>, 2<UInt16>, 13<UInt16>
+// CHECK-NEXT:[@ {{.*}}] GetGlobalObject 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] TryGetById 1<Reg8>, 1<Reg8>, 1<UInt8>, 9<UInt16>
+// CHECK-NEXT:[@ {{.*}}] GetByIdShort 2<Reg8>, 1<Reg8>, 2<UInt8>, 13<UInt8>
+// CHECK-NEXT:[@ {{.*}}] NewObject 3<Reg8>
+// CHECK-NEXT:[@ {{.*}}] CreateEnvironment 4<Reg8>
+// CHECK-NEXT:[@ {{.*}}] CreateClosure 4<Reg8>, 4<Reg8>, 4<UInt16>
+// CHECK-NEXT:[@ {{.*}}] PutNewOwnByIdShort 3<Reg8>, 4<Reg8>, 7<UInt8>
+// CHECK-NEXT:[@ {{.*}}] LoadConstZero 4<Reg8>
+// CHECK-NEXT:[@ {{.*}}] Call4 1<Reg8>, 2<Reg8>, 1<Reg8>, 0<Reg8>, 4<Reg8>, 3<Reg8>
+// CHECK-NEXT:[@ {{.*}}] LoadParam 1<Reg8>, 1<UInt8>
+// CHECK-NEXT:[@ {{.*}}] LoadConstUInt8 2<Reg8>, 1<UInt8>
+// CHECK-NEXT:[@ {{.*}}] BitAnd 1<Reg8>, 1<Reg8>, 2<Reg8>
+// CHECK-NEXT:[@ {{.*}}] GetByValN 0<Reg8>, 0<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
+
+// CHECK-LABEL:Function<defined>(3 params, 12 registers, 0 symbols):
+// CHECK-NEXT:Offset in debug table: {{.*}}
+// CHECK-NEXT:[@ {{.*}}] LoadParam 0<Reg8>, 1<UInt8>
+// CHECK-NEXT:[@ {{.*}}] LoadParam 1<Reg8>, 2<UInt8>
+// CHECK-NEXT:[@ {{.*}}] StrictEq 0<Reg8>, 0<Reg8>, 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] JmpFalseB 22<Addr8>, 0<Reg8>
+// CHECK-NEXT:[@ {{.*}}] GetGlobalObject 1<Reg8>
+// CHECK-NEXT:[@ {{.*}}] TryGetById 1<Reg8>, 1<Reg8>, 1<UInt8>, 16<UInt16>
+// CHECK-NEXT:[@ {{.*}}] LoadConstUndefined 2<Reg8>
+// CHECK-NEXT:[@ {{.*}}] LoadConstString 3<Reg8>, 3<UInt16>
+// CHECK-NEXT:[@ {{.*}}] Call2 1<Reg8>, 1<Reg8>, 2<Reg8>, 3<Reg8>
+// CHECK-NEXT:[@ {{.*}}] Ret 0<Reg8>
+
+// EXEC:<1>
+// EXEC-NEXT:1
+// EXEC-NEXT:2
+// EXEC-NEXT:3
+// EXEC-NEXT:undefined
+// EXEC-NEXT:undefined
+// EXEC-NEXT:5
+// EXEC-NEXT:undefined
+// EXEC-NEXT:proto
+// EXEC-NEXT:getter 2
+// EXEC-NEXT:equal
+// EXEC-NEXT:true false
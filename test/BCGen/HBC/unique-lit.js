@@ -41,14 +41,14 @@ function foo(x) {
 //CHKOPT-NEXT:Offset in debug table: source 0x{{.*}}, lexical 0x{{.*}}
 //CHKOPT-NEXT:    LoadParam         r0, 1
 //CHKOPT-NEXT:    JmpTrue           L1, r0
-//CHKOPT-NEXT:    LoadConstUInt8    r1, 10
-//CHKOPT-NEXT:    GetGlobalObject   r0
-//CHKOPT-NEXT:    PutById           r0, r1, 1, "b"
+//CHKOPT-NEXT:    LoadConstUInt8    r0, 10
+//CHKOPT-NEXT:    GetGlobalObject   r1
+//CHKOPT-NEXT:    PutById           r1, r0, 1, "b"
 //CHKOPT-NEXT:    Jmp               L2
 //CHKOPT-NEXT:L1:
-//CHKOPT-NEXT:    LoadConstUInt8    r1, 10
-//CHKOPT-NEXT:    GetGlobalObject   r0
-//CHKOPT-NEXT:    PutById           r0, r1, 2, "a"
+//CHKOPT-NEXT:    LoadConstUInt8    r0, 10
+//CHKOPT-NEXT:    GetGlobalObject   r1
+//CHKOPT-NEXT:    PutById           r1, r0, 2, "a"
 //CHKOPT-NEXT:L2:
 //CHKOPT-NEXT:    LoadConstUndefined r0
 //CHKOPT-NEXT:    Ret               r0
@@ -12,8 +12,7 @@
 //CHECK-LABEL:function foo(x : number, y : number)
 //CHECK-NEXT:frame = []
 //CHECK-NEXT:%BB0:
-//CHECK-NEXT:  %0 = BinaryOperatorInst '+', 1 : number, 2 : number
-//CHECK-NEXT:  %1 = ReturnInst %0 : number
+//CHECK-NEXT:  %0 = ReturnInst 3 : number
 //CHECK-NEXT:function_end
 
 //CHECK-LABEL:function bar(x, y)
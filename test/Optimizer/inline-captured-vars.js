@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -target=HBC -O -Xinline-threshold=4 -dump-ir %s | %FileCheck --match-full-lines %s
+
+// The captured variable of makeCounter moves into counter.
+function counter(start) {
+  var makeCounter = function(n) {
+    var count = n;
+    return function() {
+      return ++count;
+    };
+  };
+  return makeCounter(start);
+}
+//CHECK-LABEL:function counter(start) : closure
+//CHECK-NEXT:frame = [count]
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = CreateFunctionInst %""() : number
+//CHECK-NEXT:  %1 = StoreFrameInst %start, [count]
+//CHECK-NEXT:  %2 = ReturnInst %0 : closure
+//CHECK-NEXT:function_end
+
+//CHECK-LABEL:function ""() : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = LoadFrameInst [count@counter]
+//CHECK-NEXT:  %1 = AsNumberInst %0
+//CHECK-NEXT:  %2 = BinaryOperatorInst '+', %1 : number, 1 : number
+//CHECK-NEXT:  %3 = StoreFrameInst %2 : number, [count@counter]
+//CHECK-NEXT:  %4 = ReturnInst %2 : number
+//CHECK-NEXT:function_end
+
+// Every iteration needs its own j, so the function is not inlined.
+function inLoop(n) {
+  var result = [];
+  for (var i = 0; i < n; i++) {
+    result.push((function(j) {
+      return function() {
+        return j;
+      };
+    })(i));
+  }
+  return result;
+}
+//CHECK-LABEL:function inLoop(n) : object
+//CHECK:  %5 = CreateFunctionInst %" 1#"() : closure
+//CHECK-NEXT:  %6 = CallInst %5 : closure, undefined : undefined, %3 : number
+//CHECK:function_end
+
+//CHECK-LABEL:function " 1#"(j : number) : closure
+//CHECK-NEXT:frame = [j : number]
+
+// Small functions are inlined at every call site.
+function twoSites(a, b) {
+  function sq(x) {
+    return x * x;
+  }
+  return sq(a) + sq(b);
+}
+//CHECK-LABEL:function twoSites(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '*', %a, %a
+//CHECK-NEXT:  %1 = BinaryOperatorInst '*', %b, %b
+//CHECK-NEXT:  %2 = BinaryOperatorInst '+', %0 : number, %1 : number
+//CHECK-NEXT:  %3 = ReturnInst %2 : number
+//CHECK-NEXT:function_end
+
+// Bigger ones are not.
+function tooBig(a, b) {
+  function poly(x) {
+    return x * x * x + 2 * x * x + 3 * x + 4;
+  }
+  return poly(a) + poly(b);
+}
+//CHECK-LABEL:function tooBig(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = CreateFunctionInst %poly() : number
+//CHECK-NEXT:  %1 = CallInst %0 : closure, undefined : undefined, %a
+//CHECK-NEXT:  %2 = CallInst %0 : closure, undefined : undefined, %b
+//CHECK-NEXT:  %3 = BinaryOperatorInst '+', %1 : number, %2 : number
+//CHECK-NEXT:  %4 = ReturnInst %3 : number
+//CHECK-NEXT:function_end
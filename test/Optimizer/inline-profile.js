@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O -profile-generate=%t.json %s | %FileCheck --match-full-lines --check-prefix=EXEC %s
+// RUN: %hermesc -O -dump-ir %s | %FileCheck --match-full-lines --check-prefix=NOPROFILE %s
+// RUN: %hermesc -O -profile-use=%t.json -dump-ir %s | %FileCheck --match-full-lines %s
+
+// Functions that never ran in the profile are not copied into their call
+// sites.
+
+function test(n) {
+  function rare(x) {
+    return x * 3 + 1;
+  }
+  function often(x) {
+    var y = x * x;
+    if (y > 10) y = y - x;
+    else y = y + x;
+    return y * 2 + (x | 1) + (y & 7);
+  }
+  var s = 0;
+  if (n < 0) s = rare(n) + rare(-n);
+  for (var i = 0; i < n; ++i) s += often(i) + often(s & 3);
+  return s;
+}
+print(test(200));
+
+// EXEC: 5276428
+
+// NOPROFILE-LABEL: function test(n) : string|number
+// NOPROFILE-NOT: CallInst
+// NOPROFILE: function_end
+// NOPROFILE-NOT: function rare
+
+// CHECK-LABEL: function test(n) : string|number
+// CHECK-NOT: often
+// CHECK:   %0 = CreateFunctionInst %rare() : number
+// CHECK-NOT: often
+// CHECK:   %{{.*}} = CallInst %0 : closure, undefined : undefined, %n
+// CHECK:   %{{.*}} = CallInst %0 : closure, undefined : undefined, %{{.*}} : number
+// CHECK-NOT: CallInst
+// CHECK: function_end
+// CHECK-EMPTY:
+// CHECK-NEXT: function rare(x) : number
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -target=HBC -O -dump-lir %s | %FileCheck --match-full-lines %s
+
+// The properties of a fresh object are hoisted, even though the object
+// escapes after the loop.
+function own_props(n, a) {
+  var cfg = {scale: 2, off: a};
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.scale * i + cfg.off;
+  return [total, cfg];
+}
+//CHECK-LABEL:function own_props(n, a) : object
+//CHECK:  %{{.*}} = AllocObjectInst 2 : number, empty
+//CHECK:  %[[SCALE:.*]] = LoadPropertyInst %{{.*}} : object, "scale" : string
+//CHECK-NEXT:  %[[OFF:.*]] = LoadPropertyInst %{{.*}} : object, "off" : string
+//CHECK-NEXT:  %{{.*}} = CompareBranchInst '<', {{.*}}, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NOT:LoadPropertyInst
+//CHECK:%BB2:
+
+// Same with an object from the literal buffer.
+function buffer(n) {
+  var cfg = {scale: 2, off: 3};
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.scale * i + cfg.off;
+  print(cfg);
+  return total;
+}
+//CHECK-LABEL:function buffer(n) : string|number
+//CHECK:  %{{.*}} = HBCAllocObjectFromBufferInst 2 : number, "scale" : string, 2 : number, "off" : string, 3 : number
+//CHECK-NEXT:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "scale" : string
+//CHECK-NEXT:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "off" : string
+//CHECK-NEXT:  %{{.*}} = CompareBranchInst '<', {{.*}}, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NOT:LoadPropertyInst
+//CHECK:%BB2:
+
+// The length of a string is loaded once.
+function string_length(s) {
+  s = "" + s;
+  var h = 0;
+  for (var i = 0; i < s.length; i++)
+    h = (h * 31 + s.charCodeAt(i)) | 0;
+  return h;
+}
+//CHECK-LABEL:function string_length(s) : number
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}} : string, "length" : string
+//CHECK-NEXT:  %{{.*}} = CompareBranchInst '<', {{.*}}, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NOT:"length"
+//CHECK:%BB2:
+
+// The loop writes the property.
+function store_in_loop(n) {
+  var cfg = {scale: 2, off: 3};
+  for (var i = 0; i < n; i++)
+    cfg.scale = cfg.scale * 2 + cfg.off;
+  print(cfg);
+}
+//CHECK-LABEL:function store_in_loop(n) : undefined
+//CHECK:%BB1:
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "scale" : string
+//CHECK:%BB2:
+
+// The object escapes before the loop, so calls may change it.
+function escape_before(n, f) {
+  var cfg = {scale: 2};
+  f(cfg);
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.scale;
+  return total;
+}
+//CHECK-LABEL:function escape_before(n, f) : string|number
+//CHECK:%BB1:
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "scale" : string
+//CHECK:%BB2:
+
+// The object escapes in the loop.
+function escape_in_loop(n) {
+  var cfg = {scale: 2};
+  var total = 0;
+  for (var i = 0; i < n; i++) {
+    total += cfg.scale;
+    print(cfg);
+  }
+  return total;
+}
+//CHECK-LABEL:function escape_in_loop(n) : string|number
+//CHECK:%BB1:
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "scale" : string
+//CHECK:%BB2:
+
+// A missing property is looked up in the prototype, which may have a getter.
+function missing(n) {
+  var cfg = {scale: 2};
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.other;
+  return total;
+}
+//CHECK-LABEL:function missing(n) : string|number
+//CHECK:%BB1:
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}} : object, "other" : string
+//CHECK:%BB2:
+
+// Nothing is known about a parameter.
+function param(n, arr) {
+  var total = 0;
+  for (var i = 0; i < arr.length; i++)
+    total += arr[i];
+  return total;
+}
+//CHECK-LABEL:function param(n, arr) : string|number
+//CHECK:%BB1:
+//CHECK:  %{{.*}} = LoadPropertyInst %{{.*}}, "length" : string
+//CHECK:%BB2:
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -O -dump-ir %s > %t.1.ir
+// RUN: %hermesc -O -dump-ir -threads=4 %s > %t.4.ir
+// RUN: cmp %t.1.ir %t.4.ir
+// RUN: %hermesc -O -dump-lir %s > %t.1.lir
+// RUN: %hermesc -O -dump-lir -threads=4 %s > %t.4.lir
+// RUN: cmp %t.1.lir %t.4.lir
+// RUN: %hermesc -O -dump-ir -threads=4 %s | %FileCheck %s
+
+// Function-local passes running on several functions at once must produce
+// the same IR as when they run on one function at a time.
+
+//CHECK-LABEL: function foo(dim)
+//CHECK-NEXT:frame = []
+//CHECK-NEXT: %BB0:
+//CHECK-NEXT: [[RET0:%.*]] = BinaryOperatorInst '==', %dim, %dim
+//CHECK-NEXT: [[RET1:%.*]] = BinaryOperatorInst '==', %dim, %dim
+//CHECK-NEXT: [[RET2:%.*]] = BinaryOperatorInst '+', [[RET0]] : boolean, [[RET1]] : boolean
+//CHECK-NEXT: [[RET3:%.*]] = BinaryOperatorInst '*', [[RET2]] : number, [[RET2]] : number
+//CHECK-NEXT: [[RET4:%.*]] = ReturnInst [[RET3]] : number
+//CHECK-NEXT:function_end
+function foo(dim) {
+  var a = (dim == dim);
+  var b = (dim == dim);
+  var c = a + b;
+  var d = a + b;
+  return c * d;
+}
+
+//CHECK-LABEL: function bar(x)
+//CHECK-NEXT:frame = []
+//CHECK-NEXT: %BB0:
+//CHECK-NEXT: [[RET0:%.*]] = BinaryOperatorInst '*', %x, 2 : number
+//CHECK-NEXT: [[RET1:%.*]] = ReturnInst [[RET0]] : number
+//CHECK-NEXT:function_end
+function bar(x) {
+  if (true)
+    return x * 2;
+  return 'unreachable';
+}
+
+function baz(n) {
+  var s = 'item';
+  for (var i = 0; i < n; i++) {
+    s += i + ',' + foo(i) + bar(i);
+  }
+  return s;
+}
+
+print(baz(3));
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -target=HBC -O -dump-ir %s | %FileCheck --match-full-lines %s
+
+// The object is replaced by its property values.
+function add(a, b) {
+  var p = {x: a, y: b};
+  return p.x + p.y;
+}
+//CHECK-LABEL:function add(a, b) : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '+', %a, %b
+//CHECK-NEXT:  %1 = ReturnInst %0 : string|number
+//CHECK-NEXT:function_end
+
+// Stores on some paths become phis.
+function store(a, c) {
+  var p = {x: a};
+  if (c)
+    p.x = 1;
+  return p.x;
+}
+//CHECK-LABEL:function store(a, c)
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = CondBranchInst %c, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NEXT:  %1 = BranchInst %BB2
+//CHECK-NEXT:%BB2:
+//CHECK-NEXT:  %2 = PhiInst 1 : number, %BB1, %a, %BB0
+//CHECK-NEXT:  %3 = ReturnInst %2
+//CHECK-NEXT:function_end
+
+// Destructuring reads the properties.
+function destructure(a, b) {
+  var {x, y} = {x: a, y: b};
+  return x * y;
+}
+//CHECK-LABEL:function destructure(a, b) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = BinaryOperatorInst '*', %a, %b
+//CHECK-NEXT:  %1 = ReturnInst %0 : number
+//CHECK-NEXT:function_end
+
+// Reading a missing property consults the prototype.
+function missing(a) {
+  var p = {x: a};
+  return p.toString;
+}
+//CHECK-LABEL:function missing(a)
+//CHECK:  %{{.*}} = AllocObjectLiteralInst "x" : string, %a
+//CHECK:function_end
+
+// Adding a property changes the shape of the object.
+function add_property(a) {
+  var p = {x: a};
+  p.y = 2;
+  return p.x;
+}
+//CHECK-LABEL:function add_property(a)
+//CHECK:  %{{.*}} = AllocObjectLiteralInst "x" : string, %a
+//CHECK:function_end
+
+// The object escapes when it is passed to a call, stored or returned.
+function escape(a, f) {
+  var p = {x: a};
+  f(p);
+  return p.x;
+}
+//CHECK-LABEL:function escape(a, f)
+//CHECK:  %{{.*}} = AllocObjectLiteralInst "x" : string, %a
+//CHECK:function_end
+
+function store_self(a) {
+  var p = {x: a};
+  p.x = p;
+  return p.x;
+}
+//CHECK-LABEL:function store_self(a)
+//CHECK:  %{{.*}} = AllocObjectLiteralInst "x" : string, %a
+//CHECK:function_end
+
+// __proto__ sets the prototype.
+function proto(a) {
+  var p = {__proto__: a};
+  return p.__proto__;
+}
+//CHECK-LABEL:function proto(a)
+//CHECK:  %{{.*}} = AllocObjectInst 1 : number, %a
+//CHECK:function_end
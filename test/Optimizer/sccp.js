@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermesc -target=HBC -O -dump-ir %s | %FileCheck --match-full-lines %s
+// RUN: %hermesc -target=HBC -dump-ir -custom-opt=sccp -custom-opt=simplifycfg %s | %FileCheck --match-full-lines --check-prefix=SCCP %s
+
+// Both sides of the branch produce the same value, so the phi is constant.
+function phi(c) {
+  var x;
+  if (c)
+    x = 2;
+  else
+    x = 2;
+  return x * 3;
+}
+//CHECK-LABEL:function phi(c) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = ReturnInst 6 : number
+//CHECK-NEXT:function_end
+
+// The loop never changes x, because the branch that does can't be taken.
+function loop(n) {
+  var x = 1;
+  for (var i = 0; i < n; i++) {
+    if (x !== 1)
+      x = 2;
+  }
+  return x;
+}
+//CHECK-LABEL:function loop(n) : number
+//CHECK-NOT:  %{{.*}} = PhiInst {{.*}} 2 : number
+//CHECK:  %{{.*}} = ReturnInst 1 : number
+//CHECK-NEXT:function_end
+
+// A switch on a known value only keeps the case that matches.
+function sw() {
+  var mode = "b";
+  var r;
+  switch (mode) {
+    case "a":
+      r = 1;
+      break;
+    case "b":
+      r = 2;
+      break;
+    default:
+      r = 3;
+  }
+  return r;
+}
+//CHECK-LABEL:function sw() : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  %0 = ReturnInst 2 : number
+//CHECK-NEXT:function_end
+
+// A flag passed as a constant to every call of a function removes the code
+// that it guards.
+function outer() {
+  function check(dev, x) {
+    var level = dev ? 2 : 0;
+    if (level > 1) {
+      print("checking", x);
+    }
+    print("value", x, x * 2, x * 3);
+    return x + 1;
+  }
+  return check(false, 1) + check(false, 2);
+}
+//CHECK-LABEL:function check(dev : boolean, x : number) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NOT:checking
+//CHECK:function_end
+
+// Without SSA, the pass only folds branches on literals.
+function lit() {
+  if (1 + 1 === 2)
+    return "yes";
+  return "no";
+}
+//SCCP-LABEL:function lit()
+//SCCP-NEXT:frame = []
+//SCCP-NEXT:%BB0:
+//SCCP-NEXT:  %0 = ReturnInst "yes" : string
+//SCCP-NEXT:function_end
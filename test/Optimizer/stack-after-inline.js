@@ -16,7 +16,7 @@ function f1(num) {
 }
 
 //CHECK-LABEL:function f1(num)
-//CHECK-NEXT:frame = [num]
+//CHECK-NEXT:frame = []
 //CHECK-NEXT:%BB0:
 //CHECK-NEXT:  %0 = ReturnInst %num
 //CHECK-NEXT:function_end
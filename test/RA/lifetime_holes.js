@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -dump-ra -O %s | %FileCheck %s --match-full-lines
+// RUN: %hermes -O %s | %FileCheck %s --check-prefix=EXEC --match-full-lines
+
+// The PHI node of i is not live between the first branch and the increment,
+// so the values computed there use its register.
+function holes(a) {
+  for (var i = 0; ; i++) {
+    if (a.done())
+      break;
+    if (a.skip())
+      continue;
+    a.step();
+  }
+  return i;
+}
+
+//CHECK-LABEL:function holes(a) : number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  $Reg0 @0 [1...19) 	%0 = HBCLoadParamInst 1 : number
+//CHECK-NEXT:  $Reg1 @1 [2...4) 	%1 = HBCLoadConstInst 0 : number
+//CHECK-NEXT:  $Reg2 @2 [3...19) 	%2 = HBCLoadConstInst 1 : number
+//CHECK-NEXT:  $Reg1 @3 [4...6) 	%3 = MovInst %1 : number
+//CHECK-NEXT:  $Reg3 @4 [empty]	%4 = BranchInst %BB1
+//CHECK-NEXT:%BB1:
+//CHECK-NEXT:  $Reg1 @5 [2...9) [17...19) 	%5 = PhiInst %3 : number, %BB0, %12 : number, %BB2
+//CHECK-NEXT:  $Reg3 @6 [7...8) 	%6 = LoadPropertyInst %0, "done" : string
+//CHECK-NEXT:  $Reg3 @7 [8...10) 	%7 = HBCCallNInst %6, %0
+//CHECK-NEXT:  $Reg4 @8 [9...20) 	%8 = MovInst %5 : number
+//CHECK-NEXT:  $Reg1 @9 [empty]	%9 = CondBranchInst %7, %BB3, %BB4
+//CHECK-NEXT:%BB3:
+//CHECK-NEXT:  $Reg0 @19 [empty]	%10 = ReturnInst %8 : number
+//CHECK-NEXT:%BB2:
+//CHECK-NEXT:  $Reg1 @16 [17...18) 	%11 = BinaryOperatorInst '+', %8 : number, %2 : number
+//CHECK-NEXT:  $Reg1 @17 [18...19) 	%12 = MovInst %11 : number
+//CHECK-NEXT:  $Reg0 @18 [empty]	%13 = BranchInst %BB1
+//CHECK-NEXT:%BB4:
+//CHECK-NEXT:  $Reg1 @10 [11...12) 	%14 = LoadPropertyInst %0, "skip" : string
+//CHECK-NEXT:  $Reg1 @11 [12...13) 	%15 = HBCCallNInst %14, %0
+//CHECK-NEXT:  $Reg1 @12 [empty]	%16 = CondBranchInst %15, %BB2, %BB5
+//CHECK-NEXT:%BB5:
+//CHECK-NEXT:  $Reg1 @13 [14...15) 	%17 = LoadPropertyInst %0, "step" : string
+//CHECK-NEXT:  $Reg1 @14 [empty]	%18 = HBCCallNInst %17, %0
+//CHECK-NEXT:  $Reg1 @15 [empty]	%19 = BranchInst %BB2
+//CHECK-NEXT:function_end
+
+// The value loaded from the arguments stack location uses the register of the
+// location, so no copy is needed.
+function stackLoad() {
+  var sum = 0;
+  for (var i in arguments)
+    sum += arguments[i];
+  return sum;
+}
+
+//CHECK-LABEL:function stackLoad() : string|number
+//CHECK-NEXT:frame = []
+//CHECK-NEXT:%BB0:
+//CHECK-NEXT:  $Reg0 @0 [1...13) 	%0 = HBCLoadConstInst 0 : number
+//CHECK-NEXT:  $Reg1 @1 [2...24) 	%1 = AllocStackInst $arguments
+//CHECK-NEXT:  $Reg2 @2 [3...4) 	%2 = HBCLoadConstInst undefined : undefined
+//CHECK-NEXT:  $Reg2 @3 [empty]	%3 = StoreStackInst %2 : undefined, %1
+//CHECK-NEXT:  $Reg2 @4 [5...24) 	%4 = AllocStackInst $?anon_0_iter
+//CHECK-NEXT:  $Reg3 @5 [6...24) 	%5 = AllocStackInst $?anon_1_base
+//CHECK-NEXT:  $Reg4 @6 [7...24) 	%6 = AllocStackInst $?anon_2_idx
+//CHECK-NEXT:  $Reg5 @7 [8...24) 	%7 = AllocStackInst $?anon_3_size
+//CHECK-NEXT:  $Reg6 @8 [empty]	%8 = HBCReifyArgumentsInst %1
+//CHECK-NEXT:  $Reg1 @9 [10...11) 	%9 = LoadStackInst %1
+//CHECK-NEXT:  $Reg6 @10 [empty]	%10 = StoreStackInst %9, %5
+//CHECK-NEXT:  $Reg6 @11 [12...24) 	%11 = AllocStackInst $?anon_4_prop
+//CHECK-NEXT:  $Reg0 @12 [13...16) 	%12 = MovInst %0 : number
+//CHECK-NEXT:  $Reg7 @13 [14...25) 	%13 = MovInst %12 : number
+//CHECK-NEXT:  $Reg8 @14 [empty]	%14 = GetPNamesInst %4, %5, %6, %7, %BB1, %BB2
+//CHECK-NEXT:%BB1:
+//CHECK-NEXT:  $Reg7 @24 [14...26) 	%15 = PhiInst %13 : number, %BB0, %20 : string|number, %BB2
+//CHECK-NEXT:  $Reg7 @25 [14...27) 	%16 = MovInst %15 : string|number
+//CHECK-NEXT:  $Reg0 @26 [empty]	%17 = ReturnInst %16 : string|number
+//CHECK-NEXT:%BB2:
+//CHECK-NEXT:  $Reg0 @15 [1...17) [23...24) 	%18 = PhiInst %12 : number, %BB0, %25 : string|number, %BB3
+//CHECK-NEXT:  $Reg0 @16 [1...24) 	%19 = MovInst %18 : string|number
+//CHECK-NEXT:  $Reg7 @17 [18...25) 	%20 = MovInst %19 : string|number
+//CHECK-NEXT:  $Reg8 @18 [empty]	%21 = GetNextPNameInst %11, %5, %6, %7, %4, %BB1, %BB3
+//CHECK-NEXT:%BB3:
+//CHECK-NEXT:  $Reg6 @19 [20...21) 	%22 = LoadStackInst %11
+//CHECK-NEXT:  $Reg8 @20 [21...22) 	%23 = HBCGetArgumentsPropByValInst %22, %1
+//CHECK-NEXT:  $Reg0 @21 [22...23) 	%24 = BinaryOperatorInst '+', %19 : string|number, %23
+//CHECK-NEXT:  $Reg0 @22 [23...24) 	%25 = MovInst %24 : string|number
+//CHECK-NEXT:  $Reg0 @23 [empty]	%26 = BranchInst %BB2
+//CHECK-NEXT:function_end
+
+var n = 0;
+print(holes({
+  done: function() { return n === 5; },
+  skip: function() { return n++ % 2; },
+  step: function() {},
+}));
+//EXEC: 5
+print(stackLoad(1, 2, 3));
+//EXEC-NEXT: 6
@@ -14,8 +14,8 @@ function b(d=([[[[{z:[{}]}]]]]=arguments)) {}
 //CHKRA-LABEL:%BB1:
 //CHKRA-NEXT:  {{.*}}  %17 = ReturnInst %1 : undefined
 //CHKRA-LABEL:%BB68:
-//CHKRA-NEXT:  $Reg16 @148 [empty]   %208 = IteratorCloseInst %5, false : boolean
-//CHKRA-NEXT:  $Reg16 @149 [empty]   %209 = BranchInst %BB1
+//CHKRA-NEXT:  $Reg15 @148 [empty]   %208 = IteratorCloseInst %5, false : boolean
+//CHKRA-NEXT:  $Reg15 @149 [empty]   %209 = BranchInst %BB1
 //CHKRA-LABEL:%BB7:
-//CHKRA-NEXT:  $Reg2 @209 [empty]    %210 = IteratorCloseInst %5, true : boolean
-//CHKRA-NEXT:  $Reg2 @210 [empty]    %211 = BranchInst %BB6
+//CHKRA-NEXT:  $Reg0 @209 [empty]    %210 = IteratorCloseInst %5, true : boolean
+//CHKRA-NEXT:  $Reg0 @210 [empty]    %211 = BranchInst %BB6
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+// Inlined closures behave like the originals.
+
+function counter(start) {
+  var makeCounter = function(n) {
+    var count = n;
+    return function() {
+      return ++count;
+    };
+  };
+  return makeCounter(start);
+}
+var c = counter(10);
+print(c(), c(), counter(0)());
+
+function inLoop(n) {
+  var result = [];
+  for (var i = 0; i < n; i++) {
+    result.push((function(j) {
+      return function() {
+        return j;
+      };
+    })(i));
+  }
+  return result;
+}
+print(inLoop(3).map(function(f) { return f(); }).join());
+
+function nested(x) {
+  return (function(y) {
+    var z = x + y;
+    return (function(w) {
+      var v = z * w;
+      return function() {
+        return [x, y, z, w, v++].join();
+      };
+    })(2);
+  })(1);
+}
+var n = nested(5);
+print(n(), n());
+
+function twoSites(a, b) {
+  function sq(x) {
+    return x * x;
+  }
+  return sq(a) + sq(b);
+}
+print(twoSites(3, 4));
+
+function withThis() {
+  function getThis() {
+    'use strict';
+    return typeof this;
+  }
+  return getThis() + getThis.call(1);
+}
+print(withThis());
+
+//CHECK: 11 12 1
+//CHECK-NEXT: 0,1,2
+//CHECK-NEXT: 5,1,6,2,12 5,1,6,2,13
+//CHECK-NEXT: 25
+//CHECK-NEXT: undefinednumber
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+function scaled(n, off) {
+  var cfg = {scale: 2, off: off};
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.scale * i + cfg.off;
+  return [total, cfg.scale];
+}
+print(scaled(4, 1), scaled(0, 1));
+//CHECK:16,2 0,2
+
+// The getter sees every load in the loop.
+var calls = 0;
+Object.defineProperty(Object.prototype, "other", {
+  get: function() {
+    ++calls;
+    return 1;
+  },
+  configurable: true,
+});
+function missing(n) {
+  var cfg = {scale: 2};
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.other;
+  return total;
+}
+print(missing(5), calls);
+//CHECK-NEXT:5 5
+
+// A store through a callee is seen by the loop.
+function escape_before(n, f) {
+  var cfg = {scale: 2};
+  f(cfg);
+  var total = 0;
+  for (var i = 0; i < n; i++)
+    total += cfg.scale;
+  return total;
+}
+print(escape_before(3, function(o) {
+  var v = 0;
+  Object.defineProperty(o, "scale", {
+    get: function() {
+      return ++v;
+    },
+  });
+}));
+//CHECK-NEXT:6
+
+function hash(s) {
+  s = "" + s;
+  var h = 0;
+  for (var i = 0; i < s.length; i++)
+    h = (h * 31 + s.charCodeAt(i)) | 0;
+  return h;
+}
+print(hash("hello"), hash(""));
+//CHECK-NEXT:99162322 0
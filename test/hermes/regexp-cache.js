@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xregexp-jit -O %s | %FileCheck --match-full-lines %s
+"use strict";
+
+// RegExps constructed from the same pattern and flags share compiled
+// bytecode, but not their state.
+
+print('regexp-cache');
+// CHECK-LABEL: regexp-cache
+
+function stats() {
+  var s = HermesInternal.getInstrumentedStats();
+  return [s.js_regExpCacheHits, s.js_regExpCacheMisses];
+}
+
+var before = stats();
+var rs = [];
+for (var i = 0; i < 5; i++) {
+  rs.push(new RegExp('b(' + 'a' + ')', 'g'));
+}
+var after = stats();
+print(after[0] - before[0], after[1] - before[1]);
+// CHECK-NEXT: 4 1
+
+rs[0].exec('xbaba');
+print(rs[0].lastIndex, rs[1].lastIndex);
+// CHECK-NEXT: 3 0
+print(rs[1].exec('bA'), new RegExp('b(a)', 'gi').exec('bA'));
+// CHECK-NEXT: null bA,A
+print(new RegExp('b(a)').global, new RegExp('b(a)', 'g').global);
+// CHECK-NEXT: false true
+
+for (var i = 0; i < 2; i++) {
+  try {
+    new RegExp('(', 'g');
+  } catch (e) {
+    print(e.name, e.message);
+  }
+}
+// CHECK-NEXT: SyntaxError Invalid RegExp: Parenthesized expression not closed
+// CHECK-NEXT: SyntaxError Invalid RegExp: Parenthesized expression not closed
+try {
+  new RegExp('b(a)', 'gg');
+} catch (e) {
+  print(e.name, e.message);
+}
+// CHECK-NEXT: SyntaxError Invalid RegExp: Invalid flags
+
+// Many distinct patterns evict older entries.
+var evictionsBefore = HermesInternal.getInstrumentedStats()
+  .js_regExpCacheEvictions;
+for (var i = 0; i < 1000; i++) {
+  new RegExp('x' + i);
+}
+print(
+  HermesInternal.getInstrumentedStats().js_regExpCacheEvictions >
+    evictionsBefore,
+);
+// CHECK-NEXT: true
+print(new RegExp('x5').test('ax5'), new RegExp('x5').source);
+// CHECK-NEXT: true x5
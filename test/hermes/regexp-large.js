@@ -6,6 +6,7 @@
  */
 
 // RUN: LC_ALL=en_US.UTF-8 %hermes %s | %FileCheck --match-full-lines %s
+// RUN: LC_ALL=en_US.UTF-8 %hermes -Xregexp-jit %s | %FileCheck --match-full-lines %s
 
 // Verify that an extremely long (but flat) regexp can be parsed and match.
 var longString = "x";
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xregexp-jit %s | %FileCheck --match-full-lines %s
+
+// These patterns take exponential time with backtracking alone. They contain
+// no backreferences or lookarounds, so the search switches to the
+// non-backtracking executor.
+
+print('regexp-linear');
+// CHECK-LABEL: regexp-linear
+
+var as = 'a'.repeat(5000);
+print(/(?:a|aa)*c/.test(as));
+// CHECK-NEXT: false
+print(/^(a+)+$/.test(as + 'b'));
+// CHECK-NEXT: false
+var m = /(a|aa)*c/.exec(as + 'c');
+print(m.index, m[0].length, m[1]);
+// CHECK-NEXT: 0 5001 a
+print(/(x+x+)+y/.exec('x'.repeat(100) + 'xy')[0].length);
+// CHECK-NEXT: 102
+print(('ab'.repeat(2000) + '!').replace(/(?:a|b|ab)*c|!/g, '?').length);
+// CHECK-NEXT: 4001
@@ -7,6 +7,7 @@
 
 // RUN: %hermes -O -target=HBC %s | %FileCheck --match-full-lines %s
 // RUN: %hermes -O -target=HBC -emit-binary -out %t.hbc %s && %hermes %t.hbc | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xregexp-jit -O -target=HBC %s | %FileCheck --match-full-lines %s
 // Make sure RegExp literals.
 "use strict";
 
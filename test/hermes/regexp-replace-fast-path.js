@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -Xregexp-jit -O %s | %FileCheck --match-full-lines %s
+"use strict";
+
+// Replace and split with unmodified RegExps take a fast path which must be
+// indistinguishable from the generic algorithm, including when the RegExp or
+// its prototype has been modified.
+function show(x) { print(JSON.stringify(x)); }
+var s = 'John Smith, Jane Doe; 2020-01-05 and 1999-12-31';
+show(s.replace(/(\w+) (\w+)/g, '$2 $1'));
+// CHECK: "Smith John, Doe Jane; 2020-01-and 05 1999-12-31"
+show(s.replace(/(\d+)-(\d+)-(\d+)/, '$3/$2/$1'));
+// CHECK-NEXT: "John Smith, Jane Doe; 05/01/2020 and 1999-12-31"
+show(s.replace(/(\d+)-(\d+)-(\d+)/g, '[$&] [$`] [$\'] $$ $0 $4 $ $x $'));
+// CHECK-NEXT: "John Smith, Jane Doe; [2020-01-05] [John Smith, Jane Doe; ] [ and 1999-12-31] $ $0 $4 $ $x $ and [1999-12-31] [John Smith, Jane Doe; 2020-01-05 and ] [] $ $0 $4 $ $x $"
+show('abcdefghijk'.replace(/(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(k)/, '$11-$10-$1-$01-$011-$00-$12'));
+// CHECK-NEXT: "k-j-a-a-a1-$00-a2"
+show('abc'.replace(/(x)?b/, '[$1]'));
+// CHECK-NEXT: "a[]c"
+show('abc'.replace(/x*/g, '-'));
+// CHECK-NEXT: "-a-b-c-"
+show('abc'.replace(/(?:)/g, '-'));
+// CHECK-NEXT: "-a-b-c-"
+show(''.replace(/x*/g, '-'));
+// CHECK-NEXT: "-"
+show(''.replace(/x/g, '-'));
+// CHECK-NEXT: ""
+show('😀😀'.replace(/(?:)/gu, '-'));
+// CHECK-NEXT: "-😀-😀-"
+show('😀😀'.replace(/(?:)/g, '-'));
+// CHECK-NEXT: "-�-�-�-�-"
+show('héllo wörld'.replace(/o/g, 'ő'));
+// CHECK-NEXT: "héllő wörld"
+show('hello'.replace(/l/g, '☃'));
+// CHECK-NEXT: "he☃☃o"
+show('h☃llo'.replace(/l/g, 'L'));
+// CHECK-NEXT: "h☃LLo"
+var re = /a/g; re.lastIndex = 3; show(['aaa'.replace(re, 'b'), re.lastIndex]);
+// CHECK-NEXT: ["bbb",0]
+var re = /a/y; re.lastIndex = 1; show(['aaa'.replace(re, 'b'), re.lastIndex]);
+// CHECK-NEXT: ["aba",2]
+show(['aaa'.replace(re, 'b'), re.lastIndex]);
+// CHECK-NEXT: ["aab",3]
+re.lastIndex = 5; show(['aaa'.replace(re, 'b'), re.lastIndex]);
+// CHECK-NEXT: ["aaa",0]
+var re = /a/y; re.lastIndex = 1; show(['bab'.replace(re, 'c'), re.lastIndex]);
+// CHECK-NEXT: ["bcb",2]
+var re = /a/gy; re.lastIndex = 1; show(['aaba'.replace(re, 'c'), re.lastIndex]);
+// CHECK-NEXT: ["ccba",0]
+var re = /a/; re.lastIndex = 7; show(['aaa'.replace(re, 'b'), re.lastIndex]);
+// CHECK-NEXT: ["baa",7]
+var re = /a/; var log = [];
+re.lastIndex = {valueOf: function() { log.push('valueOf'); return 0; }};
+show(['aaa'.replace(re, 'b'), log]);
+// CHECK-NEXT: ["baa",["valueOf"]]
+var re = /a/g;
+re.exec = function(str) { log.push('exec'); return RegExp.prototype.exec.call(this, str); };
+show(['aXa'.replace(re, 'b'), log]);
+// CHECK-NEXT: ["bXb",["valueOf","exec","exec","exec"]]
+var re = /a/g;
+Object.defineProperty(re, 'global', {get: function() { log.push('global'); return false; }});
+show(['aXa'.replace(re, 'b'), log]);
+// CHECK-NEXT: ["bXa",["valueOf","exec","exec","exec","global"]]
+var re = /a/g; Object.freeze(re);
+try { 'aaa'.replace(re, 'b'); } catch (e) { show(e.name); }
+// CHECK-NEXT: "TypeError"
+var re = /a/y; Object.defineProperty(re, 'lastIndex', {writable: false});
+try { 'aaa'.replace(re, 'b'); } catch (e) { show(e.name); }
+// CHECK-NEXT: "TypeError"
+var re = /b/; Object.defineProperty(re, 'lastIndex', {writable: false});
+show('abc'.replace(re, 'x'));
+// CHECK-NEXT: "axc"
+var old = RegExp.prototype.exec;
+RegExp.prototype.exec = function(s) { log.push('proto exec'); return old.call(this, s); };
+show(['abc'.replace(/b/, 'x'), log]);
+// CHECK-NEXT: ["axc",["valueOf","exec","exec","exec","global","proto exec"]]
+RegExp.prototype.exec = old;
+show('aaa'.replace(/a/g, function(m) { return m + '!'; }));
+// CHECK-NEXT: "a!a!a!"
+'xay'.replace(/a/, 'b'); show([RegExp.lastMatch, RegExp.leftContext, RegExp.rightContext]);
+// CHECK-NEXT: ["a","x","y"]
+'x1y2z'.replace(/(\d)/g, '#'); show([RegExp.lastMatch, RegExp.$1]);
+// CHECK-NEXT: ["2","2"]
+show('aaaa'.replace(/a/gi, 'AB'));
+// CHECK-NEXT: "ABABABAB"
+
+// split
+show('a1b22c333d'.split(/\d+/));
+// CHECK-NEXT: ["a","b","c","d"]
+show('a1b22c333d'.split(/(\d)+/));
+// CHECK-NEXT: ["a","1","b","2","c","3","d"]
+show('a1b22c333d'.split(/\d+/, 2));
+// CHECK-NEXT: ["a","b"]
+show('abc'.split(/(?:)/));
+// CHECK-NEXT: ["a","b","c"]
+show(''.split(/x/));
+// CHECK-NEXT: [""]
+show(''.split(/(?:)/));
+// CHECK-NEXT: []
+show('😀😀'.split(/(?:)/u));
+// CHECK-NEXT: ["😀","😀"]
+show('a,b,,c'.split(/,/y));
+// CHECK-NEXT: ["a","b","","c"]
+var re = /,/; re.lastIndex = 3; show(['a,b,c'.split(re), re.lastIndex]);
+// CHECK-NEXT: {{\[\[}}"a","b","c"],3]
+var re = /,/;
+Object.defineProperty(re, 'flags', {get: function() { log.push('flags'); return 'i'; }});
+show(['a,b'.split(re), log]);
+// CHECK-NEXT: {{\[\[}}"a","b"],["valueOf","exec","exec","exec","global","proto exec","flags"]]
+var desc = Object.getOwnPropertyDescriptor(RegExp.prototype, 'ignoreCase');
+Object.defineProperty(RegExp.prototype, 'ignoreCase', {get: function() { log.push('ignoreCase'); return true; }, configurable: true});
+show(['aXbxc'.split(/x/), log]);
+// CHECK-NEXT: {{\[\[}}"a","b","c"],["valueOf","exec","exec","exec","global","proto exec","flags","ignoreCase"]]
+Object.defineProperty(RegExp.prototype, 'ignoreCase', desc);
+Object.defineProperty(RegExp.prototype, 'global', Object.getOwnPropertyDescriptor(RegExp.prototype, 'sticky'));
+show(['aXbxc'.split(/x/), '..'.replace(/./g, '-')]);
+// CHECK-NEXT: {{\[\[}}"aXb","c"],"-."]
+
+// String replace with string pattern
+show('abcabc'.replace('b', 'X'));
+// CHECK-NEXT: "aXcabc"
+show('abcabc'.replace('b', '[$&$`$\'$$$1]'));
+// CHECK-NEXT: "a[bacabc$$1]cabc"
+show('abc'.replace('', '-'));
+// CHECK-NEXT: "-abc"
+show(''.replace('', '-'));
+// CHECK-NEXT: "-"
+show('h☃llo'.replace('l', 'L'));
+// CHECK-NEXT: "h☃Llo"
+show('hello'.replace('l', '☃'));
+// CHECK-NEXT: "he☃lo"
+show('hello'.replace('z', '☃'));
+// CHECK-NEXT: "hello"
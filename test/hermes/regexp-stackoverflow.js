@@ -6,6 +6,7 @@
  */
 
 // RUN: LC_ALL=en_US.UTF-8 %hermes %s | %FileCheck --match-full-lines %s
+// RUN: LC_ALL=en_US.UTF-8 %hermes -Xregexp-jit %s | %FileCheck --match-full-lines %s
 
 try {
   var r = /(?:(?:\\2|\\3*)*|(?=\\B)+|.(?:$)){68719476736}/g;
@@ -20,7 +20,7 @@ print(/a\x01\u017f/i);
 
 print(/^a\u017f\x01$/);
 // CHECK:       1: /^a\u017f\x01$/
-// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 7
+// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 7 prefix: 'a' 0x17f 0x01
 // CHECK-NEXT:    0000  LeftAnchor
 // CHECK-NEXT:    0001  MatchChar8: 'a'
 // CHECK-NEXT:    0003  MatchChar16: 0x17f
@@ -30,7 +30,7 @@ print(/^a\u017f\x01$/);
 
 print(/^a|b/);
 // CHECK:       2: /^a|b/
-// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 4 firstChars: 'a' 'b'
 // CHECK-NEXT:    0000  Alternation: Target 0x0f, constraints 6,4
 // CHECK-NEXT:    0007  LeftAnchor
 // CHECK-NEXT:    0008  MatchChar8: 'a'
@@ -49,7 +49,7 @@ print(/[a-z][^A-Z0-9_\d][\s][abc]/);
 
 print(/a(b(c)(d))e\1\2/);
 // CHECK:       4: /a(b(c)(d))e\1\2/
-// CHECK-NEXT:    Header: marked: 3 loops: 0 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 3 loops: 0 flags: 0 constraints: 4 firstChars: 'a'
 // CHECK-NEXT:    0000  MatchChar8: 'a'
 // CHECK-NEXT:    0002  BeginMarkedSubexpression: 0
 // CHECK-NEXT:    0005  MatchChar8: 'b'
@@ -85,7 +85,7 @@ print(/abc(?=^)(?!def)/i);
 
 print(/ab*c+d{3,5}/);
 // CHECK:        7: /ab*c+d{3,5}/
-// CHECK-NEXT:    Header: marked: 0 loops: 3 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 0 loops: 3 flags: 0 constraints: 4 firstChars: 'a'
 // CHECK-NEXT:    0000  MatchChar8: 'a'
 // CHECK-NEXT:    0002  Width1Loop: 0 greedy {0, 4294967295}
 // CHECK-NEXT:    0014  MatchChar8: 'b'
@@ -97,7 +97,7 @@ print(/ab*c+d{3,5}/);
 
 print(/a((b+){3})*/);
 // CHECK:        8: /a((b+){3})*/
-// CHECK-NEXT:    Header: marked: 2 loops: 3 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 2 loops: 3 flags: 0 constraints: 4 firstChars: 'a'
 // CHECK-NEXT:     0000  MatchChar8: 'a'
 // CHECK-NEXT:     0002  BeginLoop: 2 greedy {0, 4294967295} (constraints: 4)
 // CHECK-NEXT:     0019  BeginMarkedSubexpression: 0
@@ -113,7 +113,7 @@ print(/a((b+){3})*/);
 
 print(/(^b)+(c)*?/);
 // CHECK:        9: /(^b)+(c)*?/
-// CHECK-NEXT:    Header: marked: 2 loops: 2 flags: 0 constraints: 6
+// CHECK-NEXT:    Header: marked: 2 loops: 2 flags: 0 constraints: 6 firstChars: 'b'
 // CHECK-NEXT:     0000  BeginLoop: 0 greedy {1, 4294967295} (constraints: 6)
 // CHECK-NEXT:     0017  BeginMarkedSubexpression: 0
 // CHECK-NEXT:     001a  LeftAnchor
@@ -142,7 +142,7 @@ print(/a*/);
 
 print(/a+/);
 // CHECK:        12: /a+/
-// CHECK-NEXT:    Header: marked: 0 loops: 1 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 0 loops: 1 flags: 0 constraints: 4 firstChars: 'a'
 // CHECK-NEXT:    0000  Width1Loop: 0 greedy {1, 4294967295}
 // CHECK-NEXT:    0012  MatchChar8: 'a'
 // CHECK-NEXT:    0014  Goal
@@ -215,7 +215,7 @@ print(/(a)(?<!(.))/i);
 // There are 255 'a's here.
 print(/aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaoverflow/);
 // CHECK:        20: /{{a{255}overflow}}/
-// CHECK-NEXT:   Header: marked: 0 loops: 0 flags: 0 constraints: 4
+// CHECK-NEXT:   Header: marked: 0 loops: 0 flags: 0 constraints: 4 prefix: 'a' 'a' 'a' 'a' 'a' 'a' 'a' 'a'
 // CHECK-NEXT:   0000  MatchNChar8: {{'a{255}'}}
 // CHECK-NEXT:   0101  MatchNChar8: 'overflow'
 // CHECK-NEXT:   010b  Goal
@@ -253,7 +253,7 @@ print(/./us);
 
 print(/a|b|c|d|e|f/);
 // CHECK:       26: /a|b|c|d|e|f/
-// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 0 loops: 0 flags: 0 constraints: 4 firstChars: 'a' 'b' 'c' 'd' 'e' 'f'
 // CHECK-NEXT:    0000  Alternation: Target 0x0e, constraints 4,4
 // CHECK-NEXT:    0007  MatchChar8: 'a'
 // CHECK-NEXT:    0009  Jump32: 0x48
@@ -274,7 +274,7 @@ print(/a|b|c|d|e|f/);
 
 print(/(abc|def)/);
 // CHECK:       27: /(abc|def)/
-// CHECK-NEXT:    Header: marked: 1 loops: 0 flags: 0 constraints: 4
+// CHECK-NEXT:    Header: marked: 1 loops: 0 flags: 0 constraints: 4 firstChars: 'a' 'd'
 // CHECK-NEXT:    0000  BeginMarkedSubexpression: 0
 // CHECK-NEXT:    0003  Alternation: Target 0x14, constraints 4,4
 // CHECK-NEXT:    000a  MatchNChar8: 'abc'
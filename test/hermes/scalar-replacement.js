@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+function walk(n) {
+  var total = 0;
+  for (var i = 0; i < n; i++) {
+    var p = {x: i, y: i + 1, x: i * 2};
+    if (i & 1)
+      p.y = -p.y;
+    var {x, y} = p;
+    total += x + y;
+  }
+  return total;
+}
+print(walk(10));
+//CHECK:85
+
+function missing() {
+  var p = {x: 1};
+  return typeof p.toString + " " + p.y;
+}
+print(missing());
+//CHECK-NEXT:function undefined
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -O %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O0 %s | %FileCheck --match-full-lines %s
+
+function loop(n) {
+  var x = 1, y = 0;
+  for (var i = 0; i < n; i++) {
+    if (x !== 1)
+      x = 2;
+    if (i === 3)
+      y = 5;
+  }
+  return x + ":" + y;
+}
+print(loop(10));
+//CHECK:1:5
+
+function sw(v) {
+  var r = 0;
+  switch (v) {
+    case 0:
+    case "0":
+      r = 1;
+      break;
+    case NaN:
+      r = 2;
+      break;
+    default:
+      r = 3;
+  }
+  return r;
+}
+print(sw(0), sw("0"), sw(NaN), sw(-0));
+//CHECK-NEXT:1 1 3 1
+
+function known() {
+  var results = [];
+  for (var v of [0, "0", NaN, -0]) {
+    var r;
+    switch (typeof v === "string" ? "s" : "n") {
+      case "s":
+        r = "string";
+        break;
+      default:
+        r = "number";
+    }
+    results.push(r);
+  }
+  return results.join();
+}
+print(known());
+//CHECK-NEXT:number,string,number,number
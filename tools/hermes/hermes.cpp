@@ -107,6 +107,7 @@ static int executeHBCBytecodeFromCL(
           .withES6Promise(cl::ES6Promise)
           .withES6Proxy(cl::ES6Proxy)
           .withIntl(cl::Intl)
+          .withEnableRegExpJIT(cl::RegExpJIT)
           .withEnableSampleProfiling(cl::SampleProfiling)
           .withRandomizeMemoryLayout(cl::RandomizeMemoryLayout)
           .withTrackIO(cl::TrackBytecodeIO)
@@ -128,6 +129,7 @@ static int executeHBCBytecodeFromCL(
   options.forceGCBeforeStats = cl::GCBeforeStats;
   options.stabilizeInstructionCount = cl::StableInstructionCount;
   options.sampleProfiling = cl::SampleProfiling;
+  options.profileGenerateFile = cl::ProfileGenerate;
 #ifdef HERMESVM_SERIALIZE
   options.SerializeAfterInitFile = cl::SerializeAfterInitFile;
   options.DeserializeFile = cl::DeserializeFile;
@@ -171,6 +173,7 @@ static vm::RuntimeConfig getReplRuntimeConfig() {
       .withES6Promise(cl::ES6Promise)
       .withES6Proxy(cl::ES6Proxy)
       .withIntl(cl::Intl)
+      .withEnableRegExpJIT(cl::RegExpJIT)
       .withEnableHermesInternal(cl::EnableHermesInternal)
       .withEnableHermesInternalTestMethods(cl::EnableHermesInternalTestMethods)
       .withAllowFunctionToStringWithRuntimeSource(cl::AllowFunctionToString)
@@ -204,6 +207,12 @@ int main(int argc, char **argv) {
     cl::EmitAsyncBreakCheck = true;
   }
 
+  // Count the executions of basic blocks as well as functions when collecting
+  // a profile.
+  if (!cl::ProfileGenerate.empty()) {
+    cl::BasicBlockProfiling = true;
+  }
+
   // Make sure any allocated alt signal stack is not considered a leak
   // by ASAN.
   oscompat::SigAltStackLeakSuppressor sigAltLeakSuppressor;
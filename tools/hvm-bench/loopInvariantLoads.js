@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Loops that read the same properties on every iteration: the length of a
+// string, and the settings of a local configuration object.
+
+function hash(s) {
+    s = "" + s;
+    var h = 0;
+    for (var i = 0; i < s.length; i++) {
+        h = (h * 31 + s.charCodeAt(i)) | 0;
+    }
+    return h;
+}
+
+function scale(n, offset) {
+    var cfg = {scale: 3, offset: offset, limit: 1000};
+    var total = 0;
+    for (var i = 0; i < n; i++) {
+        var v = cfg.scale * i + cfg.offset;
+        total += v > cfg.limit ? cfg.limit : v;
+    }
+    return [total, cfg];
+}
+
+function run(numTimes) {
+    var text = "The quick brown fox jumps over the lazy dog. ";
+    var h = 0;
+    var total = 0;
+    for (var i = 0; i < numTimes; i++) {
+        h ^= hash(text);
+        total += scale(1000, i)[0];
+    }
+    return h + total;
+}
+
+print(run(20000));
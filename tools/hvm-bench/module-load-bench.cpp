@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+//===----------------------------------------------------------------------===//
+/// \file
+/// This benchmark measures how long it takes to load a bytecode module, as a
+/// function of the number of identifiers in its string table.
+///
+/// For every requested size it generates a bundle with that many distinct
+/// identifiers, all of them in a function that is never called, compiles and
+/// serializes it, and then times the creation of a RuntimeModule from the
+/// serialized buffer in a fresh Runtime. Executing the module is not part of
+/// the measurement.
+///
+/// Persistent modules (the default, as in the hermes and JSI drivers) register
+/// their identifiers when they are first used, so their load time should not
+/// grow with the number of identifiers. Pass -persistent=false to measure the
+/// eager import done for other modules.
+//===----------------------------------------------------------------------===//
+#include "hermes/BCGen/HBC/BytecodeProviderFromSrc.h"
+#include "hermes/BCGen/HBC/BytecodeStream.h"
+#include "hermes/VM/Domain.h"
+#include "hermes/VM/Runtime.h"
+#include "hermes/VM/RuntimeModule.h"
+
+#include "llvh/Support/CommandLine.h"
+#include "llvh/Support/Format.h"
+#include "llvh/Support/ManagedStatic.h"
+#include "llvh/Support/PrettyStackTrace.h"
+#include "llvh/Support/SHA1.h"
+#include "llvh/Support/Signals.h"
+#include "llvh/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace hermes;
+using namespace hermes::vm;
+using namespace hermes::hbc;
+
+namespace {
+
+/// \return the serialized bytecode of a bundle with \p identifierCount
+/// distinct identifiers.
+std::vector<uint8_t> generateBundle(unsigned identifierCount) {
+  std::string source = "function unused(o) {\n";
+  for (unsigned i = 0; i < identifierCount; ++i)
+    source += "  o.ident" + std::to_string(i) + " = 0;\n";
+  source += "}\n";
+
+  CompileFlags flags;
+  flags.optimize = true;
+  auto res = BCProviderFromSrc::createBCProviderFromSrc(
+      std::make_unique<Buffer>(
+          reinterpret_cast<const uint8_t *>(source.c_str()), source.size()),
+      "bundle.js",
+      flags);
+  if (!res.first) {
+    llvh::errs() << "Failed to compile bundle: " << res.second << "\n";
+    exit(1);
+  }
+
+  llvh::SmallVector<char, 0> bytecode;
+  llvh::raw_svector_ostream OS(bytecode);
+  BytecodeSerializer BS{OS};
+  BS.serialize(*res.first->getBytecodeModule(), llvh::SHA1::hash({}));
+  return std::vector<uint8_t>(bytecode.begin(), bytecode.end());
+}
+
+/// \return the time in microseconds it takes to create a RuntimeModule from
+/// \p bytecode in a fresh Runtime.
+double loadModule(const std::vector<uint8_t> &bytecode, bool persistent) {
+  auto runtime = Runtime::create(RuntimeConfig::Builder().build());
+  GCScope scope(runtime.get());
+  std::shared_ptr<BCProvider> provider =
+      BCProviderFromBuffer::createBCProviderFromBuffer(
+          std::make_unique<Buffer>(bytecode.data(), bytecode.size()))
+          .first;
+  auto domain = runtime->makeHandle(Domain::create(runtime.get()));
+  RuntimeModuleFlags flags;
+  flags.persistent = persistent;
+
+  auto start = std::chrono::steady_clock::now();
+  auto res = RuntimeModule::create(
+      runtime.get(), domain, 0, std::move(provider), flags);
+  auto end = std::chrono::steady_clock::now();
+  if (res == ExecutionStatus::EXCEPTION) {
+    llvh::errs() << "Failed to load the module\n";
+    exit(1);
+  }
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+} // namespace
+
+static llvh::cl::list<unsigned> IdentifierCounts{
+    llvh::cl::Positional,
+    llvh::cl::desc("(identifier counts)")};
+
+static llvh::cl::opt<unsigned> Iterations{
+    "iterations",
+    llvh::cl::init(5),
+    llvh::cl::desc("Number of loads per size; the fastest one is reported")};
+
+static llvh::cl::opt<bool> Persistent{
+    "persistent",
+    llvh::cl::init(true),
+    llvh::cl::desc("Load the module as persistent")};
+
+int main(int argc, char **argv) {
+  // Print a stack trace if we signal out.
+  llvh::sys::PrintStackTraceOnErrorSignal("Hermes driver");
+  llvh::PrettyStackTraceProgram X(argc, argv);
+  // Call llvm_shutdown() on exit to print stats and free memory.
+  llvh::llvm_shutdown_obj Y;
+  llvh::cl::ParseCommandLineOptions(argc, argv, "Hermes module load bench\n");
+
+  std::vector<unsigned> counts(
+      IdentifierCounts.begin(), IdentifierCounts.end());
+  if (counts.empty())
+    counts = {1000, 10000, 100000};
+
+  llvh::outs() << "identifiers      bytes   load (us)\n";
+  for (unsigned count : counts) {
+    auto bytecode = generateBundle(count);
+    double best = loadModule(bytecode, Persistent);
+    for (unsigned i = 1; i < Iterations; ++i)
+      best = std::min(best, loadModule(bytecode, Persistent));
+    llvh::outs() << llvh::format(
+        "%11u %10zu %11.1f\n", count, bytecode.size(), best);
+  }
+  return 0;
+}
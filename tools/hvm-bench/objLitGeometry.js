@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Short-lived points and vectors that never leave the function that creates
+// them.
+
+function length(x, y) {
+    var v = {x: x, y: y};
+    return Math.sqrt(v.x * v.x + v.y * v.y);
+}
+
+function walk(n) {
+    var total = 0;
+    for (var i = 0; i < n; i++) {
+        var p = {x: i, y: i + 1};
+        var d = {x: 3, y: 4};
+        if (i & 1) {
+            d.x = -d.x;
+        }
+        var q = {x: p.x + d.x, y: p.y + d.y};
+        var {x, y} = q;
+        total += length(x, y);
+    }
+    return total;
+}
+
+function run(n) {
+    var total = 0;
+    for (var i = 0; i < n; i++) {
+        total += walk(10000);
+    }
+    return total;
+}
+
+print(run(100));
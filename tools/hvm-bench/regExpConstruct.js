@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+(function() {
+  var numIter = 200000;
+  var routes = [
+    '^/users/([^/]+)/posts/(\\d+)$',
+    '^/search\\?q=([^&]*)(?:&page=(\\d+))?$',
+    '^/static/(.+)\\.(js|css|png)$',
+  ];
+  var words = ['hello', 'goodbye', 'thanks'];
+  var paths = ['/users/bob/posts/12', '/search?q=x&page=2', '/static/a.css'];
+  var count = 0;
+
+  for (var i = 0; i < numIter; i++) {
+    // Route patterns constructed from strings, as a router would.
+    var j = i % routes.length;
+    if (new RegExp(routes[j]).test(paths[j])) {
+      count++;
+    }
+    // Message placeholders, as an i18n library would.
+    var rx = new RegExp('\\{' + words[i % words.length] + '\\}', 'g');
+    count += '{hello} {thanks}'.replace(rx, 'x').length;
+  }
+
+  print('done', count);
+})();
@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+(function() {
+  var numIter = 10000;
+  var lines = [];
+  for (var i = 0; i < 500; i++) {
+    lines.push(
+      'INFO [worker-' + (i % 8) + '] request ' + i + ' served in ' + (i % 97) +
+        'ms from cache',
+    );
+  }
+  lines.push('WARN fetched https://example.com/token?id=1234 for user42');
+  var s = lines.join('\n');
+  var rxs = [/user\d+/g, /https?:\/\//g, /WARN|ERROR/g];
+
+  for (var i = 0; i < numIter; i++) {
+    for (var j = 0; j < rxs.length; j++) {
+      rxs[j].lastIndex = 0;
+      rxs[j].exec(s);
+    }
+  }
+
+  print('done');
+})();
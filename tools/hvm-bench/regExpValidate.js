@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+(function() {
+  var numIter = 100000;
+  var emailRx = /^[\w.+-]+@[\w-]+\.[a-z]{2,}$/;
+  var dateRx = /^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2})/;
+  var tokenRx = /[a-zA-Z_$][\w$]*/g;
+  var inputs = [
+    'someone.else+tag@example-domain.com',
+    'not an email address at all, but long enough to scan',
+    '2020-04-01T12:34:56.789Z',
+  ];
+  var source = 'var total = items.reduce(function (acc, x) { return acc + x; });';
+  var count = 0;
+
+  for (var i = 0; i < numIter; i++) {
+    var input = inputs[i % inputs.length];
+    if (emailRx.test(input)) {
+      count++;
+    }
+    if (dateRx.test(input)) {
+      count++;
+    }
+    tokenRx.lastIndex = 0;
+    while (tokenRx.exec(source)) {
+      count++;
+    }
+  }
+
+  print('done', count);
+})();
@@ -9,6 +9,7 @@
 #include <hermes/BCGen/HBC/BytecodeFileFormat.h>
 #include <hermes/CompileJS.h>
 #include <hermes/hermes.h>
+#include <jsi/instrumentation.h>
 
 using namespace facebook::jsi;
 using namespace facebook::hermes;
@@ -104,6 +105,47 @@ TEST_F(HermesRuntimeTest, ArrayBufferTest) {
   EXPECT_EQ(buffer[1], 5678);
 }
 
+TEST_F(HermesRuntimeTest, ExternalStringTest) {
+  std::string latin1(1000, 'x');
+  std::u16string utf16(1000, u'\u2603');
+  int releasedLatin1 = 0;
+  int releasedUtf16 = 0;
+  {
+    String s1 = rt->createExternalStringFromLatin1(
+        latin1.data(), latin1.size(), [&] { ++releasedLatin1; });
+    String s2 = rt->createExternalStringFromUtf16(
+        utf16.data(), utf16.size(), [&] { ++releasedUtf16; });
+    rt->global().setProperty(*rt, "s1", s1);
+    rt->global().setProperty(*rt, "s2", s2);
+  }
+  EXPECT_EQ(latin1, eval("s1").getString(*rt).utf8(*rt));
+  EXPECT_EQ(1000, eval("s2.length").getNumber());
+  EXPECT_TRUE(eval("s2.charCodeAt(999) === 0x2603").getBool());
+  EXPECT_TRUE(eval("(s1 + 'y').endsWith('xy')").getBool());
+
+  rt->instrumentation().collectGarbage("test");
+  EXPECT_EQ(0, releasedLatin1);
+  EXPECT_EQ(0, releasedUtf16);
+
+  // The characters are released once the strings are unreachable.
+  eval("s1 = s2 = undefined");
+  rt->instrumentation().collectGarbage("test");
+  EXPECT_EQ(1, releasedLatin1);
+  EXPECT_EQ(1, releasedUtf16);
+
+  // Short strings and non-ASCII Latin-1 strings are copied, and released right
+  // away.
+  std::string nonASCII = std::string(200, 'a') + "\xe9";
+  int releasedCopies = 0;
+  String s3 = rt->createExternalStringFromLatin1(
+      nonASCII.data(), nonASCII.size(), [&] { ++releasedCopies; });
+  String s4 = rt->createExternalStringFromLatin1(
+      "short", 5, [&] { ++releasedCopies; });
+  EXPECT_EQ(2, releasedCopies);
+  EXPECT_EQ(std::string(200, 'a') + "\xc3\xa9", s3.utf8(*rt));
+  EXPECT_EQ("short", s4.utf8(*rt));
+}
+
 TEST_F(HermesRuntimeTest, BytecodeTest) {
   const uint8_t shortBytes[] = {1, 2, 3};
   EXPECT_FALSE(HermesRuntime::isHermesBytecode(shortBytes, 0));
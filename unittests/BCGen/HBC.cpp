@@ -487,5 +487,29 @@ TEST(HBCBytecodeGen, BytecodeOptionHasAsync) {
   EXPECT_TRUE(bytecodeHasAsync->getBytecodeOptions().hasAsync);
 }
 
+TEST(HBCBytecodeGen, ParallelGenerationIsDeterministic) {
+  // Many functions sharing literals, with enough locals to spill registers.
+  std::string source;
+  for (int i = 0; i < 200; ++i) {
+    std::string n = std::to_string(i);
+    source += "function f" + n + "(a, b) {\n  var o = {x: " + n +
+        ", y: 'str" + n + "', z: [1, 2, 3]};\n";
+    for (int j = 0; j < i % 7 * 60; ++j)
+      source += "  var v" + std::to_string(j) + " = a * " + std::to_string(j) +
+          " + o.x;\n";
+    source += "  try { return b(o, /re" + n + "/g, 0, null); }\n"
+              "  catch (e) { return e + 'str" +
+        n + "'; }\n}\n";
+  }
+
+  auto sequential = bytecodeForSource(source.c_str());
+  for (unsigned numThreads : {2, 3, 8}) {
+    TestCompileFlags flags;
+    flags.numThreads = numThreads;
+    EXPECT_EQ(sequential, bytecodeForSource(source.c_str(), flags))
+        << numThreads << " threads";
+  }
+}
+
 } // end anonymous namespace
 #undef DEBUG_TYPE
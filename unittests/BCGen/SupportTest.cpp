@@ -88,6 +88,29 @@ TEST(StringStorageTest, ConsecutiveStringStorageTest) {
   EXPECT_EQ(result, "hellosome\\x02stringworld");
 }
 
+TEST(StringStorageTest, KeepInsertionOrderTest) {
+  hbc::UniquingStringLiteralAccumulator USLA;
+
+  USLA.addString("world", /* isIdentifier */ false);
+  USLA.addString("hello", /* isIdentifier */ false);
+  USLA.addString("some string", /* isIdentifier */ false);
+  USLA.addString("world", /* isIdentifier */ false);
+
+  hbc::StringLiteralTable SLT = hbc::UniquingStringLiteralAccumulator::toTable(
+      std::move(USLA),
+      /* optimize */ false,
+      /* keepInsertionOrder */ true);
+
+  EXPECT_EQ(SLT.count(), 3);
+  EXPECT_EQ(SLT.getStringID("world"), 0);
+  EXPECT_EQ(SLT.getStringID("hello"), 1);
+  EXPECT_EQ(SLT.getStringID("some string"), 2);
+
+  std::vector<unsigned char> storage = SLT.acquireStringStorage();
+  EXPECT_EQ(
+      std::string(storage.begin(), storage.end()), "worldhellosome string");
+}
+
 TEST(StringStorageTest, PackingStringStorageTest) {
   std::vector<llvh::StringRef> strings{"phab", "alphabet", "soup", "ou"};
   hbc::ConsecutiveStringStorage storage(strings);
@@ -31,6 +31,7 @@ std::vector<uint8_t> hermes::bytecodeForSource(
   codeGenOpts.unlimitedRegisters = false;
   OptimizationSettings optSettings;
   optSettings.staticBuiltins = flags.staticBuiltins;
+  optSettings.numThreads = flags.numThreads;
   auto context = std::make_shared<Context>(sm, codeGenOpts, optSettings);
   parser::JSParser jsParser(*context, source);
   auto parsed = jsParser.parse();
@@ -49,6 +50,7 @@ std::vector<uint8_t> hermes::bytecodeForSource(
   /* Generate bytecode module */
   auto bytecodeGenOpts = BytecodeGenerationOptions::defaults();
   bytecodeGenOpts.staticBuiltinsEnabled = flags.staticBuiltins;
+  bytecodeGenOpts.numThreads = flags.numThreads;
   auto BM =
       generateBytecodeModule(&M, M.getTopLevelFunction(), bytecodeGenOpts);
   assert(BM != nullptr && "Failed to generate bytecode module");
@@ -18,6 +18,7 @@ namespace hermes {
 
 struct TestCompileFlags {
   bool staticBuiltins{false};
+  unsigned numThreads{1};
 };
 
 /// Compile source code \p source into Hermes bytecode, asserting that it can be
@@ -7,6 +7,8 @@
 
 #include "hermes/Support/Conversions.h"
 
+#include <cmath>
+#include <cstring>
 #include <limits>
 
 #include "gtest/gtest.h"
@@ -163,6 +165,63 @@ TEST(ConversionsTest, numberToStringTest) {
   DoubleToStringTest("0", 0);
   DoubleToStringTest("12384", 12384);
   DoubleToStringTest("-12384", -12384);
+
+  DoubleToStringTest("9007199254740991", 9007199254740991.0);
+  DoubleToStringTest("-9007199254740991", -9007199254740991.0);
+  DoubleToStringTest("9007199254740992", 9007199254740992.0);
+  DoubleToStringTest("-2147483648", -2147483648.0);
+}
+
+TEST(ConversionsTest, parseDecimalFastPathTest) {
+#define FastPathTest(expected, str)                              \
+  do {                                                           \
+    const char *s = str;                                         \
+    auto res = parseDecimalFastPath(s, s + strlen(s));           \
+    ASSERT_TRUE(res.hasValue()) << str;                          \
+    EXPECT_EQ(expected, res.getValue()) << str;                  \
+    EXPECT_EQ(std::signbit(expected), std::signbit(*res)) << str; \
+  } while (0)
+#define SlowPathTest(str)                                           \
+  do {                                                              \
+    const char *s = str;                                            \
+    EXPECT_FALSE(parseDecimalFastPath(s, s + strlen(s)).hasValue()) \
+        << str;                                                     \
+  } while (0)
+
+  FastPathTest(0.0, "0");
+  FastPathTest(-0.0, "-0");
+  FastPathTest(0.0, "0.000");
+  FastPathTest(12384.0, "12384");
+  FastPathTest(12384.0, "+12384");
+  FastPathTest(-12384.0, "-12384");
+  FastPathTest(3.14, "3.14");
+  FastPathTest(0.1, "0.1");
+  FastPathTest(0.5, ".5");
+  FastPathTest(1.0, "1.");
+  FastPathTest(14583.1832, "14583.1832");
+  FastPathTest(1.23e20, "1.23e20");
+  FastPathTest(1.23e-5, "1.23E-5");
+  FastPathTest(5e22, "5e+22");
+  FastPathTest(9007199254740992.0, "9007199254740992");
+  FastPathTest(0.1, "0000000000000000000000000.1");
+
+  // Too many significant digits.
+  SlowPathTest("12345678901234567890");
+  // Mantissa not exactly representable.
+  SlowPathTest("9007199254740993");
+  // Power of ten not exactly representable.
+  SlowPathTest("1e23");
+  SlowPathTest("1e-23");
+  SlowPathTest("1e99999999999");
+  // Malformed.
+  SlowPathTest("");
+  SlowPathTest("-");
+  SlowPathTest(".");
+  SlowPathTest("1e");
+  SlowPathTest("1e+");
+  SlowPathTest("1x");
+  SlowPathTest("1.2.3");
+  SlowPathTest("Infinity");
 }
 
 } // end anonymous namespace
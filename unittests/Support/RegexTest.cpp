@@ -7,6 +7,7 @@
 
 #include "hermes/Regex/Regex.h"
 #include "hermes/Regex/Executor.h"
+#include "hermes/Regex/RegexJIT.h"
 #include "hermes/Regex/RegexTraits.h"
 
 #include <string>
@@ -821,4 +822,341 @@ TEST(Regex, NonASCII) {
       constants::matchInputAllAscii));
 }
 
+static const RegexBytecodeHeader &headerFor(
+    const std::vector<uint8_t> &bytecode) {
+  return *reinterpret_cast<const RegexBytecodeHeader *>(bytecode.data());
+}
+
+static std::u16string prefixFor(
+    const char16_t *pattern,
+    const char16_t *flags = u"") {
+  auto bytecode = cregex(pattern, flags).compile();
+  const auto &header = headerFor(bytecode);
+  return std::u16string(header.prefilterChars, header.prefixLength);
+}
+
+static std::u16string firstCharsFor(
+    const char16_t *pattern,
+    const char16_t *flags = u"") {
+  auto bytecode = cregex(pattern, flags).compile();
+  const auto &header = headerFor(bytecode);
+  return std::u16string(header.prefilterChars, header.firstCharCount);
+}
+
+TEST(Regex, Prefilter) {
+  EXPECT_EQ(u"foo", prefixFor(u"foo\\d+"));
+  EXPECT_EQ(u"http", prefixFor(u"https?:\\/\\/"));
+  EXPECT_EQ(u"abcdefgh", prefixFor(u"abcdefghijk"));
+  EXPECT_EQ(u"ab", prefixFor(u"(?:)ab"));
+  EXPECT_EQ(u"", prefixFor(u"foo", u"i"));
+  EXPECT_EQ(u"", prefixFor(u"a|b"));
+  EXPECT_EQ(u"", prefixFor(u"(foo)"));
+
+  EXPECT_EQ(u"cd", firstCharsFor(u"cat|dog"));
+  EXPECT_EQ(u"ab", firstCharsFor(u"[ba]x"));
+  EXPECT_EQ(u"a", firstCharsFor(u"(a+)b"));
+  EXPECT_EQ(u"ab", firstCharsFor(u"a?b"));
+  EXPECT_EQ(u"b", firstCharsFor(u"(?<=a)b"));
+  EXPECT_EQ(u"", firstCharsFor(u"a*"));
+  EXPECT_EQ(u"", firstCharsFor(u"[^a]x"));
+  EXPECT_EQ(u"", firstCharsFor(u"[a-z]x"));
+  EXPECT_EQ(u"", firstCharsFor(u".x"));
+  EXPECT_EQ(u"", firstCharsFor(u"cat|dog", u"i"));
+  EXPECT_EQ(u"", firstCharsFor(u"\\u{1F600}x", u"u"));
+
+  // Searches must find the same matches as without the prefilter.
+  cmatch m;
+  EXPECT_TRUE(search(u"xx foo foo123", m, cregex(u"foo\\d+")));
+  EXPECT_EQ("(7-13)", flatten(m));
+  EXPECT_TRUE(search(u"see http://x", m, cregex(u"https?:\\/\\/")));
+  EXPECT_EQ("(4-11)", flatten(m));
+  EXPECT_TRUE(search(u"hot dog", m, cregex(u"cat|dog")));
+  EXPECT_EQ("(4-7)", flatten(m));
+  EXPECT_TRUE(search(u"aa ax bx", m, cregex(u"[ab]x")));
+  EXPECT_EQ("(3-5)", flatten(m));
+  EXPECT_TRUE(search(u"bcab", m, cregex(u"(?<=a)b")));
+  EXPECT_EQ("(3-4)", flatten(m));
+  EXPECT_TRUE(search(u"xyzab", m, cregex(u"ab")));
+  EXPECT_EQ("(3-5)", flatten(m));
+  EXPECT_TRUE(search(u"xyzb", m, cregex(u"a?b")));
+  EXPECT_EQ("(3-4)", flatten(m));
+  EXPECT_FALSE(search(u"xyza", m, cregex(u"ab")));
+  EXPECT_FALSE(search(u"fo fo", m, cregex(u"foo")));
+  EXPECT_FALSE(search(u"", m, cregex(u"cat|dog")));
+  EXPECT_TRUE(search(u"xĀāy", m, cregex(u"āy")));
+  EXPECT_EQ("(2-4)", flatten(m));
+}
+
+static bool regexIsBacktrackFree(
+    const char16_t *pattern,
+    const char16_t *flags = u"") {
+  auto bytecode = cregex(pattern, flags).compile();
+  return headerFor(bytecode).backtrackFree;
+}
+
+TEST(Regex, BacktrackFree) {
+  EXPECT_TRUE(regexIsBacktrackFree(u"abc"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"a|b|c"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"(a+)+b"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"\\d{4}-\\d{2}"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"(?:ab)*?c"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"(ab)?c"));
+  EXPECT_TRUE(regexIsBacktrackFree(u"^\\bfoo$", u"im"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"(a)\\1"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"a(?=b)"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"(?<!a)b"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"(ab){2}"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"(a*)*"));
+  EXPECT_FALSE(regexIsBacktrackFree(u"abc", u"u"));
+}
+
+TEST(Regex, WithoutBacktracking) {
+  // Both executors must find the same match and captures.
+  const char16_t *patterns[] = {
+      u"a|ab",
+      u"(a|ab)(c|bcd)(d*)",
+      u"(a+)+b",
+      u"(?:ab)*c",
+      u"((a)|b)+",
+      u"(a?)b",
+      u"a*?b",
+      u"(a*?)(a*)",
+      u".*foo",
+      u"\\bfoo\\b",
+      u"\\Bo",
+      u"^ab|cd$",
+      u"a{2,3}",
+      u"a{2,3}?",
+      u"[a-c]{2,}x",
+      u"(?:a|b)?c",
+      u"(z)((a+)?(b+)?(c))*",
+      u"foo\\d+",
+      u"(cat|dog)s?",
+      u"[^a]+",
+      u"(abc)|(ABD)",
+      u"(?:a|b)*?b",
+      u"(a)?(?:b|(c))*",
+      u"(a|b)+?c",
+      u"(?:(a)|b)*",
+      u"a??b",
+      u"\\w+\\b",
+      u"(a|(b))+?(c|$)",
+  };
+  const char16_t *flagSets[] = {u"", u"i", u"m"};
+  const char16_t *inputs[] = {
+      u"",
+      u"abcd",
+      u"aaab",
+      u"ababc",
+      u"zaacbbbcac",
+      u"xx foo foo123 foobar",
+      u"ab\ncd\nab",
+      u"aaaaxabcx",
+      u"hot dogs and cats",
+      u"abD ABC",
+      u"bbbacbca",
+      u"aabacbc",
+  };
+  for (const char16_t *pattern : patterns) {
+    for (const char16_t *flags : flagSets) {
+      auto bytecode = cregex(pattern, flags).compile();
+      ASSERT_TRUE(headerFor(bytecode).backtrackFree);
+      for (const char16_t *input : inputs) {
+        uint32_t length = std::char_traits<char16_t>::length(input);
+        for (uint32_t start = 0; start <= length; ++start) {
+          cmatch linear, backtracking;
+          auto linearResult = searchWithBytecode(
+              bytecode,
+              input,
+              start,
+              length,
+              &linear,
+              constants::matchNonBacktracking);
+          auto backtrackingResult = searchWithBytecode(
+              bytecode,
+              input,
+              start,
+              length,
+              &backtracking,
+              constants::matchDefault);
+          std::u16string desc = std::u16string(u"/") + pattern + u"/" + flags +
+              u" on \"" + input + u"\" from " + char16_t(u'0' + start);
+          std::string where(desc.begin(), desc.end());
+          ASSERT_EQ(backtrackingResult, linearResult) << where;
+          if (linearResult == MatchRuntimeResult::Match)
+            EXPECT_EQ(flatten(backtracking), flatten(linear)) << where;
+        }
+      }
+    }
+  }
+
+  // This takes exponential time with backtracking alone, so the search must
+  // switch executors.
+  std::u16string as(64, u'a');
+  cmatch m;
+  EXPECT_FALSE(search(as, m, cregex(u"(?:a|aa)*c")));
+  EXPECT_TRUE(search(as + u"c", m, cregex(u"(a|aa)*c")));
+  EXPECT_EQ("(0-65) (63-64)", flatten(m));
+}
+
+#ifdef HERMES_REGEX_JIT
+TEST(Regex, JITUnsupported) {
+  const char16_t *patterns[][2] = {
+      {u"a|b", u""},
+      {u"(a)*", u""},
+      {u"(?:ab)+", u""},
+      {u"(a)\\1", u""},
+      {u"a(?=b)", u""},
+      {u"a", u"i"},
+      {u"a", u"u"},
+  };
+  for (const auto &pattern : patterns) {
+    auto bytecode = cregex(pattern[0], pattern[1]).compile();
+    EXPECT_EQ(nullptr, JITCompiledRegex::compile(bytecode));
+  }
+}
+
+/// Search \p input from every start position, with and without the sticky
+/// flag, using both the compiled regex \p jit and the interpreter, and check
+/// that they agree.
+template <typename CharT>
+static void expectJITMatchesInterpreter(
+    llvh::ArrayRef<uint8_t> bytecode,
+    const JITCompiledRegex &jit,
+    const std::basic_string<CharT> &input,
+    const std::string &desc) {
+  uint32_t length = input.size();
+  for (auto flags : {constants::matchDefault, constants::matchOnlyAtStart}) {
+    bool onlyAtStart = flags & constants::matchOnlyAtStart;
+    for (uint32_t start = 0; start <= length; ++start) {
+      cmatch compiled, interpreted;
+      auto result = jit.search(
+          input.data(), start, length, onlyAtStart, flags, &compiled);
+      auto expected = searchWithBytecode(
+          bytecode, input.data(), start, length, &interpreted, flags);
+      std::string where = desc + " from " + std::to_string(start) +
+          (onlyAtStart ? " sticky" : "");
+      ASSERT_NE(JITCompiledRegex::Result::Fallback, result) << where;
+      ASSERT_EQ(
+          expected == MatchRuntimeResult::Match,
+          result == JITCompiledRegex::Result::Match)
+          << where;
+      if (expected == MatchRuntimeResult::Match) {
+        EXPECT_EQ(flatten(interpreted), flatten(compiled)) << where;
+      }
+    }
+  }
+}
+
+TEST(Regex, JITMatchesInterpreter) {
+  const char16_t *patterns[] = {
+      u"",
+      u"abc",
+      u"a.c",
+      u"^ab",
+      u"cd$",
+      u"^$",
+      u"\\bfoo\\b",
+      u"\\Bo\\B",
+      u"a*",
+      u"a*?b",
+      u"a+b",
+      u"a{2,3}",
+      u"a{2,3}?c",
+      u"a{2}",
+      u"x*y*z*",
+      u".*foo",
+      u".*?foo",
+      u"[a-c]+",
+      u"[^a-c\\s]+",
+      u"[\\d_]+",
+      u"[\\D]+",
+      u"[^\\W\\d]+",
+      u"\\s+\\S+",
+      u"\\w+@\\w+\\.[a-z]{2,}",
+      u"^\\d{3}-\\d{4}$",
+      u"(\\w+) (\\w+)",
+      u"(a*)(b*)(c*)",
+      u"(a*?)(b+)",
+      u"é+",
+      u"[à-ÿ]+\\.",
+      u"[^x]*$",
+  };
+  const char16_t *flagSets[] = {u"", u"m", u"s"};
+  const char16_t *inputs[] = {
+      u"",
+      u"abc",
+      u"aaab",
+      u"aaac",
+      u"xx foo foo123 foobar",
+      u"ab\ncd\nab",
+      u"ab\rcd ab",
+      u"555-1234",
+      u"me@example.com and you@example.org",
+      u"hot dogs and  cats\t",
+      u"abcabcaabbcc",
+      u"caféé naïve.",
+      u"x y　z﻿",
+      u"_9 __ 0x",
+  };
+  for (const char16_t *pattern : patterns) {
+    for (const char16_t *flags : flagSets) {
+      auto bytecode = cregex(pattern, flags).compile();
+      auto jit = JITCompiledRegex::compile(bytecode);
+      std::u16string desc16 = std::u16string(u"/") + pattern + u"/" + flags;
+      std::string desc(desc16.begin(), desc16.end());
+      ASSERT_NE(nullptr, jit) << desc;
+      for (const char16_t *input : inputs) {
+        std::u16string input16(input);
+        std::string inputDesc = desc + " on \"" +
+            std::string(input16.begin(), input16.end()) + "\"";
+        expectJITMatchesInterpreter(bytecode, *jit, input16, inputDesc);
+        if (std::all_of(input16.begin(), input16.end(), [](char16_t c) {
+              return c < 128;
+            })) {
+          std::string input8(input16.begin(), input16.end());
+          expectJITMatchesInterpreter(
+              bytecode, *jit, input8, inputDesc + " (ASCII)");
+        }
+      }
+    }
+  }
+}
+
+TEST(Regex, JITBacktrackBudget) {
+  auto bytecode = cregex(u"a*a*a*a*a*b").compile();
+  auto jit = JITCompiledRegex::compile(bytecode);
+  ASSERT_NE(nullptr, jit);
+  std::u16string as(40, u'a');
+  cmatch m;
+  // The compiled code runs out of backtracks, and the search is completed by
+  // the interpreter.
+  EXPECT_EQ(
+      JITCompiledRegex::Result::Fallback,
+      jit->search(as.data(), 0, as.size(), false, constants::matchDefault, &m));
+  EXPECT_EQ(
+      MatchRuntimeResult::NoMatch,
+      searchWithBytecode(
+          bytecode,
+          as.data(),
+          0,
+          as.size(),
+          &m,
+          constants::matchDefault,
+          jit.get()));
+  as += u'b';
+  EXPECT_EQ(
+      MatchRuntimeResult::Match,
+      searchWithBytecode(
+          bytecode,
+          as.data(),
+          0,
+          as.size(),
+          &m,
+          constants::matchDefault,
+          jit.get()));
+  EXPECT_EQ("(0-41)", flatten(m));
+}
+#endif // HERMES_REGEX_JIT
+
 } // end anonymous namespace
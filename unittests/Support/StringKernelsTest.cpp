@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "hermes/Support/StringKernels.h"
+#include "hermes/Support/UTF8.h"
+
+#include <algorithm>
+#include <string>
+
+namespace {
+
+using namespace hermes;
+
+/// Reference implementation of findSubstring.
+template <typename T>
+size_t naiveFind(
+    const std::basic_string<T> &hay,
+    const std::basic_string<T> &needle) {
+  auto it = std::search(hay.begin(), hay.end(), needle.begin(), needle.end());
+  return it == hay.end() && !needle.empty() ? kStringNotFound
+                                            : it - hay.begin();
+}
+
+template <typename T>
+size_t find(const std::basic_string<T> &hay, const std::basic_string<T> &n) {
+  return findSubstring(
+      llvh::ArrayRef<T>(hay.data(), hay.size()),
+      llvh::ArrayRef<T>(n.data(), n.size()));
+}
+
+llvh::ArrayRef<char> asciiRef(const std::string &str) {
+  return llvh::ArrayRef<char>(str.data(), str.size());
+}
+
+size_t find(const std::string &hay, const char *needle) {
+  return find(hay, std::string(needle));
+}
+
+size_t find(const std::u16string &hay, const char16_t *needle) {
+  return find(hay, std::u16string(needle));
+}
+
+TEST(StringKernelsTest, FindSubstring) {
+  std::string hay =
+      "the quick brown fox jumps over the lazy dog, the quick brown cat";
+  EXPECT_EQ(0u, find(hay, ""));
+  EXPECT_EQ(0u, find(hay, "the"));
+  EXPECT_EQ(4u, find(hay, "q"));
+  EXPECT_EQ(hay.size() - 3, find(hay, "cat"));
+  EXPECT_EQ(hay.find('z'), find(hay, "z"));
+  EXPECT_EQ(kStringNotFound, find(hay, "cow"));
+  EXPECT_EQ(kStringNotFound, find(std::string("ab"), "abc"));
+  EXPECT_EQ(kStringNotFound, find(std::string(), "a"));
+  EXPECT_EQ(0u, find(hay, hay));
+
+  // Compare with the reference implementation at every alignment, so that
+  // matches are found in both the vectorized loop and the scalar tail.
+  std::string needles[] = {"ab", "aab", "abcab", "bbbbbbbbbbbbbbbbbb", "x"};
+  for (size_t len = 0; len < 80; ++len) {
+    std::string s;
+    for (size_t i = 0; i < len; ++i)
+      s.push_back("abc"[(i * 7 + i / 5) % 3]);
+    std::u16string s16(s.begin(), s.end());
+    for (const std::string &n : needles) {
+      std::u16string n16(n.begin(), n.end());
+      EXPECT_EQ(naiveFind(s, n), find(s, n)) << s << " " << n;
+      EXPECT_EQ(naiveFind(s16, n16), find(s16, n16)) << s << " " << n;
+    }
+  }
+}
+
+TEST(StringKernelsTest, FindSubstringUTF16) {
+  std::u16string hay = u"été ☃ snowman ☃☃ end";
+  EXPECT_EQ(0u, find(hay, u""));
+  EXPECT_EQ(4u, find(hay, u"☃"));
+  EXPECT_EQ(14u, find(hay, u"☃☃"));
+  EXPECT_EQ(6u, find(hay, u"snowman"));
+  EXPECT_EQ(kStringNotFound, find(hay, u"☄"));
+}
+
+TEST(StringKernelsTest, ConvertASCIICase) {
+  std::string src = "Hello, World! [@`{] 0123456789 abcXYZ and some more text";
+  std::string dest(src.size(), '\0');
+
+  EXPECT_TRUE(convertASCIICase(asciiRef(src), &dest[0], true));
+  EXPECT_EQ("HELLO, WORLD! [@`{] 0123456789 ABCXYZ AND SOME MORE TEXT", dest);
+  EXPECT_TRUE(convertASCIICase(asciiRef(src), &dest[0], false));
+  EXPECT_EQ("hello, world! [@`{] 0123456789 abcxyz and some more text", dest);
+
+  // Conversion is a no-op.
+  std::string upper = "NOTHING TO DO HERE 0123456789 [@`{]";
+  EXPECT_FALSE(convertASCIICase(asciiRef(upper), &upper[0], true));
+  EXPECT_EQ("NOTHING TO DO HERE 0123456789 [@`{]", upper);
+
+  // Only the last character changes, in the scalar tail.
+  std::string tail = "0123456789ABCDEFGHIJa";
+  EXPECT_TRUE(convertASCIICase(asciiRef(tail), &tail[0], true));
+  EXPECT_EQ("0123456789ABCDEFGHIJA", tail);
+}
+
+TEST(StringKernelsTest, WidenASCII) {
+  for (size_t len = 0; len < 40; ++len) {
+    std::string src;
+    for (size_t i = 0; i < len; ++i)
+      src.push_back(' ' + i);
+    std::u16string dest(len, u'\0');
+    widenASCII(asciiRef(src), &dest[0]);
+    EXPECT_EQ(std::u16string(src.begin(), src.end()), dest);
+  }
+}
+
+TEST(StringKernelsTest, IsAllASCII) {
+  for (size_t len = 0; len < 150; ++len) {
+    std::string s(len, 'a');
+    EXPECT_TRUE(isAllASCII(s.data(), s.data() + len));
+    // Put a non-ASCII byte at every position.
+    for (size_t i = 0; i < len; ++i) {
+      s[i] = '\x80';
+      EXPECT_FALSE(isAllASCII(s.data(), s.data() + len)) << len << " " << i;
+      s[i] = 'a';
+    }
+  }
+}
+
+} // namespace
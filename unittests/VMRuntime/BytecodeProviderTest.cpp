@@ -16,6 +16,18 @@ namespace {
 
 using BytecodeProviderTest = LargeHeapRuntimeTestFixture;
 
+/// An implementation of Buffer through a std::vector of bytes.
+class VectorBuffer final : public Buffer {
+  std::vector<uint8_t> bytecode_;
+
+ public:
+  VectorBuffer(std::vector<uint8_t> &&bytecode)
+      : bytecode_(std::move(bytecode)) {
+    data_ = bytecode_.data();
+    size_ = bytecode_.size();
+  }
+};
+
 TEST_F(BytecodeProviderTest, IdentifierHashesPreserved) {
   // Test that running a bytecode file twice doesn't modify identifier hashes.
   uint32_t identifierCount = 4096;
@@ -57,4 +69,41 @@ TEST_F(BytecodeProviderTest, IdentifierHashesPreserved) {
   }
 }
 
+TEST_F(BytecodeProviderTest, PersistentIdentifiersRegisteredOnFirstUse) {
+  // Test that loading a persistent module only registers the identifiers
+  // that are actually used.
+  uint32_t identifierCount = 4096;
+
+  // Construct JS source with lots of identifiers in a function that is never
+  // called.
+  std::stringstream source;
+  source << "function unused(o) {\n";
+  for (uint32_t i = 0; i < identifierCount; i++)
+    source << "  o.ident" << i << " = " << i << ";\n";
+  source << "}\n";
+  source << "var obj = {};\n";
+  source << "obj.ident7 = 7;\n";
+  source << "obj.ident7 + 1\n";
+
+  std::shared_ptr<BCProviderFromBuffer> bcProvider =
+      hbc::BCProviderFromBuffer::createBCProviderFromBuffer(
+          std::make_unique<VectorBuffer>(
+              bytecodeForSource(source.str().c_str())))
+          .first;
+  ASSERT_NE(nullptr, bcProvider);
+
+  IdentifierTable &table = runtime->getIdentifierTable();
+  uint32_t symbolsBefore = table.getSymbolsEnd();
+
+  RuntimeModuleFlags flags;
+  flags.persistent = true;
+  auto cr = runtime->runBytecode(
+      bcProvider, flags, "sourceURL", runtime->makeNullHandle<Environment>());
+  ASSERT_TRUE(cr == ExecutionStatus::RETURNED);
+  EXPECT_EQ(8u, cr->getNumberAs<uint32_t>());
+
+  // Only a handful of identifiers (unused, obj, ident7, ...) were needed.
+  EXPECT_LT(table.getSymbolsEnd() - symbolsBefore, 16u);
+}
+
 } // namespace
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/VM/RegExpCache.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace hermes::vm;
+
+namespace {
+
+llvh::ArrayRef<char16_t> toRef(const std::u16string &str) {
+  return llvh::ArrayRef<char16_t>(str.data(), str.size());
+}
+
+std::vector<uint8_t> bytecode(uint8_t tag, size_t size = 4) {
+  return std::vector<uint8_t>(size, tag);
+}
+
+TEST(RegExpCacheTest, HitAndMiss) {
+  instrumentation::RuntimeStats stats(false);
+  RegExpCache cache(4, stats);
+  std::u16string abc = u"a+b*c";
+
+  EXPECT_EQ(nullptr, cache.lookup(toRef(abc), 0));
+  cache.insert(toRef(abc), 0, bytecode(1));
+  // The flags are part of the key.
+  EXPECT_EQ(nullptr, cache.lookup(toRef(abc), 1));
+  cache.insert(toRef(abc), 1, bytecode(2));
+
+  const std::vector<uint8_t> *found = cache.lookup(toRef(abc), 0);
+  ASSERT_NE(nullptr, found);
+  EXPECT_EQ(bytecode(1), *found);
+  found = cache.lookup(toRef(std::u16string(u"a+b*c")), 1);
+  ASSERT_NE(nullptr, found);
+  EXPECT_EQ(bytecode(2), *found);
+
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_EQ(2 * (abc.size() * 2 + 4), cache.getBytes());
+  EXPECT_EQ(2u, stats.regExpCache.hits);
+  EXPECT_EQ(2u, stats.regExpCache.misses);
+  EXPECT_EQ(0u, stats.regExpCache.evictions);
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.size());
+  EXPECT_EQ(0u, cache.getBytes());
+  EXPECT_EQ(nullptr, cache.lookup(toRef(abc), 0));
+}
+
+TEST(RegExpCacheTest, EvictsLeastRecentlyUsed) {
+  instrumentation::RuntimeStats stats(false);
+  RegExpCache cache(3, stats);
+  std::u16string patterns[] = {u"a", u"b", u"c", u"d"};
+
+  for (uint8_t i = 0; i < 3; ++i)
+    cache.insert(toRef(patterns[i]), 0, bytecode(i));
+  // Touch "a", so that "b" is now the least recently used entry.
+  EXPECT_NE(nullptr, cache.lookup(toRef(patterns[0]), 0));
+  cache.insert(toRef(patterns[3]), 0, bytecode(3));
+
+  EXPECT_EQ(3u, cache.size());
+  EXPECT_EQ(1u, stats.regExpCache.evictions);
+  EXPECT_EQ(nullptr, cache.lookup(toRef(patterns[1]), 0));
+  EXPECT_NE(nullptr, cache.lookup(toRef(patterns[0]), 0));
+  EXPECT_NE(nullptr, cache.lookup(toRef(patterns[2]), 0));
+  EXPECT_NE(nullptr, cache.lookup(toRef(patterns[3]), 0));
+}
+
+TEST(RegExpCacheTest, SizeLimits) {
+  instrumentation::RuntimeStats stats(false);
+
+  // A cache with no entries is disabled, and does not count lookups.
+  RegExpCache disabled(0, stats);
+  std::u16string a = u"a";
+  disabled.insert(toRef(a), 0, bytecode(0));
+  EXPECT_EQ(nullptr, disabled.lookup(toRef(a), 0));
+  EXPECT_EQ(0u, disabled.size());
+  EXPECT_EQ(0u, stats.regExpCache.misses);
+
+  RegExpCache cache(100, stats);
+  std::u16string longPattern(RegExpCache::kMaxPatternLength + 1, u'x');
+  cache.insert(toRef(longPattern), 0, bytecode(0));
+  EXPECT_EQ(0u, cache.size());
+
+  // Bytecode that would fill more than the whole cache is not kept.
+  cache.insert(toRef(a), 0, bytecode(0, RegExpCache::kMaxBytes));
+  EXPECT_EQ(0u, cache.size());
+
+  // Entries are evicted to stay within the byte limit.
+  const size_t third = RegExpCache::kMaxBytes / 3;
+  std::u16string patterns[] = {u"a", u"b", u"c"};
+  for (uint8_t i = 0; i < 3; ++i)
+    cache.insert(toRef(patterns[i]), 0, bytecode(i, third));
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_EQ(1u, stats.regExpCache.evictions);
+  EXPECT_LE(cache.getBytes(), RegExpCache::kMaxBytes);
+  EXPECT_EQ(nullptr, cache.lookup(toRef(patterns[0]), 0));
+}
+
+} // namespace
@@ -87,4 +87,32 @@ TEST_F(StringBuilderTest, AbnormalBuildTest) {
   auto view3 = StringPrimitive::createStringView(runtime, result3);
   ASSERT_TRUE(view3.equals(createUTF16Ref(u"abcdefg\x100")));
 }
+
+TEST_F(StringBuilderTest, SubstringBuildTest) {
+  auto ascii = StringPrimitive::createNoThrow(runtime, "0123456789");
+  auto utf16 =
+      StringPrimitive::createNoThrow(runtime, createUTF16Ref(u"ab\u0100cd"));
+
+  auto builder =
+      StringBuilder::createStringBuilder(runtime, hermes::SafeUInt32{5}, true);
+  ASSERT_NE(builder, ExecutionStatus::EXCEPTION);
+  builder->appendStringPrim(ascii, 7, 3);
+  builder->appendStringPrim(ascii, 0, 0);
+  builder->appendStringPrim(ascii, 2, 2);
+  auto result1 = builder->getStringPrimitive();
+  ASSERT_TRUE(result1->isASCII());
+  auto view1 = StringPrimitive::createStringView(runtime, result1);
+  ASSERT_TRUE(view1.equals(createASCIIRef("78923")));
+
+  // Appending a non-ASCII range switches the builder to UTF16.
+  builder =
+      StringBuilder::createStringBuilder(runtime, hermes::SafeUInt32{4}, true);
+  ASSERT_NE(builder, ExecutionStatus::EXCEPTION);
+  builder->appendStringPrim(ascii, 1, 1);
+  builder->appendStringPrim(utf16, 1, 3);
+  auto result2 = builder->getStringPrimitive();
+  ASSERT_FALSE(result2->isASCII());
+  auto view2 = StringPrimitive::createStringView(runtime, result2);
+  ASSERT_TRUE(view2.equals(createUTF16Ref(u"1b\u0100c")));
+}
 } // namespace
@@ -96,6 +96,41 @@ TEST_F(StringPrimTest, CreateEfficientTest) {
   }
 }
 
+TEST_F(StringPrimTest, ShortStringCacheTest) {
+  auto handlefy = [&](CallResult<HermesValue> cr) {
+    return Handle<StringPrimitive>::vmcast(runtime, *cr);
+  };
+
+  // Equal short strings share a single primitive, regardless of the width of
+  // the input.
+  auto s1 =
+      handlefy(StringPrimitive::createEfficient(runtime, createASCIIRef("key")));
+  auto s2 = handlefy(
+      StringPrimitive::createEfficient(runtime, createUTF16Ref(u"key")));
+  auto s3 = handlefy(StringPrimitive::slice(runtime, s1, 0, 3));
+  EXPECT_EQ(s1.get(), s2.get());
+  EXPECT_EQ(s1.get(), s3.get());
+
+  // The cache is weak, so the entries survive a collection only while the
+  // string is otherwise reachable.
+  runtime->collect("test");
+  auto s4 =
+      handlefy(StringPrimitive::createEfficient(runtime, createASCIIRef("key")));
+  EXPECT_EQ(s1.get(), s4.get());
+  auto other = handlefy(
+      StringPrimitive::createEfficient(runtime, createASCIIRef("kez")));
+  EXPECT_NE(s1.get(), other.get());
+
+  // Longer strings are not cached.
+  std::string longStr(Runtime::kShortStringCacheMaxLength + 1, 'a');
+  auto l1 = handlefy(StringPrimitive::createEfficient(
+      runtime, createASCIIRef(longStr.c_str())));
+  auto l2 = handlefy(StringPrimitive::createEfficient(
+      runtime, createASCIIRef(longStr.c_str())));
+  EXPECT_NE(l1.get(), l2.get());
+  EXPECT_TRUE(l1->equals(l2.get()));
+}
+
 TEST_F(StringPrimTest, CompareTest) {
 #define TEST_CMP(v, a, b)                                 \
   {                                                       \